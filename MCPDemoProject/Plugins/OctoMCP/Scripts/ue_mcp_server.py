@@ -44,6 +44,15 @@ SET_WIDGET_IMAGE_TEXTURE_TIMEOUT_SECONDS = 30.0
 SET_WIDGET_PANEL_COLOR_TIMEOUT_SECONDS = 30.0
 SET_SIZE_BOX_HEIGHT_OVERRIDE_TIMEOUT_SECONDS = 30.0
 SET_POPUP_OPEN_ELASTIC_SCALE_TIMEOUT_SECONDS = 30.0
+FLUSH_SAVES_TIMEOUT_SECONDS = 120.0
+APPLY_TEXTURE_PROFILE_TIMEOUT_SECONDS = 300.0
+PACK_ICON_ATLAS_TIMEOUT_SECONDS = 300.0
+APPLY_WIDGET_TREE_TIMEOUT_SECONDS = 60.0
+GET_WIDGET_TREE_TIMEOUT_SECONDS = 30.0
+SET_WIDGET_PROPERTIES_TIMEOUT_SECONDS = 60.0
+FAN_OUT_WIDGET_EDIT_TIMEOUT_SECONDS = 600.0
+DRY_RUN_TIMEOUT_SECONDS = 60.0
+SET_WIDGET_INVALIDATION_BOUNDARY_TIMEOUT_SECONDS = 30.0
 VERSION_TOOL_NAME = "ue_get_version_info"
 LIVE_CODING_TOOL_NAME = "ue_live_coding_compile"
 CREATE_BLUEPRINT_ASSET_TOOL_NAME = "ue_create_blueprint_asset"
@@ -66,6 +75,20 @@ SET_WIDGET_IMAGE_TEXTURE_TOOL_NAME = "ue_set_widget_image_texture"
 SET_WIDGET_PANEL_COLOR_TOOL_NAME = "ue_set_widget_panel_color"
 SET_SIZE_BOX_HEIGHT_OVERRIDE_TOOL_NAME = "ue_set_size_box_height_override"
 SET_POPUP_OPEN_ELASTIC_SCALE_TOOL_NAME = "ue_set_popup_open_elastic_scale"
+FLUSH_SAVES_TOOL_NAME = "ue_flush_saves"
+GET_SAVE_QUEUE_STATUS_TOOL_NAME = "ue_get_save_queue_status"
+QUERY_ASSETS_TOOL_NAME = "ue_query_assets"
+APPLY_TEXTURE_PROFILE_TOOL_NAME = "ue_apply_texture_profile"
+PACK_ICON_ATLAS_TOOL_NAME = "ue_pack_icon_atlas"
+APPLY_WIDGET_TREE_TOOL_NAME = "ue_apply_widget_tree"
+GET_WIDGET_TREE_TOOL_NAME = "ue_get_widget_tree"
+SET_WIDGET_PROPERTIES_TOOL_NAME = "ue_set_widget_properties"
+FAN_OUT_WIDGET_EDIT_TOOL_NAME = "ue_fan_out_widget_edit"
+DRY_RUN_TOOL_NAME = "ue_dry_run"
+GET_WORKING_SET_TOOL_NAME = "ue_get_working_set"
+PIN_WORKING_SET_ASSET_TOOL_NAME = "ue_pin_working_set_asset"
+UNPIN_WORKING_SET_ASSET_TOOL_NAME = "ue_unpin_working_set_asset"
+SET_WIDGET_INVALIDATION_BOUNDARY_TOOL_NAME = "ue_set_widget_invalidation_boundary"
 
 
 class JsonRpcError(Exception):
@@ -246,6 +269,15 @@ def build_create_blueprint_asset_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the newly created Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "parentClassPath"],
             "additionalProperties": False,
@@ -293,7 +325,8 @@ def build_create_widget_blueprint_tool_definition() -> dict[str, Any]:
         "title": "Create Unreal Widget Blueprint",
         "description": (
             "Create a Widget Blueprint asset in the running Unreal Editor using the "
-            "specified parent UUserWidget-derived class."
+            "specified parent UUserWidget-derived class. With scaffoldType the asset is copied from that "
+            "scaffold's prebuilt template and retargeted to the parent class instead of starting empty."
         ),
         "inputSchema": {
             "type": "object",
@@ -311,11 +344,43 @@ def build_create_widget_blueprint_tool_definition() -> dict[str, Any]:
                         "Parent widget class path such as /Script/MCPDemoProject.MCPPopupWidget."
                     ),
                 },
+                "scaffoldType": {
+                    "type": "string",
+                    "enum": [
+                        "popup",
+                        "bottom_button_bar",
+                        "scroll_uniform_grid_host",
+                        "virtualized_uniform_grid_host",
+                        "tile_view_host",
+                        "tile_view_entry",
+                        "item_tile_popup",
+                        "item_tile_entry",
+                    ],
+                    "description": (
+                        "Optional scaffold whose prebuilt template the new asset is copied from. "
+                        "Entry scaffolds need a parent class that implements UserObjectListEntry."
+                    ),
+                },
+                "invalidationBoundary": {
+                    "type": "string",
+                    "enum": ["invalidation", "retainer", "none"],
+                    "default": "invalidation",
+                    "description": "Boundary variant of the scaffold template to copy. Ignored without scaffoldType.",
+                },
                 "saveAsset": {
                     "type": "boolean",
                     "default": True,
                     "description": "Save the newly created asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "parentClassPath"],
             "additionalProperties": False,
@@ -334,6 +399,10 @@ def build_create_widget_blueprint_tool_definition() -> dict[str, Any]:
                 "assetName": {"type": "string"},
                 "parentClassPath": {"type": "string"},
                 "parentClassName": {"type": "string"},
+                "scaffoldType": {"type": "string"},
+                "fromTemplate": {"type": "boolean"},
+                "templateCreated": {"type": "boolean"},
+                "templateAssetPath": {"type": "string"},
                 "editorReachable": {"type": "boolean"},
             },
             "required": [
@@ -348,6 +417,10 @@ def build_create_widget_blueprint_tool_definition() -> dict[str, Any]:
                 "assetName",
                 "parentClassPath",
                 "parentClassName",
+                "scaffoldType",
+                "fromTemplate",
+                "templateCreated",
+                "templateAssetPath",
                 "editorReachable",
             ],
             "additionalProperties": False,
@@ -360,7 +433,8 @@ def build_import_texture_asset_tool_definition() -> dict[str, Any]:
         "name": IMPORT_TEXTURE_ASSET_TOOL_NAME,
         "title": "Import Unreal texture asset",
         "description": (
-            "Import a texture file such as PNG into the running Unreal Editor as a project asset."
+            "Import a texture file such as PNG into the running Unreal Editor as a project asset. "
+            "Re-imports whose source bytes match the stored import hash are skipped."
         ),
         "inputSchema": {
             "type": "object",
@@ -376,6 +450,14 @@ def build_import_texture_asset_tool_definition() -> dict[str, Any]:
                         "full object path such as /Game/UI/Image/T_Duck.T_Duck."
                     ),
                 },
+                "importProfile": {
+                    "type": "string",
+                    "enum": ["ui_icon", "ui_image"],
+                    "description": (
+                        "Optional UI texture profile. Sets the UI LOD group, no mipmaps, UserInterface2D compression, "
+                        "no streaming and a max size of 256 (ui_icon) or 2048 (ui_image)."
+                    ),
+                },
                 "replaceExisting": {
                     "type": "boolean",
                     "default": True,
@@ -386,6 +468,15 @@ def build_import_texture_asset_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the imported asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["sourceFilePath", "assetPath"],
             "additionalProperties": False,
@@ -395,6 +486,8 @@ def build_import_texture_asset_tool_definition() -> dict[str, Any]:
             "properties": {
                 "mcpProtocolVersion": {"type": "string"},
                 "imported": {"type": "boolean"},
+                "skippedUnchanged": {"type": "boolean"},
+                "profileApplied": {"type": "boolean"},
                 "saved": {"type": "boolean"},
                 "success": {"type": "boolean"},
                 "message": {"type": "string"},
@@ -403,11 +496,14 @@ def build_import_texture_asset_tool_definition() -> dict[str, Any]:
                 "assetObjectPath": {"type": "string"},
                 "packagePath": {"type": "string"},
                 "assetName": {"type": "string"},
+                "importProfile": {"type": "string"},
                 "editorReachable": {"type": "boolean"},
             },
             "required": [
                 "mcpProtocolVersion",
                 "imported",
+                "skippedUnchanged",
+                "profileApplied",
                 "saved",
                 "success",
                 "message",
@@ -416,6 +512,7 @@ def build_import_texture_asset_tool_definition() -> dict[str, Any]:
                 "assetObjectPath",
                 "packagePath",
                 "assetName",
+                "importProfile",
                 "editorReachable",
             ],
             "additionalProperties": False,
@@ -458,6 +555,15 @@ def build_add_widget_blueprint_child_instance_tool_definition() -> dict[str, Any
                     "default": True,
                     "description": "Save the updated Widget Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": [
                 "assetPath",
@@ -532,6 +638,15 @@ def build_set_uniform_grid_slot_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the updated Widget Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "widgetName", "row", "column"],
             "additionalProperties": False,
@@ -605,6 +720,15 @@ def build_sync_uniform_grid_widget_instances_tool_definition() -> dict[str, Any]
                     "default": True,
                     "description": "Save the updated Widget Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": [
                 "assetPath",
@@ -687,6 +811,15 @@ def build_add_blueprint_interface_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the updated Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "interfaceClassPath"],
             "additionalProperties": False,
@@ -755,6 +888,15 @@ def build_configure_tile_view_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the updated Widget Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "widgetName", "entryWidgetAssetPath", "entryWidth", "entryHeight"],
             "additionalProperties": False,
@@ -829,6 +971,15 @@ def build_reorder_widget_child_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the updated Widget Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "widgetName", "desiredIndex"],
             "additionalProperties": False,
@@ -895,6 +1046,15 @@ def build_remove_widget_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the updated Widget Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "widgetName"],
             "additionalProperties": False,
@@ -971,6 +1131,15 @@ def build_set_widget_background_blur_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the updated Widget Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "widgetName"],
             "additionalProperties": False,
@@ -1045,6 +1214,15 @@ def build_set_widget_corner_radius_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the updated Widget Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "widgetName", "radius"],
             "additionalProperties": False,
@@ -1124,6 +1302,15 @@ def build_set_widget_panel_color_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the updated Widget Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "widgetName", "red", "green", "blue", "alpha"],
             "additionalProperties": False,
@@ -1194,6 +1381,15 @@ def build_set_size_box_height_override_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the updated Widget Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "widgetName", "heightOverride"],
             "additionalProperties": False,
@@ -1286,6 +1482,15 @@ def build_set_popup_open_elastic_scale_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the updated Widget Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath"],
             "additionalProperties": False,
@@ -1338,8 +1543,10 @@ def build_scaffold_widget_blueprint_tool_definition() -> dict[str, Any]:
         "name": SCAFFOLD_WIDGET_BLUEPRINT_TOOL_NAME,
         "title": "Scaffold Unreal Widget Blueprint",
         "description": (
-            "Populate an existing Widget Blueprint asset with a predefined widget-tree scaffold. "
-            "Supports popup, bottom button bar, scroll UniformGrid host, TileView host, TileView entry, item tile popup, and item tile entry scaffolds."
+            "Populate an existing Widget Blueprint asset with a predefined widget-tree scaffold, or create a missing one "
+            "as a copy of the scaffold type's prebuilt template when useTemplate is true. "
+            "Supports popup, bottom button bar, scroll UniformGrid host, virtualized UniformGrid host, TileView host, TileView entry, item tile popup, and item tile entry scaffolds. "
+            "Static chrome is wrapped in invalidation boundaries by default."
         ),
         "inputSchema": {
             "type": "object",
@@ -1357,6 +1564,7 @@ def build_scaffold_widget_blueprint_tool_definition() -> dict[str, Any]:
                         "popup",
                         "bottom_button_bar",
                         "scroll_uniform_grid_host",
+                        "virtualized_uniform_grid_host",
                         "tile_view_host",
                         "tile_view_entry",
                         "item_tile_popup",
@@ -1364,11 +1572,45 @@ def build_scaffold_widget_blueprint_tool_definition() -> dict[str, Any]:
                     ],
                     "description": "Predefined widget tree scaffold to apply to the target Widget Blueprint.",
                 },
+                "useTemplate": {
+                    "type": "boolean",
+                    "default": False,
+                    "description": (
+                        "Create a missing asset as a copy of the scaffold type's prebuilt template instead of failing. "
+                        "Existing assets are still rebuilt in place."
+                    ),
+                },
+                "parentClassPath": {
+                    "type": "string",
+                    "description": (
+                        "Optional parent class for a template copy, such as /Script/MCPDemoProject.MCPPopupWidget. "
+                        "Only valid when a new asset is created from a template."
+                    ),
+                },
+                "invalidationBoundary": {
+                    "type": "string",
+                    "enum": ["invalidation", "retainer", "none"],
+                    "default": "invalidation",
+                    "description": (
+                        "Boundary placed around the scaffold's static subtrees. invalidation caches them with an "
+                        "InvalidationBox, retainer renders them to a RetainerBox target redrawn only on invalidation, "
+                        "none emits the plain hierarchy. List entries are never wrapped."
+                    ),
+                },
                 "saveAsset": {
                     "type": "boolean",
                     "default": True,
                     "description": "Save the updated asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "scaffoldType"],
             "additionalProperties": False,
@@ -1385,6 +1627,13 @@ def build_scaffold_widget_blueprint_tool_definition() -> dict[str, Any]:
                 "packagePath": {"type": "string"},
                 "assetName": {"type": "string"},
                 "scaffoldType": {"type": "string"},
+                "fromTemplate": {"type": "boolean"},
+                "templateCreated": {"type": "boolean"},
+                "parentRetargeted": {"type": "boolean"},
+                "templateAssetPath": {"type": "string"},
+                "parentClassPath": {"type": "string"},
+                "invalidationBoundary": {"type": "string"},
+                "boundaryWidgetNames": {"type": "array", "items": {"type": "string"}},
                 "editorReachable": {"type": "boolean"},
             },
             "required": [
@@ -1397,6 +1646,13 @@ def build_scaffold_widget_blueprint_tool_definition() -> dict[str, Any]:
                 "packagePath",
                 "assetName",
                 "scaffoldType",
+                "fromTemplate",
+                "templateCreated",
+                "parentRetargeted",
+                "templateAssetPath",
+                "parentClassPath",
+                "invalidationBoundary",
+                "boundaryWidgetNames",
                 "editorReachable",
             ],
             "additionalProperties": False,
@@ -1434,6 +1690,15 @@ def build_set_blueprint_class_property_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the updated Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "propertyName", "valueClassPath"],
             "additionalProperties": False,
@@ -1505,6 +1770,15 @@ def build_set_widget_image_texture_tool_definition() -> dict[str, Any]:
                     "default": True,
                     "description": "Save the updated Widget Blueprint asset to disk before responding.",
                 },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
             },
             "required": ["assetPath", "widgetName", "textureAssetPath"],
             "additionalProperties": False,
@@ -1655,120 +1929,2123 @@ def build_bootstrap_project_map_tool_definition() -> dict[str, Any]:
     }
 
 
-def require_initialized(method: str) -> None:
-    if not STATE.initialized:
-        raise JsonRpcError(-32002, f"Server has not received notifications/initialized before {method}.")
-
-
-def require_tool_arguments(tool_name: str, arguments: Any) -> dict[str, Any]:
-    if arguments is None:
-        return {}
-
-    if not isinstance(arguments, dict):
-        raise JsonRpcError(-32602, f"{tool_name} arguments must be an object.")
-
-    return arguments
-
-
-def call_ue_bridge(
-    command: str, arguments: dict[str, Any] | None = None, timeout_seconds: float = UE_TIMEOUT_SECONDS
-) -> dict[str, Any]:
-    request_body = json.dumps(
-        {
-            "command": command,
-            "arguments": arguments or {},
-            "requestId": str(uuid.uuid4()),
+def build_flush_saves_tool_definition() -> dict[str, Any]:
+    return {
+        "name": FLUSH_SAVES_TOOL_NAME,
+        "title": "Flush deferred Unreal asset saves",
+        "description": (
+            "Save every package queued by commands that ran with saveMode=deferred in a single batch "
+            "instead of waiting for the quiet period. Queued packages that are no longer dirty, for example "
+            "because they were saved from the editor meanwhile, are reported as skipped."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {},
+            "additionalProperties": False,
         },
-        ensure_ascii=False,
-        separators=(",", ":"),
-    )
-
-    connection = http.client.HTTPConnection(UE_HOST, UE_PORT, timeout=timeout_seconds)
-    try:
-        connection.request(
-            "POST",
-            "/api/v1/command",
-            body=request_body.encode("utf-8"),
-            headers={
-                "Accept": "application/json",
-                "Content-Type": "application/json",
+        "outputSchema": {
+            "type": "object",
+            "properties": {
+                "mcpProtocolVersion": {"type": "string"},
+                "success": {"type": "boolean"},
+                "savedCount": {"type": "integer"},
+                "failedCount": {"type": "integer"},
+                "skippedCount": {"type": "integer"},
+                "message": {"type": "string"},
+                "savedPackages": {"type": "array", "items": {"type": "string"}},
+                "failedPackages": {"type": "array", "items": {"type": "string"}},
+                "skippedPackages": {"type": "array", "items": {"type": "string"}},
+                "editorReachable": {"type": "boolean"},
             },
-        )
-        response = connection.getresponse()
-        response_bytes = response.read()
-    except OSError as exc:
-        raise UeBridgeError(
-            f"Unable to reach the Unreal Editor bridge at http://{UE_HOST}:{UE_PORT}: {exc}",
-            editor_reachable=False,
-        ) from exc
-    finally:
-        connection.close()
-
-    response_text = response_bytes.decode("utf-8", errors="replace")
-    try:
-        payload = json.loads(response_text) if response_text else {}
-    except json.JSONDecodeError as exc:
-        raise UeBridgeError(
-            f"Unreal Editor bridge returned malformed JSON (HTTP {response.status}): {exc.msg}",
-            editor_reachable=True,
-        ) from exc
-
-    if response.status != 200:
-        error = payload.get("error", {})
-        code = error.get("code", "bridge_error")
-        message = error.get("message", f"Bridge request failed with HTTP {response.status}")
-        raise UeBridgeError(f"{code}: {message}", editor_reachable=True)
-
-    if not payload.get("ok", False):
-        error = payload.get("error", {})
-        code = error.get("code", "bridge_error")
-        message = error.get("message", "Bridge request failed.")
-        raise UeBridgeError(f"{code}: {message}", editor_reachable=True)
-
-    result = payload.get("result")
-    if not isinstance(result, dict):
-        raise UeBridgeError(
-            "Unreal Editor bridge response is missing a result object.",
-            editor_reachable=True,
-        )
-
-    return result
-
-
-def build_version_tool_success() -> dict[str, Any]:
-    bridge_result = call_ue_bridge("get_version_info")
-    structured_content = {
-        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "engineVersion": str(bridge_result.get("engineVersion", "")),
-        "buildVersion": str(bridge_result.get("buildVersion", "")),
-        "projectName": str(bridge_result.get("projectName", "")),
-        "pluginVersion": str(bridge_result.get("pluginVersion", "")),
-        "editorReachable": True,
+            "required": [
+                "mcpProtocolVersion",
+                "success",
+                "savedCount",
+                "failedCount",
+                "skippedCount",
+                "message",
+                "savedPackages",
+                "failedPackages",
+                "skippedPackages",
+                "editorReachable",
+            ],
+            "additionalProperties": False,
+        },
     }
 
-    summary = (
-        f"MCP {structured_content['mcpProtocolVersion']} | "
-        f"UE {structured_content['engineVersion']} | "
-        f"Build {structured_content['buildVersion']} | "
-        f"Project {structured_content['projectName']} | "
-        f"Plugin {structured_content['pluginVersion']}"
-    )
 
+def build_get_save_queue_status_tool_definition() -> dict[str, Any]:
     return {
-        "content": [{"type": "text", "text": summary}],
-        "structuredContent": structured_content,
-        "isError": False,
+        "name": GET_SAVE_QUEUE_STATUS_TOOL_NAME,
+        "title": "Get Unreal deferred save queue status",
+        "description": (
+            "Report packages still waiting in the deferred save queue and the outcome of the last flush, "
+            "including packages that failed to save."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {},
+            "additionalProperties": False,
+        },
+        "outputSchema": {
+            "type": "object",
+            "properties": {
+                "mcpProtocolVersion": {"type": "string"},
+                "lastFlushSucceeded": {"type": "boolean"},
+                "pendingCount": {"type": "integer"},
+                "totalFlushCount": {"type": "integer"},
+                "secondsSinceLastQueued": {"type": "number"},
+                "secondsSinceLastFlush": {"type": "number"},
+                "quietPeriodSeconds": {"type": "number"},
+                "lastFlushMessage": {"type": "string"},
+                "pendingPackages": {"type": "array", "items": {"type": "string"}},
+                "lastFlushFailedPackages": {"type": "array", "items": {"type": "string"}},
+                "editorReachable": {"type": "boolean"},
+            },
+            "required": [
+                "mcpProtocolVersion",
+                "lastFlushSucceeded",
+                "pendingCount",
+                "totalFlushCount",
+                "secondsSinceLastQueued",
+                "secondsSinceLastFlush",
+                "quietPeriodSeconds",
+                "lastFlushMessage",
+                "pendingPackages",
+                "lastFlushFailedPackages",
+                "editorReachable",
+            ],
+            "additionalProperties": False,
+        },
     }
 
 
-def build_version_tool_error(message: str, editor_reachable: bool) -> dict[str, Any]:
-    structured_content = {
-        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "engineVersion": "",
-        "buildVersion": "",
-        "projectName": "",
-        "pluginVersion": "",
-        "editorReachable": editor_reachable,
+def build_query_assets_tool_definition() -> dict[str, Any]:
+    return {
+        "name": QUERY_ASSETS_TOOL_NAME,
+        "title": "Query Unreal assets",
+        "description": (
+            "List project assets by class, path prefix, name substring and asset registry tags with paging. "
+            "Served from the editor's in-memory asset index without loading any asset. Class, path and tag "
+            "filters are indexed; a query with only nameContains scans every indexed asset."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {
+                "classPath": {
+                    "type": "string",
+                    "description": (
+                        "Asset class path such as /Script/UMGEditor.WidgetBlueprint or a short class name such as Texture2D."
+                    ),
+                },
+                "pathPrefix": {
+                    "type": "string",
+                    "description": "Package path prefix such as /Game/UI or /Game/UI/Widget/WBP_.",
+                },
+                "nameContains": {
+                    "type": "string",
+                    "description": "Case-insensitive substring of the asset name.",
+                },
+                "tags": {
+                    "type": "object",
+                    "additionalProperties": {"type": "string"},
+                    "description": (
+                        "Asset registry tag filters. An empty string or * only requires the tag to exist; "
+                        "any other value must match case-insensitively."
+                    ),
+                },
+                "offset": {
+                    "type": "integer",
+                    "minimum": 0,
+                    "default": 0,
+                    "description": "Number of matches to skip.",
+                },
+                "limit": {
+                    "type": "integer",
+                    "minimum": 1,
+                    "maximum": 1000,
+                    "default": 100,
+                    "description": "Maximum number of matches to return.",
+                },
+            },
+            "additionalProperties": False,
+        },
+        "outputSchema": {
+            "type": "object",
+            "properties": {
+                "mcpProtocolVersion": {"type": "string"},
+                "success": {"type": "boolean"},
+                "indexReady": {"type": "boolean"},
+                "totalCount": {"type": "integer"},
+                "returnedCount": {"type": "integer"},
+                "offset": {"type": "integer"},
+                "limit": {"type": "integer"},
+                "indexedAssetCount": {"type": "integer"},
+                "indexRevision": {"type": "integer"},
+                "message": {"type": "string"},
+                "assets": {
+                    "type": "array",
+                    "items": {
+                        "type": "object",
+                        "properties": {
+                            "assetObjectPath": {"type": "string"},
+                            "assetPath": {"type": "string"},
+                            "packagePath": {"type": "string"},
+                            "assetName": {"type": "string"},
+                            "classPath": {"type": "string"},
+                            "className": {"type": "string"},
+                        },
+                    },
+                },
+                "editorReachable": {"type": "boolean"},
+            },
+            "required": [
+                "mcpProtocolVersion",
+                "success",
+                "indexReady",
+                "totalCount",
+                "returnedCount",
+                "offset",
+                "limit",
+                "indexedAssetCount",
+                "indexRevision",
+                "message",
+                "assets",
+                "editorReachable",
+            ],
+            "additionalProperties": False,
+        },
+    }
+
+
+def build_apply_texture_profile_tool_definition() -> dict[str, Any]:
+    return {
+        "name": APPLY_TEXTURE_PROFILE_TOOL_NAME,
+        "title": "Apply Unreal UI texture profile",
+        "description": (
+            "Re-apply a UI texture import profile to every Texture2D under a package path. "
+            "Textures that already match the profile are left untouched."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {
+                "pathPrefix": {
+                    "type": "string",
+                    "description": "Package path prefix such as /Game/UI/Image.",
+                },
+                "importProfile": {
+                    "type": "string",
+                    "enum": ["ui_icon", "ui_image"],
+                    "description": "Texture profile to apply.",
+                },
+                "saveAsset": {
+                    "type": "boolean",
+                    "default": True,
+                    "description": "Save the updated textures to disk before responding.",
+                },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
+            },
+            "required": ["pathPrefix", "importProfile"],
+            "additionalProperties": False,
+        },
+        "outputSchema": {
+            "type": "object",
+            "properties": {
+                "mcpProtocolVersion": {"type": "string"},
+                "saved": {"type": "boolean"},
+                "success": {"type": "boolean"},
+                "matchedCount": {"type": "integer"},
+                "updatedCount": {"type": "integer"},
+                "unchangedCount": {"type": "integer"},
+                "failedCount": {"type": "integer"},
+                "message": {"type": "string"},
+                "pathPrefix": {"type": "string"},
+                "importProfile": {"type": "string"},
+                "updatedAssets": {"type": "array", "items": {"type": "string"}},
+                "failedAssets": {"type": "array", "items": {"type": "string"}},
+                "editorReachable": {"type": "boolean"},
+            },
+            "required": [
+                "mcpProtocolVersion",
+                "saved",
+                "success",
+                "matchedCount",
+                "updatedCount",
+                "unchangedCount",
+                "failedCount",
+                "message",
+                "pathPrefix",
+                "importProfile",
+                "updatedAssets",
+                "failedAssets",
+                "editorReachable",
+            ],
+            "additionalProperties": False,
+        },
+    }
+
+
+def build_pack_icon_atlas_tool_definition() -> dict[str, Any]:
+    return {
+        "name": PACK_ICON_ATLAS_TOOL_NAME,
+        "title": "Pack Unreal icon atlas",
+        "description": (
+            "Pack item icon textures into padded atlas page textures and write each icon's UV rect to a "
+            "UMCPIconAtlasData asset. Optionally point an item tile entry widget's IconAtlas at the result. "
+            "Pages left over from an earlier pack into more pages are deleted after an immediate save and "
+            "reported as stalePageAssetPaths otherwise."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {
+                "atlasAssetPath": {
+                    "type": "string",
+                    "description": "Atlas data asset path such as /Game/UI/Atlas/DA_ItemIconAtlas. Pages are written beside it.",
+                },
+                "textureAssetPaths": {
+                    "type": "array",
+                    "items": {"type": "string"},
+                    "description": "Texture2D assets to pack. Icon ids are the texture asset names.",
+                },
+                "pathPrefix": {
+                    "type": "string",
+                    "description": "Also pack every Texture2D under this package path, for example /Game/UI/Image/Items.",
+                },
+                "entryWidgetAssetPath": {
+                    "type": "string",
+                    "description": "Optional UMCPItemTileEntryWidget Blueprint whose IconAtlas default is set to the atlas.",
+                },
+                "pageSize": {
+                    "type": "integer",
+                    "default": 1024,
+                    "description": "Square page size in pixels, rounded up to a power of two (64-4096).",
+                },
+                "padding": {
+                    "type": "integer",
+                    "default": 2,
+                    "description": "Edge-extruded gutter in pixels around each icon.",
+                },
+                "saveAsset": {
+                    "type": "boolean",
+                    "default": True,
+                    "description": "Save the atlas, its pages and the entry widget before responding.",
+                },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
+            },
+            "required": ["atlasAssetPath"],
+            "additionalProperties": False,
+        },
+        "outputSchema": {
+            "type": "object",
+            "properties": {
+                "mcpProtocolVersion": {"type": "string"},
+                "created": {"type": "boolean"},
+                "saved": {"type": "boolean"},
+                "success": {"type": "boolean"},
+                "iconCount": {"type": "integer"},
+                "pageCount": {"type": "integer"},
+                "pageSize": {"type": "integer"},
+                "padding": {"type": "integer"},
+                "message": {"type": "string"},
+                "assetPath": {"type": "string"},
+                "assetObjectPath": {"type": "string"},
+                "entryWidgetAssetPath": {"type": "string"},
+                "pageAssetPaths": {"type": "array", "items": {"type": "string"}},
+                "skippedTextures": {"type": "array", "items": {"type": "string"}},
+                "deletedPageAssetPaths": {"type": "array", "items": {"type": "string"}},
+                "stalePageAssetPaths": {"type": "array", "items": {"type": "string"}},
+                "editorReachable": {"type": "boolean"},
+            },
+            "required": [
+                "mcpProtocolVersion",
+                "created",
+                "saved",
+                "success",
+                "iconCount",
+                "pageCount",
+                "pageSize",
+                "padding",
+                "message",
+                "assetPath",
+                "assetObjectPath",
+                "entryWidgetAssetPath",
+                "pageAssetPaths",
+                "skippedTextures",
+                "deletedPageAssetPaths",
+                "stalePageAssetPaths",
+                "editorReachable",
+            ],
+            "additionalProperties": False,
+        },
+    }
+
+
+def build_apply_widget_tree_tool_definition() -> dict[str, Any]:
+    widget_node_schema = {
+        "type": "object",
+        "properties": {
+            "name": {"type": "string", "description": "Unique widget name within the Widget Blueprint."},
+            "class": {
+                "type": "string",
+                "description": (
+                    "Widget class: a UMG short name such as CanvasPanel or TextBlock, a /Script path, "
+                    "or a Widget Blueprint asset path for nested user widgets."
+                ),
+            },
+            "isVariable": {"type": "boolean", "description": "Expose the widget as a Blueprint variable."},
+            "properties": {
+                "type": "object",
+                "description": "Widget property values as Unreal import text, numbers or booleans.",
+            },
+            "slot": {
+                "type": "object",
+                "description": "Parent slot property values, for example Padding or Row/Column.",
+            },
+            "children": {
+                "type": "array",
+                "items": {"type": "object"},
+                "description": "Child widget nodes in order, using this same shape.",
+            },
+        },
+        "required": ["name", "class"],
+    }
+
+    return {
+        "name": APPLY_WIDGET_TREE_TOOL_NAME,
+        "title": "Apply Unreal widget tree",
+        "description": (
+            "Declaratively apply a full widget tree spec to a Widget Blueprint. The current tree is diffed against "
+            "the spec and only the needed creates, moves, deletes and property changes are applied, followed by "
+            "a single compile. Widgets not in the spec are removed. An unchanged tree skips compile and save."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {
+                "assetPath": {
+                    "type": "string",
+                    "description": "Widget Blueprint asset path such as /Game/UI/WBP_MainMenu.",
+                },
+                "tree": widget_node_schema,
+                "saveAsset": {
+                    "type": "boolean",
+                    "default": True,
+                    "description": "Save the Widget Blueprint to disk when it changed.",
+                },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
+            },
+            "required": ["assetPath", "tree"],
+            "additionalProperties": False,
+        },
+        "outputSchema": {
+            "type": "object",
+            "properties": {
+                "mcpProtocolVersion": {"type": "string"},
+                "changed": {"type": "boolean"},
+                "saved": {"type": "boolean"},
+                "success": {"type": "boolean"},
+                "widgetCount": {"type": "integer"},
+                "createdCount": {"type": "integer"},
+                "replacedCount": {"type": "integer"},
+                "removedCount": {"type": "integer"},
+                "movedCount": {"type": "integer"},
+                "propertyChangeCount": {"type": "integer"},
+                "message": {"type": "string"},
+                "assetPath": {"type": "string"},
+                "assetObjectPath": {"type": "string"},
+                "changes": {"type": "array", "items": {"type": "string"}},
+                "editorReachable": {"type": "boolean"},
+            },
+            "required": [
+                "mcpProtocolVersion",
+                "changed",
+                "saved",
+                "success",
+                "widgetCount",
+                "createdCount",
+                "replacedCount",
+                "removedCount",
+                "movedCount",
+                "propertyChangeCount",
+                "message",
+                "assetPath",
+                "assetObjectPath",
+                "changes",
+                "editorReachable",
+            ],
+            "additionalProperties": False,
+        },
+    }
+
+
+def build_get_widget_tree_tool_definition() -> dict[str, Any]:
+    return {
+        "name": GET_WIDGET_TREE_TOOL_NAME,
+        "title": "Get Unreal widget tree",
+        "description": (
+            "Return a compact pre-order listing of every widget in a Widget Blueprint: name, class, parent, "
+            "child index, isVariable, and slot and widget properties that differ from their defaults, plus a "
+            "stable content hash. Pass the previous contentHash as lastHash to get an empty notModified reply "
+            "when nothing changed."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {
+                "assetPath": {
+                    "type": "string",
+                    "description": "Widget Blueprint asset path such as /Game/UI/WBP_MainMenu.",
+                },
+                "lastHash": {
+                    "type": "string",
+                    "description": "contentHash from a previous call; a match returns notModified with no widgets.",
+                },
+                "includeProperties": {
+                    "type": "boolean",
+                    "default": True,
+                    "description": (
+                        "Include non-default widget properties. Slot data is always included, and contentHash "
+                        "covers properties either way."
+                    ),
+                },
+            },
+            "required": ["assetPath"],
+            "additionalProperties": False,
+        },
+        "outputSchema": {
+            "type": "object",
+            "properties": {
+                "mcpProtocolVersion": {"type": "string"},
+                "notModified": {"type": "boolean"},
+                "success": {"type": "boolean"},
+                "widgetCount": {"type": "integer"},
+                "message": {"type": "string"},
+                "assetPath": {"type": "string"},
+                "assetObjectPath": {"type": "string"},
+                "rootWidgetName": {"type": "string"},
+                "contentHash": {"type": "string"},
+                "widgets": {"type": "array", "items": {"type": "object"}},
+                "editorReachable": {"type": "boolean"},
+            },
+            "required": [
+                "mcpProtocolVersion",
+                "notModified",
+                "success",
+                "widgetCount",
+                "message",
+                "assetPath",
+                "assetObjectPath",
+                "rootWidgetName",
+                "contentHash",
+                "widgets",
+                "editorReachable",
+            ],
+            "additionalProperties": False,
+        },
+    }
+
+
+def build_set_widget_properties_tool_definition() -> dict[str, Any]:
+    return {
+        "name": SET_WIDGET_PROPERTIES_TOOL_NAME,
+        "title": "Set Unreal widget properties",
+        "description": (
+            "Set any number of reflected widget properties in one Widget Blueprint under a single compile. "
+            "Each entry names a widget, a dotted property path such as Brush.TintColor or Slot.Padding, and a "
+            "value as Unreal import text, number or boolean. Values that already match are skipped."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {
+                "assetPath": {
+                    "type": "string",
+                    "description": "Widget Blueprint asset path such as /Game/UI/WBP_MainMenu.",
+                },
+                "entries": {
+                    "type": "array",
+                    "minItems": 1,
+                    "items": {
+                        "type": "object",
+                        "properties": {
+                            "widget": {"type": "string", "description": "Widget name in the tree."},
+                            "propertyPath": {
+                                "type": "string",
+                                "description": (
+                                    "Dotted property path. Nested struct members are separated by dots; "
+                                    "a leading Slot. addresses the widget's panel slot."
+                                ),
+                            },
+                            "value": {
+                                "type": ["string", "number", "boolean"],
+                                "description": "Unreal import text such as (R=1,G=0,B=0,A=1), or a number or boolean.",
+                            },
+                        },
+                        "required": ["widget", "propertyPath", "value"],
+                        "additionalProperties": False,
+                    },
+                },
+                "saveAsset": {
+                    "type": "boolean",
+                    "default": True,
+                    "description": "Save the Widget Blueprint to disk when it changed.",
+                },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
+            },
+            "required": ["assetPath", "entries"],
+            "additionalProperties": False,
+        },
+        "outputSchema": {
+            "type": "object",
+            "properties": {
+                "mcpProtocolVersion": {"type": "string"},
+                "changed": {"type": "boolean"},
+                "saved": {"type": "boolean"},
+                "success": {"type": "boolean"},
+                "entryCount": {"type": "integer"},
+                "changedCount": {"type": "integer"},
+                "unchangedCount": {"type": "integer"},
+                "message": {"type": "string"},
+                "assetPath": {"type": "string"},
+                "assetObjectPath": {"type": "string"},
+                "changes": {"type": "array", "items": {"type": "string"}},
+                "editorReachable": {"type": "boolean"},
+            },
+            "required": [
+                "mcpProtocolVersion",
+                "changed",
+                "saved",
+                "success",
+                "entryCount",
+                "changedCount",
+                "unchangedCount",
+                "message",
+                "assetPath",
+                "assetObjectPath",
+                "changes",
+                "editorReachable",
+            ],
+            "additionalProperties": False,
+        },
+    }
+
+
+FAN_OUT_WIDGET_EDIT_COMMANDS = (
+    "set_widget_background_blur",
+    "set_widget_corner_radius",
+    "set_widget_panel_color",
+    "set_size_box_height_override",
+    "set_popup_open_elastic_scale",
+    "set_widget_image_texture",
+    "set_widget_properties",
+)
+
+
+def build_fan_out_widget_edit_tool_definition() -> dict[str, Any]:
+    return {
+        "name": FAN_OUT_WIDGET_EDIT_TOOL_NAME,
+        "title": "Fan out Unreal widget edit",
+        "description": (
+            "Apply one mutating widget command to every Widget Blueprint matched by an asset query, for example "
+            "the same panel color on every popup. Matching assets are resolved once from the editor's asset index, "
+            "each asset is edited and compiled, and the changed packages are saved as one batch. "
+            "The result lists the outcome for each asset."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {
+                "command": {
+                    "type": "string",
+                    "enum": list(FAN_OUT_WIDGET_EDIT_COMMANDS),
+                    "description": "Bridge command to run for each matched asset.",
+                },
+                "arguments": {
+                    "type": "object",
+                    "description": (
+                        "Arguments for the command, exactly as its single-asset tool takes them, without assetPath."
+                    ),
+                },
+                "assetQuery": {
+                    "type": "object",
+                    "properties": {
+                        "pathPrefix": {"type": "string", "description": "Package path prefix such as /Game/UI."},
+                        "classPath": {
+                            "type": "string",
+                            "default": "WidgetBlueprint",
+                            "description": "Asset class short name or full class path.",
+                        },
+                        "namePattern": {
+                            "type": "string",
+                            "description": "Asset name wildcard such as WBP_*Popup.",
+                        },
+                        "parentClass": {
+                            "type": "string",
+                            "description": "Blueprint parent class name, /Script path or Blueprint asset path.",
+                        },
+                    },
+                    "additionalProperties": False,
+                    "description": "At least one of pathPrefix, namePattern or parentClass is required.",
+                },
+                "saveAsset": {
+                    "type": "boolean",
+                    "default": True,
+                    "description": "Save the changed Widget Blueprints as one batch.",
+                },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred queues the changed packages for the "
+                        "write-behind save queue."
+                    ),
+                },
+            },
+            "required": ["command", "arguments", "assetQuery"],
+            "additionalProperties": False,
+        },
+        "outputSchema": {
+            "type": "object",
+            "properties": {
+                "mcpProtocolVersion": {"type": "string"},
+                "saved": {"type": "boolean"},
+                "saveQueued": {"type": "boolean"},
+                "success": {"type": "boolean"},
+                "matchedCount": {"type": "integer"},
+                "succeededCount": {"type": "integer"},
+                "failedCount": {"type": "integer"},
+                "savedCount": {"type": "integer"},
+                "message": {"type": "string"},
+                "command": {"type": "string"},
+                "failedPackages": {"type": "array", "items": {"type": "string"}},
+                "assets": {"type": "array", "items": {"type": "object"}},
+                "editorReachable": {"type": "boolean"},
+            },
+            "required": [
+                "mcpProtocolVersion",
+                "saved",
+                "saveQueued",
+                "success",
+                "matchedCount",
+                "succeededCount",
+                "failedCount",
+                "savedCount",
+                "message",
+                "command",
+                "failedPackages",
+                "assets",
+                "editorReachable",
+            ],
+            "additionalProperties": False,
+        },
+    }
+
+
+DRY_RUN_COMMANDS = (
+    "create_blueprint_asset",
+    "create_widget_blueprint",
+    "import_texture_asset",
+    "add_widget_blueprint_child_instance",
+    "set_uniform_grid_slot",
+    "sync_uniform_grid_widget_instances",
+    "add_blueprint_interface",
+    "configure_tile_view",
+    "reorder_widget_child",
+    "remove_widget",
+    "scaffold_widget_blueprint",
+    "set_blueprint_class_property",
+    "set_global_default_game_mode",
+    "bootstrap_project_map",
+    "apply_texture_profile",
+    "pack_icon_atlas",
+    "apply_widget_tree",
+    "set_widget_invalidation_boundary",
+    "flush_saves",
+) + FAN_OUT_WIDGET_EDIT_COMMANDS
+
+
+def build_dry_run_tool_definition() -> dict[str, Any]:
+    return {
+        "name": DRY_RUN_TOOL_NAME,
+        "title": "Dry run Unreal command",
+        "description": (
+            "Validate a mutating bridge command without running it. Arguments are checked against the editor's "
+            "asset index and cached widget tree metadata, so nothing is loaded, modified, compiled or saved. "
+            "Returns the planned changes and every problem found, for checking a multi-step plan before applying it."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {
+                "command": {
+                    "type": "string",
+                    "enum": list(DRY_RUN_COMMANDS),
+                    "description": "Bridge command to validate.",
+                },
+                "arguments": {
+                    "type": "object",
+                    "description": (
+                        "Arguments for the command, exactly as its tool takes them. Fan-out capable widget "
+                        "commands also accept assetQuery in place of assetPath."
+                    ),
+                },
+            },
+            "required": ["command", "arguments"],
+            "additionalProperties": False,
+        },
+        "outputSchema": {
+            "type": "object",
+            "properties": {
+                "mcpProtocolVersion": {"type": "string"},
+                "success": {"type": "boolean"},
+                "widgetTreeChecked": {"type": "boolean"},
+                "message": {"type": "string"},
+                "command": {"type": "string"},
+                "assetObjectPath": {"type": "string"},
+                "plannedChanges": {"type": "array", "items": {"type": "string"}},
+                "problems": {"type": "array", "items": {"type": "string"}},
+                "warnings": {"type": "array", "items": {"type": "string"}},
+                "assets": {"type": "array", "items": {"type": "object"}},
+                "editorReachable": {"type": "boolean"},
+            },
+            "required": [
+                "mcpProtocolVersion",
+                "success",
+                "widgetTreeChecked",
+                "message",
+                "command",
+                "assetObjectPath",
+                "plannedChanges",
+                "problems",
+                "warnings",
+                "assets",
+                "editorReachable",
+            ],
+            "additionalProperties": False,
+        },
+    }
+
+
+def build_working_set_output_schema() -> dict[str, Any]:
+    return {
+        "type": "object",
+        "properties": {
+            "mcpProtocolVersion": {"type": "string"},
+            "success": {"type": "boolean"},
+            "capacity": {"type": "integer"},
+            "count": {"type": "integer"},
+            "pinnedCount": {"type": "integer"},
+            "memoryPressureReleaseCount": {"type": "integer"},
+            "message": {"type": "string"},
+            "assetObjectPath": {"type": "string"},
+            "lastReleaseReason": {"type": "string"},
+            "entries": {
+                "type": "array",
+                "items": {
+                    "type": "object",
+                    "properties": {
+                        "pinned": {"type": "boolean"},
+                        "useCount": {"type": "integer"},
+                        "secondsSinceLastUse": {"type": "number"},
+                        "assetObjectPath": {"type": "string"},
+                    },
+                },
+            },
+            "editorReachable": {"type": "boolean"},
+        },
+        "required": [
+            "mcpProtocolVersion",
+            "success",
+            "capacity",
+            "count",
+            "pinnedCount",
+            "memoryPressureReleaseCount",
+            "message",
+            "assetObjectPath",
+            "lastReleaseReason",
+            "entries",
+            "editorReachable",
+        ],
+        "additionalProperties": False,
+    }
+
+
+def build_get_working_set_tool_definition() -> dict[str, Any]:
+    return {
+        "name": GET_WORKING_SET_TOOL_NAME,
+        "title": "Get Unreal Widget Blueprint working set",
+        "description": (
+            "List the Widget Blueprints the editor keeps loaded between commands, most recently used first. "
+            "Unpinned entries are evicted least recently used first and released under memory pressure."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {},
+            "additionalProperties": False,
+        },
+        "outputSchema": build_working_set_output_schema(),
+    }
+
+
+def build_pin_working_set_asset_tool_definition(tool_name: str) -> dict[str, Any]:
+    pinned = tool_name == PIN_WORKING_SET_ASSET_TOOL_NAME
+    return {
+        "name": tool_name,
+        "title": "Pin Unreal Widget Blueprint in working set" if pinned else "Unpin Unreal Widget Blueprint from working set",
+        "description": (
+            "Load a Widget Blueprint and keep it in the working set until it is unpinned, so repeated edits never "
+            "reload it."
+            if pinned
+            else "Make a pinned Widget Blueprint evictable from the working set again."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {
+                "assetPath": {
+                    "type": "string",
+                    "description": (
+                        "Widget Blueprint asset path such as /Game/UI/Widget/WBP_MCPPopup "
+                        "or /Game/UI/Widget/WBP_MCPPopup.WBP_MCPPopup."
+                    ),
+                },
+            },
+            "required": ["assetPath"],
+            "additionalProperties": False,
+        },
+        "outputSchema": build_working_set_output_schema(),
+    }
+
+
+def build_set_widget_invalidation_boundary_tool_definition() -> dict[str, Any]:
+    return {
+        "name": SET_WIDGET_INVALIDATION_BOUNDARY_TOOL_NAME,
+        "title": "Set Widget Blueprint invalidation boundary",
+        "description": (
+            "Wrap a named widget in an InvalidationBox or RetainerBox, or remove the boundary around it. "
+            "Use it on static subtrees so they are cached instead of re-painted every frame; avoid wrapping "
+            "widgets whose content changes every frame."
+        ),
+        "inputSchema": {
+            "type": "object",
+            "properties": {
+                "assetPath": {
+                    "type": "string",
+                    "description": "Widget Blueprint asset path to update.",
+                },
+                "widgetName": {
+                    "type": "string",
+                    "description": "Name of the widget to wrap or unwrap.",
+                },
+                "boundary": {
+                    "type": "string",
+                    "enum": ["invalidation", "retainer", "none"],
+                    "description": (
+                        "invalidation wraps the widget in a caching InvalidationBox, retainer wraps it in a "
+                        "RetainerBox that redraws only on invalidation, none removes an existing boundary."
+                    ),
+                },
+                "saveAsset": {
+                    "type": "boolean",
+                    "default": True,
+                    "description": "Save the updated Widget Blueprint asset to disk before responding.",
+                },
+                "saveMode": {
+                    "type": "string",
+                    "enum": ["immediate", "deferred"],
+                    "default": "immediate",
+                    "description": (
+                        "immediate saves before responding. deferred marks the package dirty, responds at once "
+                        "and batches the save after a quiet period or on ue_flush_saves."
+                    ),
+                },
+            },
+            "required": ["assetPath", "widgetName", "boundary"],
+            "additionalProperties": False,
+        },
+        "outputSchema": {
+            "type": "object",
+            "properties": {
+                "mcpProtocolVersion": {"type": "string"},
+                "changed": {"type": "boolean"},
+                "saved": {"type": "boolean"},
+                "success": {"type": "boolean"},
+                "message": {"type": "string"},
+                "assetPath": {"type": "string"},
+                "assetObjectPath": {"type": "string"},
+                "packagePath": {"type": "string"},
+                "assetName": {"type": "string"},
+                "widgetName": {"type": "string"},
+                "boundary": {"type": "string"},
+                "boundaryWidgetName": {"type": "string"},
+                "editorReachable": {"type": "boolean"},
+            },
+            "required": [
+                "mcpProtocolVersion",
+                "changed",
+                "saved",
+                "success",
+                "message",
+                "assetPath",
+                "assetObjectPath",
+                "packagePath",
+                "assetName",
+                "widgetName",
+                "boundary",
+                "boundaryWidgetName",
+                "editorReachable",
+            ],
+            "additionalProperties": False,
+        },
+    }
+
+
+def require_initialized(method: str) -> None:
+    if not STATE.initialized:
+        raise JsonRpcError(-32002, f"Server has not received notifications/initialized before {method}.")
+
+
+def require_tool_arguments(tool_name: str, arguments: Any) -> dict[str, Any]:
+    if arguments is None:
+        return {}
+
+    if not isinstance(arguments, dict):
+        raise JsonRpcError(-32602, f"{tool_name} arguments must be an object.")
+
+    return arguments
+
+
+def call_ue_bridge(
+    command: str, arguments: dict[str, Any] | None = None, timeout_seconds: float = UE_TIMEOUT_SECONDS
+) -> dict[str, Any]:
+    request_body = json.dumps(
+        {
+            "command": command,
+            "arguments": arguments or {},
+            "requestId": str(uuid.uuid4()),
+        },
+        ensure_ascii=False,
+        separators=(",", ":"),
+    )
+
+    connection = http.client.HTTPConnection(UE_HOST, UE_PORT, timeout=timeout_seconds)
+    try:
+        connection.request(
+            "POST",
+            "/api/v1/command",
+            body=request_body.encode("utf-8"),
+            headers={
+                "Accept": "application/json",
+                "Content-Type": "application/json",
+            },
+        )
+        response = connection.getresponse()
+        response_bytes = response.read()
+    except OSError as exc:
+        raise UeBridgeError(
+            f"Unable to reach the Unreal Editor bridge at http://{UE_HOST}:{UE_PORT}: {exc}",
+            editor_reachable=False,
+        ) from exc
+    finally:
+        connection.close()
+
+    response_text = response_bytes.decode("utf-8", errors="replace")
+    try:
+        payload = json.loads(response_text) if response_text else {}
+    except json.JSONDecodeError as exc:
+        raise UeBridgeError(
+            f"Unreal Editor bridge returned malformed JSON (HTTP {response.status}): {exc.msg}",
+            editor_reachable=True,
+        ) from exc
+
+    if response.status != 200:
+        error = payload.get("error", {})
+        code = error.get("code", "bridge_error")
+        message = error.get("message", f"Bridge request failed with HTTP {response.status}")
+        raise UeBridgeError(f"{code}: {message}", editor_reachable=True)
+
+    if not payload.get("ok", False):
+        error = payload.get("error", {})
+        code = error.get("code", "bridge_error")
+        message = error.get("message", "Bridge request failed.")
+        raise UeBridgeError(f"{code}: {message}", editor_reachable=True)
+
+    result = payload.get("result")
+    if not isinstance(result, dict):
+        raise UeBridgeError(
+            "Unreal Editor bridge response is missing a result object.",
+            editor_reachable=True,
+        )
+
+    return result
+
+
+def build_version_tool_success() -> dict[str, Any]:
+    bridge_result = call_ue_bridge("get_version_info")
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "engineVersion": str(bridge_result.get("engineVersion", "")),
+        "buildVersion": str(bridge_result.get("buildVersion", "")),
+        "projectName": str(bridge_result.get("projectName", "")),
+        "pluginVersion": str(bridge_result.get("pluginVersion", "")),
+        "editorReachable": True,
+    }
+
+    summary = (
+        f"MCP {structured_content['mcpProtocolVersion']} | "
+        f"UE {structured_content['engineVersion']} | "
+        f"Build {structured_content['buildVersion']} | "
+        f"Project {structured_content['projectName']} | "
+        f"Plugin {structured_content['pluginVersion']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": False,
+    }
+
+
+def build_version_tool_error(message: str, editor_reachable: bool) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "engineVersion": "",
+        "buildVersion": "",
+        "projectName": "",
+        "pluginVersion": "",
+        "editorReachable": editor_reachable,
+    }
+
+    return {
+        "content": [{"type": "text", "text": message}],
+        "structuredContent": structured_content,
+        "isError": True,
+    }
+
+
+def build_live_coding_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    wait_for_completion = arguments.get("waitForCompletion", True)
+    if not isinstance(wait_for_completion, bool):
+        raise JsonRpcError(-32602, "ue_live_coding_compile.waitForCompletion must be a boolean.")
+
+    bridge_result = call_ue_bridge(
+        "live_coding_compile",
+        {"waitForCompletion": wait_for_completion},
+        timeout_seconds=(
+            LIVE_CODING_WAIT_TIMEOUT_SECONDS if wait_for_completion else LIVE_CODING_NOWAIT_TIMEOUT_SECONDS
+        ),
+    )
+
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "liveCodingSupported": bool(bridge_result.get("liveCodingSupported", False)),
+        "waitedForCompletion": bool(bridge_result.get("waitedForCompletion", wait_for_completion)),
+        "success": bool(bridge_result.get("success", False)),
+        "compileResult": str(bridge_result.get("compileResult", "")),
+        "message": str(bridge_result.get("message", "")),
+        "enableError": str(bridge_result.get("enableError", "")),
+        "enabledByDefault": bool(bridge_result.get("enabledByDefault", False)),
+        "canEnableForSession": bool(bridge_result.get("canEnableForSession", False)),
+        "enabledForSession": bool(bridge_result.get("enabledForSession", False)),
+        "hasStarted": bool(bridge_result.get("hasStarted", False)),
+        "isCompiling": bool(bridge_result.get("isCompiling", False)),
+        "editorReachable": True,
+    }
+
+    summary = (
+        f"{structured_content['compileResult']} | "
+        f"success={structured_content['success']} | "
+        f"started={structured_content['hasStarted']} | "
+        f"enabled={structured_content['enabledForSession']} | "
+        f"{structured_content['message']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": not structured_content["success"],
+    }
+
+
+def build_live_coding_tool_error(message: str, editor_reachable: bool, wait_for_completion: bool) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "liveCodingSupported": False,
+        "waitedForCompletion": wait_for_completion,
+        "success": False,
+        "compileResult": "",
+        "message": message,
+        "enableError": "",
+        "enabledByDefault": False,
+        "canEnableForSession": False,
+        "enabledForSession": False,
+        "hasStarted": False,
+        "isCompiling": False,
+        "editorReachable": editor_reachable,
+    }
+
+    return {
+        "content": [{"type": "text", "text": message}],
+        "structuredContent": structured_content,
+        "isError": True,
+    }
+
+
+def build_create_blueprint_asset_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, "ue_create_blueprint_asset.assetPath must be a non-empty string.")
+
+    parent_class_path = arguments.get("parentClassPath")
+    if not isinstance(parent_class_path, str) or not parent_class_path.strip():
+        raise JsonRpcError(-32602, "ue_create_blueprint_asset.parentClassPath must be a non-empty string.")
+
+    save_asset = arguments.get("saveAsset", True)
+    if not isinstance(save_asset, bool):
+        raise JsonRpcError(-32602, "ue_create_blueprint_asset.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_create_blueprint_asset.saveMode must be immediate or deferred.")
+
+    bridge_result = call_ue_bridge(
+        "create_blueprint_asset",
+        {
+            "assetPath": asset_path,
+            "parentClassPath": parent_class_path,
+            "saveAsset": save_asset,
+            "saveMode": save_mode,
+        },
+        timeout_seconds=CREATE_BLUEPRINT_ASSET_TIMEOUT_SECONDS,
+    )
+
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "created": bool(bridge_result.get("created", False)),
+        "saved": bool(bridge_result.get("saved", False)),
+        "success": bool(bridge_result.get("success", False)),
+        "message": str(bridge_result.get("message", "")),
+        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "packagePath": str(bridge_result.get("packagePath", "")),
+        "assetName": str(bridge_result.get("assetName", "")),
+        "parentClassPath": str(bridge_result.get("parentClassPath", "")),
+        "parentClassName": str(bridge_result.get("parentClassName", "")),
+        "generatedClassPath": str(bridge_result.get("generatedClassPath", "")),
+        "editorReachable": True,
+    }
+
+    summary = (
+        f"created={structured_content['created']} | "
+        f"saved={structured_content['saved']} | "
+        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
+        f"parent={structured_content['parentClassPath']} | "
+        f"{structured_content['message']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": not structured_content["success"],
+    }
+
+
+def build_create_blueprint_asset_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, parent_class_path: str
+) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "created": False,
+        "saved": False,
+        "success": False,
+        "message": message,
+        "assetPath": asset_path,
+        "assetObjectPath": "",
+        "packagePath": "",
+        "assetName": "",
+        "parentClassPath": parent_class_path,
+        "parentClassName": "",
+        "generatedClassPath": "",
+        "editorReachable": editor_reachable,
+    }
+
+    return {
+        "content": [{"type": "text", "text": message}],
+        "structuredContent": structured_content,
+        "isError": True,
+    }
+
+
+def build_create_widget_blueprint_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, "ue_create_widget_blueprint.assetPath must be a non-empty string.")
+
+    parent_class_path = arguments.get("parentClassPath")
+    if not isinstance(parent_class_path, str) or not parent_class_path.strip():
+        raise JsonRpcError(-32602, "ue_create_widget_blueprint.parentClassPath must be a non-empty string.")
+
+    scaffold_type = arguments.get("scaffoldType", "")
+    if not isinstance(scaffold_type, str) or scaffold_type not in {
+        "",
+        "popup",
+        "bottom_button_bar",
+        "scroll_uniform_grid_host",
+        "virtualized_uniform_grid_host",
+        "tile_view_host",
+        "tile_view_entry",
+        "item_tile_popup",
+        "item_tile_entry",
+    }:
+        raise JsonRpcError(
+            -32602,
+            (
+                "ue_create_widget_blueprint.scaffoldType must be one of: popup, bottom_button_bar, "
+                "scroll_uniform_grid_host, virtualized_uniform_grid_host, tile_view_host, tile_view_entry, item_tile_popup, item_tile_entry."
+            ),
+        )
+
+    invalidation_boundary = arguments.get("invalidationBoundary", "invalidation")
+    if invalidation_boundary not in ("invalidation", "retainer", "none"):
+        raise JsonRpcError(
+            -32602, "ue_create_widget_blueprint.invalidationBoundary must be invalidation, retainer or none."
+        )
+
+    save_asset = arguments.get("saveAsset", True)
+    if not isinstance(save_asset, bool):
+        raise JsonRpcError(-32602, "ue_create_widget_blueprint.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_create_widget_blueprint.saveMode must be immediate or deferred.")
+
+    bridge_result = call_ue_bridge(
+        "create_widget_blueprint",
+        {
+            "assetPath": asset_path,
+            "parentClassPath": parent_class_path,
+            "scaffoldType": scaffold_type,
+            "invalidationBoundary": invalidation_boundary,
+            "saveAsset": save_asset,
+            "saveMode": save_mode,
+        },
+        timeout_seconds=CREATE_WIDGET_BLUEPRINT_TIMEOUT_SECONDS,
+    )
+
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "created": bool(bridge_result.get("created", False)),
+        "saved": bool(bridge_result.get("saved", False)),
+        "success": bool(bridge_result.get("success", False)),
+        "message": str(bridge_result.get("message", "")),
+        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "packagePath": str(bridge_result.get("packagePath", "")),
+        "assetName": str(bridge_result.get("assetName", "")),
+        "parentClassPath": str(bridge_result.get("parentClassPath", "")),
+        "parentClassName": str(bridge_result.get("parentClassName", "")),
+        "scaffoldType": str(bridge_result.get("scaffoldType", "")),
+        "fromTemplate": bool(bridge_result.get("fromTemplate", False)),
+        "templateCreated": bool(bridge_result.get("templateCreated", False)),
+        "templateAssetPath": str(bridge_result.get("templateAssetPath", "")),
+        "editorReachable": True,
+    }
+
+    summary = (
+        f"created={structured_content['created']} | "
+        f"saved={structured_content['saved']} | "
+        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
+        f"parent={structured_content['parentClassPath']} | "
+        f"{structured_content['message']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": not structured_content["success"],
+    }
+
+
+def build_create_widget_blueprint_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, parent_class_path: str
+) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "created": False,
+        "saved": False,
+        "success": False,
+        "message": message,
+        "assetPath": asset_path,
+        "assetObjectPath": "",
+        "packagePath": "",
+        "assetName": "",
+        "parentClassPath": parent_class_path,
+        "parentClassName": "",
+        "scaffoldType": "",
+        "fromTemplate": False,
+        "templateCreated": False,
+        "templateAssetPath": "",
+        "editorReachable": editor_reachable,
+    }
+
+    return {
+        "content": [{"type": "text", "text": message}],
+        "structuredContent": structured_content,
+        "isError": True,
+    }
+
+
+def build_import_texture_asset_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    source_file_path = arguments.get("sourceFilePath")
+    if not isinstance(source_file_path, str) or not source_file_path.strip():
+        raise JsonRpcError(-32602, "ue_import_texture_asset.sourceFilePath must be a non-empty string.")
+
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, "ue_import_texture_asset.assetPath must be a non-empty string.")
+
+    import_profile = arguments.get("importProfile", "")
+    if not isinstance(import_profile, str):
+        raise JsonRpcError(-32602, "ue_import_texture_asset.importProfile must be a string.")
+
+    replace_existing = arguments.get("replaceExisting", True)
+    if not isinstance(replace_existing, bool):
+        raise JsonRpcError(-32602, "ue_import_texture_asset.replaceExisting must be a boolean.")
+
+    save_asset = arguments.get("saveAsset", True)
+    if not isinstance(save_asset, bool):
+        raise JsonRpcError(-32602, "ue_import_texture_asset.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_import_texture_asset.saveMode must be immediate or deferred.")
+
+    bridge_arguments = {
+        "sourceFilePath": source_file_path,
+        "assetPath": asset_path,
+        "replaceExisting": replace_existing,
+        "saveAsset": save_asset,
+        "saveMode": save_mode,
+    }
+    if import_profile.strip():
+        bridge_arguments["importProfile"] = import_profile
+
+    bridge_result = call_ue_bridge(
+        "import_texture_asset",
+        bridge_arguments,
+        timeout_seconds=IMPORT_TEXTURE_ASSET_TIMEOUT_SECONDS,
+    )
+
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "imported": bool(bridge_result.get("imported", False)),
+        "skippedUnchanged": bool(bridge_result.get("skippedUnchanged", False)),
+        "profileApplied": bool(bridge_result.get("profileApplied", False)),
+        "saved": bool(bridge_result.get("saved", False)),
+        "success": bool(bridge_result.get("success", False)),
+        "message": str(bridge_result.get("message", "")),
+        "sourceFilePath": str(bridge_result.get("sourceFilePath", source_file_path)),
+        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "packagePath": str(bridge_result.get("packagePath", "")),
+        "assetName": str(bridge_result.get("assetName", "")),
+        "importProfile": str(bridge_result.get("importProfile", import_profile)),
+        "editorReachable": True,
+    }
+
+    summary = (
+        f"imported={structured_content['imported']} | "
+        f"skippedUnchanged={structured_content['skippedUnchanged']} | "
+        f"saved={structured_content['saved']} | "
+        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
+        f"{structured_content['message']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": not structured_content["success"],
+    }
+
+
+def build_import_texture_asset_tool_error(
+    message: str, editor_reachable: bool, source_file_path: str, asset_path: str
+) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "imported": False,
+        "skippedUnchanged": False,
+        "profileApplied": False,
+        "saved": False,
+        "success": False,
+        "message": message,
+        "sourceFilePath": source_file_path,
+        "assetPath": asset_path,
+        "assetObjectPath": "",
+        "packagePath": "",
+        "assetName": "",
+        "importProfile": "",
+        "editorReachable": editor_reachable,
+    }
+
+    return {
+        "content": [{"type": "text", "text": message}],
+        "structuredContent": structured_content,
+        "isError": True,
+    }
+
+
+def build_add_widget_blueprint_child_instance_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, "ue_add_widget_blueprint_child_instance.assetPath must be a non-empty string.")
+
+    parent_widget_name = arguments.get("parentWidgetName")
+    if not isinstance(parent_widget_name, str) or not parent_widget_name.strip():
+        raise JsonRpcError(-32602, "ue_add_widget_blueprint_child_instance.parentWidgetName must be a non-empty string.")
+
+    child_widget_asset_path = arguments.get("childWidgetAssetPath")
+    if not isinstance(child_widget_asset_path, str) or not child_widget_asset_path.strip():
+        raise JsonRpcError(
+            -32602, "ue_add_widget_blueprint_child_instance.childWidgetAssetPath must be a non-empty string."
+        )
+
+    child_widget_name = arguments.get("childWidgetName")
+    if not isinstance(child_widget_name, str) or not child_widget_name.strip():
+        raise JsonRpcError(-32602, "ue_add_widget_blueprint_child_instance.childWidgetName must be a non-empty string.")
+
+    desired_index = arguments.get("desiredIndex")
+    if not isinstance(desired_index, int):
+        raise JsonRpcError(-32602, "ue_add_widget_blueprint_child_instance.desiredIndex must be an integer.")
+
+    save_asset = arguments.get("saveAsset", True)
+    if not isinstance(save_asset, bool):
+        raise JsonRpcError(-32602, "ue_add_widget_blueprint_child_instance.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_add_widget_blueprint_child_instance.saveMode must be immediate or deferred.")
+
+    bridge_result = call_ue_bridge(
+        "add_widget_blueprint_child_instance",
+        {
+            "assetPath": asset_path,
+            "parentWidgetName": parent_widget_name,
+            "childWidgetAssetPath": child_widget_asset_path,
+            "childWidgetName": child_widget_name,
+            "desiredIndex": desired_index,
+            "saveAsset": save_asset,
+            "saveMode": save_mode,
+        },
+        timeout_seconds=ADD_WIDGET_BLUEPRINT_CHILD_INSTANCE_TIMEOUT_SECONDS,
+    )
+
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "created": bool(bridge_result.get("created", False)),
+        "replaced": bool(bridge_result.get("replaced", False)),
+        "saved": bool(bridge_result.get("saved", False)),
+        "success": bool(bridge_result.get("success", False)),
+        "message": str(bridge_result.get("message", "")),
+        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "packagePath": str(bridge_result.get("packagePath", "")),
+        "assetName": str(bridge_result.get("assetName", "")),
+        "parentWidgetName": str(bridge_result.get("parentWidgetName", parent_widget_name)),
+        "childWidgetName": str(bridge_result.get("childWidgetName", child_widget_name)),
+        "childWidgetAssetPath": str(bridge_result.get("childWidgetAssetPath", child_widget_asset_path)),
+        "childWidgetClassPath": str(bridge_result.get("childWidgetClassPath", "")),
+        "childWidgetClassName": str(bridge_result.get("childWidgetClassName", "")),
+        "finalIndex": int(bridge_result.get("finalIndex", -1)),
+        "editorReachable": True,
+    }
+
+    summary = (
+        f"created={structured_content['created']} | "
+        f"replaced={structured_content['replaced']} | "
+        f"parent={structured_content['parentWidgetName']} | "
+        f"child={structured_content['childWidgetName']} | "
+        f"index={structured_content['finalIndex']} | "
+        f"{structured_content['message']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": not structured_content["success"],
+    }
+
+
+def build_add_widget_blueprint_child_instance_tool_error(
+    message: str,
+    editor_reachable: bool,
+    asset_path: str,
+    parent_widget_name: str,
+    child_widget_asset_path: str,
+    child_widget_name: str,
+) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "created": False,
+        "replaced": False,
+        "saved": False,
+        "success": False,
+        "message": message,
+        "assetPath": asset_path,
+        "assetObjectPath": "",
+        "packagePath": "",
+        "assetName": "",
+        "parentWidgetName": parent_widget_name,
+        "childWidgetName": child_widget_name,
+        "childWidgetAssetPath": child_widget_asset_path,
+        "childWidgetClassPath": "",
+        "childWidgetClassName": "",
+        "finalIndex": -1,
+        "editorReachable": editor_reachable,
+    }
+
+    return {
+        "content": [{"type": "text", "text": message}],
+        "structuredContent": structured_content,
+        "isError": True,
+    }
+
+
+def build_set_uniform_grid_slot_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, "ue_set_uniform_grid_slot.assetPath must be a non-empty string.")
+
+    widget_name = arguments.get("widgetName")
+    if not isinstance(widget_name, str) or not widget_name.strip():
+        raise JsonRpcError(-32602, "ue_set_uniform_grid_slot.widgetName must be a non-empty string.")
+
+    row = arguments.get("row")
+    if not isinstance(row, int):
+        raise JsonRpcError(-32602, "ue_set_uniform_grid_slot.row must be an integer.")
+
+    column = arguments.get("column")
+    if not isinstance(column, int):
+        raise JsonRpcError(-32602, "ue_set_uniform_grid_slot.column must be an integer.")
+
+    save_asset = arguments.get("saveAsset", True)
+    if not isinstance(save_asset, bool):
+        raise JsonRpcError(-32602, "ue_set_uniform_grid_slot.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_set_uniform_grid_slot.saveMode must be immediate or deferred.")
+
+    bridge_result = call_ue_bridge(
+        "set_uniform_grid_slot",
+        {
+            "assetPath": asset_path,
+            "widgetName": widget_name,
+            "row": row,
+            "column": column,
+            "saveAsset": save_asset,
+            "saveMode": save_mode,
+        },
+        timeout_seconds=SET_UNIFORM_GRID_SLOT_TIMEOUT_SECONDS,
+    )
+
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "saved": bool(bridge_result.get("saved", False)),
+        "success": bool(bridge_result.get("success", False)),
+        "message": str(bridge_result.get("message", "")),
+        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "packagePath": str(bridge_result.get("packagePath", "")),
+        "assetName": str(bridge_result.get("assetName", "")),
+        "widgetName": str(bridge_result.get("widgetName", widget_name)),
+        "parentWidgetName": str(bridge_result.get("parentWidgetName", "")),
+        "row": int(bridge_result.get("row", row)),
+        "column": int(bridge_result.get("column", column)),
+        "editorReachable": True,
+    }
+
+    summary = (
+        f"widget={structured_content['widgetName']} | "
+        f"row={structured_content['row']} | "
+        f"column={structured_content['column']} | "
+        f"{structured_content['message']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": not structured_content["success"],
+    }
+
+
+def build_set_uniform_grid_slot_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, widget_name: str, row: int, column: int
+) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "saved": False,
+        "success": False,
+        "message": message,
+        "assetPath": asset_path,
+        "assetObjectPath": "",
+        "packagePath": "",
+        "assetName": "",
+        "widgetName": widget_name,
+        "parentWidgetName": "",
+        "row": row,
+        "column": column,
+        "editorReachable": editor_reachable,
+    }
+
+    return {
+        "content": [{"type": "text", "text": message}],
+        "structuredContent": structured_content,
+        "isError": True,
+    }
+
+
+def build_sync_uniform_grid_widget_instances_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.assetPath must be a non-empty string.")
+
+    grid_widget_name = arguments.get("gridWidgetName")
+    if not isinstance(grid_widget_name, str) or not grid_widget_name.strip():
+        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.gridWidgetName must be a non-empty string.")
+
+    entry_widget_asset_path = arguments.get("entryWidgetAssetPath")
+    if not isinstance(entry_widget_asset_path, str) or not entry_widget_asset_path.strip():
+        raise JsonRpcError(
+            -32602, "ue_sync_uniform_grid_widget_instances.entryWidgetAssetPath must be a non-empty string."
+        )
+
+    count = arguments.get("count")
+    if not isinstance(count, int):
+        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.count must be an integer.")
+
+    column_count = arguments.get("columnCount")
+    if not isinstance(column_count, int):
+        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.columnCount must be an integer.")
+
+    instance_name_prefix = arguments.get("instanceNamePrefix")
+    if not isinstance(instance_name_prefix, str) or not instance_name_prefix.strip():
+        raise JsonRpcError(
+            -32602, "ue_sync_uniform_grid_widget_instances.instanceNamePrefix must be a non-empty string."
+        )
+
+    trim_managed_children = arguments.get("trimManagedChildren", True)
+    if not isinstance(trim_managed_children, bool):
+        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.trimManagedChildren must be a boolean.")
+
+    save_asset = arguments.get("saveAsset", True)
+    if not isinstance(save_asset, bool):
+        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.saveMode must be immediate or deferred.")
+
+    bridge_result = call_ue_bridge(
+        "sync_uniform_grid_widget_instances",
+        {
+            "assetPath": asset_path,
+            "gridWidgetName": grid_widget_name,
+            "entryWidgetAssetPath": entry_widget_asset_path,
+            "count": count,
+            "columnCount": column_count,
+            "instanceNamePrefix": instance_name_prefix,
+            "trimManagedChildren": trim_managed_children,
+            "saveAsset": save_asset,
+            "saveMode": save_mode,
+        },
+        timeout_seconds=SYNC_UNIFORM_GRID_WIDGET_INSTANCES_TIMEOUT_SECONDS,
+    )
+
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "saved": bool(bridge_result.get("saved", False)),
+        "success": bool(bridge_result.get("success", False)),
+        "trimManagedChildren": bool(bridge_result.get("trimManagedChildren", trim_managed_children)),
+        "message": str(bridge_result.get("message", "")),
+        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "packagePath": str(bridge_result.get("packagePath", "")),
+        "assetName": str(bridge_result.get("assetName", "")),
+        "gridWidgetName": str(bridge_result.get("gridWidgetName", grid_widget_name)),
+        "entryWidgetAssetPath": str(bridge_result.get("entryWidgetAssetPath", entry_widget_asset_path)),
+        "entryWidgetClassPath": str(bridge_result.get("entryWidgetClassPath", "")),
+        "entryWidgetClassName": str(bridge_result.get("entryWidgetClassName", "")),
+        "instanceNamePrefix": str(bridge_result.get("instanceNamePrefix", instance_name_prefix)),
+        "count": int(bridge_result.get("count", count)),
+        "columnCount": int(bridge_result.get("columnCount", column_count)),
+        "createdCount": int(bridge_result.get("createdCount", 0)),
+        "reusedCount": int(bridge_result.get("reusedCount", 0)),
+        "removedCount": int(bridge_result.get("removedCount", 0)),
+        "managedCount": int(bridge_result.get("managedCount", 0)),
+        "editorReachable": True,
+    }
+
+    summary = (
+        f"grid={structured_content['gridWidgetName']} | "
+        f"managed={structured_content['managedCount']} | "
+        f"created={structured_content['createdCount']} | "
+        f"reused={structured_content['reusedCount']} | "
+        f"removed={structured_content['removedCount']} | "
+        f"{structured_content['message']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": not structured_content["success"],
+    }
+
+
+def build_sync_uniform_grid_widget_instances_tool_error(
+    message: str,
+    editor_reachable: bool,
+    asset_path: str,
+    grid_widget_name: str,
+    entry_widget_asset_path: str,
+    instance_name_prefix: str,
+) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "saved": False,
+        "success": False,
+        "trimManagedChildren": True,
+        "message": message,
+        "assetPath": asset_path,
+        "assetObjectPath": "",
+        "packagePath": "",
+        "assetName": "",
+        "gridWidgetName": grid_widget_name,
+        "entryWidgetAssetPath": entry_widget_asset_path,
+        "entryWidgetClassPath": "",
+        "entryWidgetClassName": "",
+        "instanceNamePrefix": instance_name_prefix,
+        "count": 0,
+        "columnCount": 0,
+        "createdCount": 0,
+        "reusedCount": 0,
+        "removedCount": 0,
+        "managedCount": 0,
+        "editorReachable": editor_reachable,
+    }
+
+    return {
+        "content": [{"type": "text", "text": message}],
+        "structuredContent": structured_content,
+        "isError": True,
+    }
+
+
+def build_add_blueprint_interface_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, "ue_add_blueprint_interface.assetPath must be a non-empty string.")
+
+    interface_class_path = arguments.get("interfaceClassPath")
+    if not isinstance(interface_class_path, str) or not interface_class_path.strip():
+        raise JsonRpcError(-32602, "ue_add_blueprint_interface.interfaceClassPath must be a non-empty string.")
+
+    save_asset = arguments.get("saveAsset", True)
+    if not isinstance(save_asset, bool):
+        raise JsonRpcError(-32602, "ue_add_blueprint_interface.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_add_blueprint_interface.saveMode must be immediate or deferred.")
+
+    bridge_result = call_ue_bridge(
+        "add_blueprint_interface",
+        {
+            "assetPath": asset_path,
+            "interfaceClassPath": interface_class_path,
+            "saveAsset": save_asset,
+            "saveMode": save_mode,
+        },
+        timeout_seconds=ADD_BLUEPRINT_INTERFACE_TIMEOUT_SECONDS,
+    )
+
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "added": bool(bridge_result.get("added", False)),
+        "saved": bool(bridge_result.get("saved", False)),
+        "success": bool(bridge_result.get("success", False)),
+        "message": str(bridge_result.get("message", "")),
+        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "packagePath": str(bridge_result.get("packagePath", "")),
+        "assetName": str(bridge_result.get("assetName", "")),
+        "interfaceClassPath": str(bridge_result.get("interfaceClassPath", interface_class_path)),
+        "interfaceClassName": str(bridge_result.get("interfaceClassName", "")),
+        "editorReachable": True,
+    }
+
+    summary = (
+        f"added={structured_content['added']} | "
+        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
+        f"interface={structured_content['interfaceClassPath']} | "
+        f"{structured_content['message']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": not structured_content["success"],
+    }
+
+
+def build_add_blueprint_interface_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, interface_class_path: str
+) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "added": False,
+        "saved": False,
+        "success": False,
+        "message": message,
+        "assetPath": asset_path,
+        "assetObjectPath": "",
+        "packagePath": "",
+        "assetName": "",
+        "interfaceClassPath": interface_class_path,
+        "interfaceClassName": "",
+        "editorReachable": editor_reachable,
+    }
+
+    return {
+        "content": [{"type": "text", "text": message}],
+        "structuredContent": structured_content,
+        "isError": True,
+    }
+
+
+def build_configure_tile_view_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, "ue_configure_tile_view.assetPath must be a non-empty string.")
+
+    widget_name = arguments.get("widgetName")
+    if not isinstance(widget_name, str) or not widget_name.strip():
+        raise JsonRpcError(-32602, "ue_configure_tile_view.widgetName must be a non-empty string.")
+
+    entry_widget_asset_path = arguments.get("entryWidgetAssetPath")
+    if not isinstance(entry_widget_asset_path, str) or not entry_widget_asset_path.strip():
+        raise JsonRpcError(-32602, "ue_configure_tile_view.entryWidgetAssetPath must be a non-empty string.")
+
+    entry_width = arguments.get("entryWidth")
+    if not isinstance(entry_width, (int, float)):
+        raise JsonRpcError(-32602, "ue_configure_tile_view.entryWidth must be a number.")
+
+    entry_height = arguments.get("entryHeight")
+    if not isinstance(entry_height, (int, float)):
+        raise JsonRpcError(-32602, "ue_configure_tile_view.entryHeight must be a number.")
+
+    orientation = arguments.get("orientation", "Vertical")
+    if not isinstance(orientation, str) or not orientation.strip():
+        raise JsonRpcError(-32602, "ue_configure_tile_view.orientation must be a non-empty string when provided.")
+
+    save_asset = arguments.get("saveAsset", True)
+    if not isinstance(save_asset, bool):
+        raise JsonRpcError(-32602, "ue_configure_tile_view.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_configure_tile_view.saveMode must be immediate or deferred.")
+
+    bridge_result = call_ue_bridge(
+        "configure_tile_view",
+        {
+            "assetPath": asset_path,
+            "widgetName": widget_name,
+            "entryWidgetAssetPath": entry_widget_asset_path,
+            "entryWidth": float(entry_width),
+            "entryHeight": float(entry_height),
+            "orientation": orientation,
+            "saveAsset": save_asset,
+            "saveMode": save_mode,
+        },
+        timeout_seconds=CONFIGURE_TILE_VIEW_TIMEOUT_SECONDS,
+    )
+
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "saved": bool(bridge_result.get("saved", False)),
+        "success": bool(bridge_result.get("success", False)),
+        "message": str(bridge_result.get("message", "")),
+        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "packagePath": str(bridge_result.get("packagePath", "")),
+        "assetName": str(bridge_result.get("assetName", "")),
+        "widgetName": str(bridge_result.get("widgetName", widget_name)),
+        "entryWidgetAssetPath": str(bridge_result.get("entryWidgetAssetPath", entry_widget_asset_path)),
+        "entryWidgetClassPath": str(bridge_result.get("entryWidgetClassPath", "")),
+        "entryWidgetClassName": str(bridge_result.get("entryWidgetClassName", "")),
+        "orientation": str(bridge_result.get("orientation", orientation)),
+        "entryWidth": float(bridge_result.get("entryWidth", entry_width)),
+        "entryHeight": float(bridge_result.get("entryHeight", entry_height)),
+        "editorReachable": True,
+    }
+
+    summary = (
+        f"widget={structured_content['widgetName']} | "
+        f"entry={structured_content['entryWidgetClassPath']} | "
+        f"orientation={structured_content['orientation']} | "
+        f"size={structured_content['entryWidth']:.1f}x{structured_content['entryHeight']:.1f} | "
+        f"{structured_content['message']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": not structured_content["success"],
+    }
+
+
+def build_configure_tile_view_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, widget_name: str, entry_widget_asset_path: str
+) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "saved": False,
+        "success": False,
+        "message": message,
+        "assetPath": asset_path,
+        "assetObjectPath": "",
+        "packagePath": "",
+        "assetName": "",
+        "widgetName": widget_name,
+        "entryWidgetAssetPath": entry_widget_asset_path,
+        "entryWidgetClassPath": "",
+        "entryWidgetClassName": "",
+        "orientation": "",
+        "entryWidth": 0.0,
+        "entryHeight": 0.0,
+        "editorReachable": editor_reachable,
+    }
+
+    return {
+        "content": [{"type": "text", "text": message}],
+        "structuredContent": structured_content,
+        "isError": True,
+    }
+
+
+def build_reorder_widget_child_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, "ue_reorder_widget_child.assetPath must be a non-empty string.")
+
+    widget_name = arguments.get("widgetName")
+    if not isinstance(widget_name, str) or not widget_name.strip():
+        raise JsonRpcError(-32602, "ue_reorder_widget_child.widgetName must be a non-empty string.")
+
+    desired_index = arguments.get("desiredIndex")
+    if not isinstance(desired_index, int):
+        raise JsonRpcError(-32602, "ue_reorder_widget_child.desiredIndex must be an integer.")
+
+    save_asset = arguments.get("saveAsset", True)
+    if not isinstance(save_asset, bool):
+        raise JsonRpcError(-32602, "ue_reorder_widget_child.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_reorder_widget_child.saveMode must be immediate or deferred.")
+
+    bridge_result = call_ue_bridge(
+        "reorder_widget_child",
+        {
+            "assetPath": asset_path,
+            "widgetName": widget_name,
+            "desiredIndex": desired_index,
+            "saveAsset": save_asset,
+            "saveMode": save_mode,
+        },
+        timeout_seconds=REORDER_WIDGET_CHILD_TIMEOUT_SECONDS,
+    )
+
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "reordered": bool(bridge_result.get("reordered", False)),
+        "saved": bool(bridge_result.get("saved", False)),
+        "success": bool(bridge_result.get("success", False)),
+        "message": str(bridge_result.get("message", "")),
+        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "packagePath": str(bridge_result.get("packagePath", "")),
+        "assetName": str(bridge_result.get("assetName", "")),
+        "widgetName": str(bridge_result.get("widgetName", widget_name)),
+        "parentWidgetName": str(bridge_result.get("parentWidgetName", "")),
+        "requestedIndex": int(bridge_result.get("requestedIndex", desired_index)),
+        "finalIndex": int(bridge_result.get("finalIndex", -1)),
+        "editorReachable": True,
+    }
+
+    summary = (
+        f"reordered={structured_content['reordered']} | "
+        f"saved={structured_content['saved']} | "
+        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
+        f"widget={structured_content['widgetName']} | "
+        f"parent={structured_content['parentWidgetName']} | "
+        f"index={structured_content['finalIndex']} | "
+        f"{structured_content['message']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": not structured_content["success"],
+    }
+
+
+def build_reorder_widget_child_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, widget_name: str, desired_index: int
+) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "reordered": False,
+        "saved": False,
+        "success": False,
+        "message": message,
+        "assetPath": asset_path,
+        "assetObjectPath": "",
+        "packagePath": "",
+        "assetName": "",
+        "widgetName": widget_name,
+        "parentWidgetName": "",
+        "requestedIndex": desired_index,
+        "finalIndex": -1,
+        "editorReachable": editor_reachable,
     }
 
     return {
@@ -1778,40 +4055,54 @@ def build_version_tool_error(message: str, editor_reachable: bool) -> dict[str,
     }
 
 
-def build_live_coding_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
-    wait_for_completion = arguments.get("waitForCompletion", True)
-    if not isinstance(wait_for_completion, bool):
-        raise JsonRpcError(-32602, "ue_live_coding_compile.waitForCompletion must be a boolean.")
+def build_remove_widget_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, "ue_remove_widget.assetPath must be a non-empty string.")
+
+    widget_name = arguments.get("widgetName")
+    if not isinstance(widget_name, str) or not widget_name.strip():
+        raise JsonRpcError(-32602, "ue_remove_widget.widgetName must be a non-empty string.")
+
+    save_asset = arguments.get("saveAsset", True)
+    if not isinstance(save_asset, bool):
+        raise JsonRpcError(-32602, "ue_remove_widget.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_remove_widget.saveMode must be immediate or deferred.")
 
     bridge_result = call_ue_bridge(
-        "live_coding_compile",
-        {"waitForCompletion": wait_for_completion},
-        timeout_seconds=(
-            LIVE_CODING_WAIT_TIMEOUT_SECONDS if wait_for_completion else LIVE_CODING_NOWAIT_TIMEOUT_SECONDS
-        ),
+        "remove_widget",
+        {
+            "assetPath": asset_path,
+            "widgetName": widget_name,
+            "saveAsset": save_asset,
+            "saveMode": save_mode,
+        },
+        timeout_seconds=REMOVE_WIDGET_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "liveCodingSupported": bool(bridge_result.get("liveCodingSupported", False)),
-        "waitedForCompletion": bool(bridge_result.get("waitedForCompletion", wait_for_completion)),
+        "removed": bool(bridge_result.get("removed", False)),
+        "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
-        "compileResult": str(bridge_result.get("compileResult", "")),
         "message": str(bridge_result.get("message", "")),
-        "enableError": str(bridge_result.get("enableError", "")),
-        "enabledByDefault": bool(bridge_result.get("enabledByDefault", False)),
-        "canEnableForSession": bool(bridge_result.get("canEnableForSession", False)),
-        "enabledForSession": bool(bridge_result.get("enabledForSession", False)),
-        "hasStarted": bool(bridge_result.get("hasStarted", False)),
-        "isCompiling": bool(bridge_result.get("isCompiling", False)),
+        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "packagePath": str(bridge_result.get("packagePath", "")),
+        "assetName": str(bridge_result.get("assetName", "")),
+        "widgetName": str(bridge_result.get("widgetName", widget_name)),
+        "parentWidgetName": str(bridge_result.get("parentWidgetName", "")),
         "editorReachable": True,
     }
 
     summary = (
-        f"{structured_content['compileResult']} | "
-        f"success={structured_content['success']} | "
-        f"started={structured_content['hasStarted']} | "
-        f"enabled={structured_content['enabledForSession']} | "
+        f"removed={structured_content['removed']} | "
+        f"saved={structured_content['saved']} | "
+        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
+        f"widget={structured_content['widgetName']} | "
         f"{structured_content['message']}"
     )
 
@@ -1822,20 +4113,21 @@ def build_live_coding_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
     }
 
 
-def build_live_coding_tool_error(message: str, editor_reachable: bool, wait_for_completion: bool) -> dict[str, Any]:
+def build_remove_widget_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, widget_name: str
+) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "liveCodingSupported": False,
-        "waitedForCompletion": wait_for_completion,
+        "removed": False,
+        "saved": False,
         "success": False,
-        "compileResult": "",
         "message": message,
-        "enableError": "",
-        "enabledByDefault": False,
-        "canEnableForSession": False,
-        "enabledForSession": False,
-        "hasStarted": False,
-        "isCompiling": False,
+        "assetPath": asset_path,
+        "assetObjectPath": "",
+        "packagePath": "",
+        "assetName": "",
+        "widgetName": widget_name,
+        "parentWidgetName": "",
         "editorReachable": editor_reachable,
     }
 
@@ -1846,32 +4138,152 @@ def build_live_coding_tool_error(message: str, editor_reachable: bool, wait_for_
     }
 
 
-def build_create_blueprint_asset_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+def build_set_widget_background_blur_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
     asset_path = arguments.get("assetPath")
     if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_create_blueprint_asset.assetPath must be a non-empty string.")
+        raise JsonRpcError(-32602, "ue_set_widget_background_blur.assetPath must be a non-empty string.")
 
-    parent_class_path = arguments.get("parentClassPath")
-    if not isinstance(parent_class_path, str) or not parent_class_path.strip():
-        raise JsonRpcError(-32602, "ue_create_blueprint_asset.parentClassPath must be a non-empty string.")
+    widget_name = arguments.get("widgetName")
+    if not isinstance(widget_name, str) or not widget_name.strip():
+        raise JsonRpcError(-32602, "ue_set_widget_background_blur.widgetName must be a non-empty string.")
+
+    blur_strength = arguments.get("blurStrength", 30.0)
+    if not isinstance(blur_strength, (int, float)):
+        raise JsonRpcError(-32602, "ue_set_widget_background_blur.blurStrength must be a number.")
+
+    blur_radius = arguments.get("blurRadius")
+    if blur_radius is not None and not isinstance(blur_radius, int):
+        raise JsonRpcError(-32602, "ue_set_widget_background_blur.blurRadius must be an integer.")
+
+    apply_alpha_to_blur = arguments.get("applyAlphaToBlur", False)
+    if not isinstance(apply_alpha_to_blur, bool):
+        raise JsonRpcError(-32602, "ue_set_widget_background_blur.applyAlphaToBlur must be a boolean.")
 
     save_asset = arguments.get("saveAsset", True)
     if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_create_blueprint_asset.saveAsset must be a boolean.")
+        raise JsonRpcError(-32602, "ue_set_widget_background_blur.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_set_widget_background_blur.saveMode must be immediate or deferred.")
+
+    bridge_arguments: dict[str, Any] = {
+        "assetPath": asset_path,
+        "widgetName": widget_name,
+        "blurStrength": float(blur_strength),
+        "applyAlphaToBlur": apply_alpha_to_blur,
+        "saveAsset": save_asset,
+        "saveMode": save_mode,
+    }
+    if blur_radius is not None:
+        bridge_arguments["blurRadius"] = blur_radius
 
     bridge_result = call_ue_bridge(
-        "create_blueprint_asset",
+        "set_widget_background_blur",
+        bridge_arguments,
+        timeout_seconds=SET_WIDGET_BACKGROUND_BLUR_TIMEOUT_SECONDS,
+    )
+
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "converted": bool(bridge_result.get("converted", False)),
+        "saved": bool(bridge_result.get("saved", False)),
+        "success": bool(bridge_result.get("success", False)),
+        "message": str(bridge_result.get("message", "")),
+        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "packagePath": str(bridge_result.get("packagePath", "")),
+        "assetName": str(bridge_result.get("assetName", "")),
+        "widgetName": str(bridge_result.get("widgetName", widget_name)),
+        "widgetClassName": str(bridge_result.get("widgetClassName", "")),
+        "blurStrength": float(bridge_result.get("blurStrength", float(blur_strength))),
+        "blurRadius": int(bridge_result.get("blurRadius", int(blur_radius) if blur_radius is not None else 0)),
+        "applyAlphaToBlur": bool(bridge_result.get("applyAlphaToBlur", apply_alpha_to_blur)),
+        "overrideAutoRadiusCalculation": bool(bridge_result.get("overrideAutoRadiusCalculation", blur_radius is not None)),
+        "editorReachable": True,
+    }
+
+    summary = (
+        f"converted={structured_content['converted']} | "
+        f"saved={structured_content['saved']} | "
+        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
+        f"widget={structured_content['widgetName']} | "
+        f"class={structured_content['widgetClassName']} | "
+        f"blur={structured_content['blurStrength']} | "
+        f"{structured_content['message']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": not structured_content["success"],
+    }
+
+
+def build_set_widget_background_blur_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, widget_name: str
+) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "converted": False,
+        "saved": False,
+        "success": False,
+        "message": message,
+        "assetPath": asset_path,
+        "assetObjectPath": "",
+        "packagePath": "",
+        "assetName": "",
+        "widgetName": widget_name,
+        "widgetClassName": "",
+        "blurStrength": 0.0,
+        "blurRadius": 0,
+        "applyAlphaToBlur": False,
+        "overrideAutoRadiusCalculation": False,
+        "editorReachable": editor_reachable,
+    }
+
+    return {
+        "content": [{"type": "text", "text": message}],
+        "structuredContent": structured_content,
+        "isError": True,
+    }
+
+
+def build_set_widget_corner_radius_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, "ue_set_widget_corner_radius.assetPath must be a non-empty string.")
+
+    widget_name = arguments.get("widgetName")
+    if not isinstance(widget_name, str) or not widget_name.strip():
+        raise JsonRpcError(-32602, "ue_set_widget_corner_radius.widgetName must be a non-empty string.")
+
+    radius = arguments.get("radius")
+    if not isinstance(radius, (int, float)):
+        raise JsonRpcError(-32602, "ue_set_widget_corner_radius.radius must be a number.")
+
+    save_asset = arguments.get("saveAsset", True)
+    if not isinstance(save_asset, bool):
+        raise JsonRpcError(-32602, "ue_set_widget_corner_radius.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_set_widget_corner_radius.saveMode must be immediate or deferred.")
+
+    bridge_result = call_ue_bridge(
+        "set_widget_corner_radius",
         {
             "assetPath": asset_path,
-            "parentClassPath": parent_class_path,
+            "widgetName": widget_name,
+            "radius": float(radius),
             "saveAsset": save_asset,
+            "saveMode": save_mode,
         },
-        timeout_seconds=CREATE_BLUEPRINT_ASSET_TIMEOUT_SECONDS,
+        timeout_seconds=SET_WIDGET_CORNER_RADIUS_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "created": bool(bridge_result.get("created", False)),
         "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
         "message": str(bridge_result.get("message", "")),
@@ -1879,17 +4291,17 @@ def build_create_blueprint_asset_tool_success(arguments: dict[str, Any]) -> dict
         "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
         "packagePath": str(bridge_result.get("packagePath", "")),
         "assetName": str(bridge_result.get("assetName", "")),
-        "parentClassPath": str(bridge_result.get("parentClassPath", "")),
-        "parentClassName": str(bridge_result.get("parentClassName", "")),
-        "generatedClassPath": str(bridge_result.get("generatedClassPath", "")),
+        "widgetName": str(bridge_result.get("widgetName", widget_name)),
+        "widgetClassName": str(bridge_result.get("widgetClassName", "")),
+        "radius": float(bridge_result.get("radius", float(radius))),
         "editorReachable": True,
     }
 
     summary = (
-        f"created={structured_content['created']} | "
         f"saved={structured_content['saved']} | "
         f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"parent={structured_content['parentClassPath']} | "
+        f"widget={structured_content['widgetName']} | "
+        f"radius={structured_content['radius']} | "
         f"{structured_content['message']}"
     )
 
@@ -1900,12 +4312,11 @@ def build_create_blueprint_asset_tool_success(arguments: dict[str, Any]) -> dict
     }
 
 
-def build_create_blueprint_asset_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, parent_class_path: str
+def build_set_widget_corner_radius_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, widget_name: str
 ) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "created": False,
         "saved": False,
         "success": False,
         "message": message,
@@ -1913,9 +4324,9 @@ def build_create_blueprint_asset_tool_error(
         "assetObjectPath": "",
         "packagePath": "",
         "assetName": "",
-        "parentClassPath": parent_class_path,
-        "parentClassName": "",
-        "generatedClassPath": "",
+        "widgetName": widget_name,
+        "widgetClassName": "",
+        "radius": 0.0,
         "editorReachable": editor_reachable,
     }
 
@@ -1926,32 +4337,53 @@ def build_create_blueprint_asset_tool_error(
     }
 
 
-def build_create_widget_blueprint_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+def build_set_widget_panel_color_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
     asset_path = arguments.get("assetPath")
     if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_create_widget_blueprint.assetPath must be a non-empty string.")
+        raise JsonRpcError(-32602, "ue_set_widget_panel_color.assetPath must be a non-empty string.")
 
-    parent_class_path = arguments.get("parentClassPath")
-    if not isinstance(parent_class_path, str) or not parent_class_path.strip():
-        raise JsonRpcError(-32602, "ue_create_widget_blueprint.parentClassPath must be a non-empty string.")
+    widget_name = arguments.get("widgetName")
+    if not isinstance(widget_name, str) or not widget_name.strip():
+        raise JsonRpcError(-32602, "ue_set_widget_panel_color.widgetName must be a non-empty string.")
+
+    red = arguments.get("red")
+    green = arguments.get("green")
+    blue = arguments.get("blue")
+    alpha = arguments.get("alpha")
+    if not isinstance(red, (int, float)):
+        raise JsonRpcError(-32602, "ue_set_widget_panel_color.red must be a number.")
+    if not isinstance(green, (int, float)):
+        raise JsonRpcError(-32602, "ue_set_widget_panel_color.green must be a number.")
+    if not isinstance(blue, (int, float)):
+        raise JsonRpcError(-32602, "ue_set_widget_panel_color.blue must be a number.")
+    if not isinstance(alpha, (int, float)):
+        raise JsonRpcError(-32602, "ue_set_widget_panel_color.alpha must be a number.")
 
     save_asset = arguments.get("saveAsset", True)
     if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_create_widget_blueprint.saveAsset must be a boolean.")
+        raise JsonRpcError(-32602, "ue_set_widget_panel_color.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_set_widget_panel_color.saveMode must be immediate or deferred.")
 
     bridge_result = call_ue_bridge(
-        "create_widget_blueprint",
+        "set_widget_panel_color",
         {
             "assetPath": asset_path,
-            "parentClassPath": parent_class_path,
+            "widgetName": widget_name,
+            "red": float(red),
+            "green": float(green),
+            "blue": float(blue),
+            "alpha": float(alpha),
             "saveAsset": save_asset,
+            "saveMode": save_mode,
         },
-        timeout_seconds=CREATE_WIDGET_BLUEPRINT_TIMEOUT_SECONDS,
+        timeout_seconds=SET_WIDGET_PANEL_COLOR_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "created": bool(bridge_result.get("created", False)),
         "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
         "message": str(bridge_result.get("message", "")),
@@ -1959,16 +4391,22 @@ def build_create_widget_blueprint_tool_success(arguments: dict[str, Any]) -> dic
         "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
         "packagePath": str(bridge_result.get("packagePath", "")),
         "assetName": str(bridge_result.get("assetName", "")),
-        "parentClassPath": str(bridge_result.get("parentClassPath", "")),
-        "parentClassName": str(bridge_result.get("parentClassName", "")),
+        "widgetName": str(bridge_result.get("widgetName", widget_name)),
+        "widgetClassName": str(bridge_result.get("widgetClassName", "")),
+        "red": float(bridge_result.get("red", 0.0)),
+        "green": float(bridge_result.get("green", 0.0)),
+        "blue": float(bridge_result.get("blue", 0.0)),
+        "alpha": float(bridge_result.get("alpha", 0.0)),
         "editorReachable": True,
     }
 
     summary = (
-        f"created={structured_content['created']} | "
         f"saved={structured_content['saved']} | "
         f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"parent={structured_content['parentClassPath']} | "
+        f"widget={structured_content['widgetName']} | "
+        f"class={structured_content['widgetClassName']} | "
+        f"rgba=({structured_content['red']:.3f}, {structured_content['green']:.3f}, "
+        f"{structured_content['blue']:.3f}, {structured_content['alpha']:.3f}) | "
         f"{structured_content['message']}"
     )
 
@@ -1979,12 +4417,11 @@ def build_create_widget_blueprint_tool_success(arguments: dict[str, Any]) -> dic
     }
 
 
-def build_create_widget_blueprint_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, parent_class_path: str
+def build_set_widget_panel_color_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, widget_name: str
 ) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "created": False,
         "saved": False,
         "success": False,
         "message": message,
@@ -1992,8 +4429,12 @@ def build_create_widget_blueprint_tool_error(
         "assetObjectPath": "",
         "packagePath": "",
         "assetName": "",
-        "parentClassPath": parent_class_path,
-        "parentClassName": "",
+        "widgetName": widget_name,
+        "widgetClassName": "",
+        "red": 0.0,
+        "green": 0.0,
+        "blue": 0.0,
+        "alpha": 0.0,
         "editorReachable": editor_reachable,
     }
 
@@ -2004,52 +4445,58 @@ def build_create_widget_blueprint_tool_error(
     }
 
 
-def build_import_texture_asset_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
-    source_file_path = arguments.get("sourceFilePath")
-    if not isinstance(source_file_path, str) or not source_file_path.strip():
-        raise JsonRpcError(-32602, "ue_import_texture_asset.sourceFilePath must be a non-empty string.")
-
+def build_set_size_box_height_override_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
     asset_path = arguments.get("assetPath")
     if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_import_texture_asset.assetPath must be a non-empty string.")
+        raise JsonRpcError(-32602, "ue_set_size_box_height_override.assetPath must be a non-empty string.")
 
-    replace_existing = arguments.get("replaceExisting", True)
-    if not isinstance(replace_existing, bool):
-        raise JsonRpcError(-32602, "ue_import_texture_asset.replaceExisting must be a boolean.")
+    widget_name = arguments.get("widgetName")
+    if not isinstance(widget_name, str) or not widget_name.strip():
+        raise JsonRpcError(-32602, "ue_set_size_box_height_override.widgetName must be a non-empty string.")
+
+    height_override = arguments.get("heightOverride")
+    if not isinstance(height_override, (int, float)):
+        raise JsonRpcError(-32602, "ue_set_size_box_height_override.heightOverride must be a number.")
 
     save_asset = arguments.get("saveAsset", True)
     if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_import_texture_asset.saveAsset must be a boolean.")
+        raise JsonRpcError(-32602, "ue_set_size_box_height_override.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_set_size_box_height_override.saveMode must be immediate or deferred.")
 
     bridge_result = call_ue_bridge(
-        "import_texture_asset",
+        "set_size_box_height_override",
         {
-            "sourceFilePath": source_file_path,
             "assetPath": asset_path,
-            "replaceExisting": replace_existing,
+            "widgetName": widget_name,
+            "heightOverride": float(height_override),
             "saveAsset": save_asset,
+            "saveMode": save_mode,
         },
-        timeout_seconds=IMPORT_TEXTURE_ASSET_TIMEOUT_SECONDS,
+        timeout_seconds=SET_SIZE_BOX_HEIGHT_OVERRIDE_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "imported": bool(bridge_result.get("imported", False)),
         "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
         "message": str(bridge_result.get("message", "")),
-        "sourceFilePath": str(bridge_result.get("sourceFilePath", source_file_path)),
         "assetPath": str(bridge_result.get("assetPath", "")),
         "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
         "packagePath": str(bridge_result.get("packagePath", "")),
         "assetName": str(bridge_result.get("assetName", "")),
+        "widgetName": str(bridge_result.get("widgetName", widget_name)),
+        "heightOverride": float(bridge_result.get("heightOverride", 0.0)),
         "editorReachable": True,
     }
 
     summary = (
-        f"imported={structured_content['imported']} | "
         f"saved={structured_content['saved']} | "
         f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
+        f"widget={structured_content['widgetName']} | "
+        f"height={structured_content['heightOverride']:.3f} | "
         f"{structured_content['message']}"
     )
 
@@ -2060,20 +4507,20 @@ def build_import_texture_asset_tool_success(arguments: dict[str, Any]) -> dict[s
     }
 
 
-def build_import_texture_asset_tool_error(
-    message: str, editor_reachable: bool, source_file_path: str, asset_path: str
+def build_set_size_box_height_override_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, widget_name: str
 ) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "imported": False,
         "saved": False,
         "success": False,
         "message": message,
-        "sourceFilePath": source_file_path,
         "assetPath": asset_path,
         "assetObjectPath": "",
         "packagePath": "",
         "assetName": "",
+        "widgetName": widget_name,
+        "heightOverride": 0.0,
         "editorReachable": editor_reachable,
     }
 
@@ -2084,72 +4531,92 @@ def build_import_texture_asset_tool_error(
     }
 
 
-def build_add_widget_blueprint_child_instance_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+def build_set_popup_open_elastic_scale_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
     asset_path = arguments.get("assetPath")
     if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_add_widget_blueprint_child_instance.assetPath must be a non-empty string.")
+        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.assetPath must be a non-empty string.")
 
-    parent_widget_name = arguments.get("parentWidgetName")
-    if not isinstance(parent_widget_name, str) or not parent_widget_name.strip():
-        raise JsonRpcError(-32602, "ue_add_widget_blueprint_child_instance.parentWidgetName must be a non-empty string.")
+    enabled = arguments.get("enabled", True)
+    if not isinstance(enabled, bool):
+        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.enabled must be a boolean.")
 
-    child_widget_asset_path = arguments.get("childWidgetAssetPath")
-    if not isinstance(child_widget_asset_path, str) or not child_widget_asset_path.strip():
-        raise JsonRpcError(
-            -32602, "ue_add_widget_blueprint_child_instance.childWidgetAssetPath must be a non-empty string."
-        )
+    widget_name = arguments.get("widgetName", "PopupCard")
+    if not isinstance(widget_name, str) or not widget_name.strip():
+        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.widgetName must be a non-empty string.")
 
-    child_widget_name = arguments.get("childWidgetName")
-    if not isinstance(child_widget_name, str) or not child_widget_name.strip():
-        raise JsonRpcError(-32602, "ue_add_widget_blueprint_child_instance.childWidgetName must be a non-empty string.")
+    duration = arguments.get("duration", 0.45)
+    if not isinstance(duration, (int, float)):
+        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.duration must be a number.")
 
-    desired_index = arguments.get("desiredIndex")
-    if not isinstance(desired_index, int):
-        raise JsonRpcError(-32602, "ue_add_widget_blueprint_child_instance.desiredIndex must be an integer.")
+    start_scale = arguments.get("startScale", 0.82)
+    if not isinstance(start_scale, (int, float)):
+        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.startScale must be a number.")
+
+    oscillation_count = arguments.get("oscillationCount", 2.0)
+    if not isinstance(oscillation_count, (int, float)):
+        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.oscillationCount must be a number.")
+
+    pivot_x = arguments.get("pivotX", 0.5)
+    if not isinstance(pivot_x, (int, float)):
+        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.pivotX must be a number.")
+
+    pivot_y = arguments.get("pivotY", 0.5)
+    if not isinstance(pivot_y, (int, float)):
+        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.pivotY must be a number.")
 
     save_asset = arguments.get("saveAsset", True)
     if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_add_widget_blueprint_child_instance.saveAsset must be a boolean.")
+        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.saveMode must be immediate or deferred.")
 
     bridge_result = call_ue_bridge(
-        "add_widget_blueprint_child_instance",
+        "set_popup_open_elastic_scale",
         {
             "assetPath": asset_path,
-            "parentWidgetName": parent_widget_name,
-            "childWidgetAssetPath": child_widget_asset_path,
-            "childWidgetName": child_widget_name,
-            "desiredIndex": desired_index,
+            "enabled": enabled,
+            "widgetName": widget_name,
+            "duration": float(duration),
+            "startScale": float(start_scale),
+            "oscillationCount": float(oscillation_count),
+            "pivotX": float(pivot_x),
+            "pivotY": float(pivot_y),
             "saveAsset": save_asset,
+            "saveMode": save_mode,
         },
-        timeout_seconds=ADD_WIDGET_BLUEPRINT_CHILD_INSTANCE_TIMEOUT_SECONDS,
+        timeout_seconds=SET_POPUP_OPEN_ELASTIC_SCALE_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "created": bool(bridge_result.get("created", False)),
-        "replaced": bool(bridge_result.get("replaced", False)),
         "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
+        "enabled": bool(bridge_result.get("enabled", enabled)),
         "message": str(bridge_result.get("message", "")),
         "assetPath": str(bridge_result.get("assetPath", "")),
         "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
         "packagePath": str(bridge_result.get("packagePath", "")),
         "assetName": str(bridge_result.get("assetName", "")),
-        "parentWidgetName": str(bridge_result.get("parentWidgetName", parent_widget_name)),
-        "childWidgetName": str(bridge_result.get("childWidgetName", child_widget_name)),
-        "childWidgetAssetPath": str(bridge_result.get("childWidgetAssetPath", child_widget_asset_path)),
-        "childWidgetClassPath": str(bridge_result.get("childWidgetClassPath", "")),
-        "childWidgetClassName": str(bridge_result.get("childWidgetClassName", "")),
-        "finalIndex": int(bridge_result.get("finalIndex", -1)),
+        "widgetName": str(bridge_result.get("widgetName", widget_name)),
+        "duration": float(bridge_result.get("duration", 0.0)),
+        "startScale": float(bridge_result.get("startScale", 0.0)),
+        "oscillationCount": float(bridge_result.get("oscillationCount", 0.0)),
+        "pivotX": float(bridge_result.get("pivotX", 0.0)),
+        "pivotY": float(bridge_result.get("pivotY", 0.0)),
         "editorReachable": True,
     }
 
     summary = (
-        f"created={structured_content['created']} | "
-        f"replaced={structured_content['replaced']} | "
-        f"parent={structured_content['parentWidgetName']} | "
-        f"child={structured_content['childWidgetName']} | "
-        f"index={structured_content['finalIndex']} | "
+        f"saved={structured_content['saved']} | "
+        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
+        f"enabled={structured_content['enabled']} | "
+        f"widget={structured_content['widgetName']} | "
+        f"duration={structured_content['duration']:.3f}s | "
+        f"startScale={structured_content['startScale']:.3f} | "
+        f"oscillations={structured_content['oscillationCount']:.3f} | "
+        f"pivot=({structured_content['pivotX']:.3f}, {structured_content['pivotY']:.3f}) | "
         f"{structured_content['message']}"
     )
 
@@ -2160,31 +4627,25 @@ def build_add_widget_blueprint_child_instance_tool_success(arguments: dict[str,
     }
 
 
-def build_add_widget_blueprint_child_instance_tool_error(
-    message: str,
-    editor_reachable: bool,
-    asset_path: str,
-    parent_widget_name: str,
-    child_widget_asset_path: str,
-    child_widget_name: str,
+def build_set_popup_open_elastic_scale_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, widget_name: str
 ) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "created": False,
-        "replaced": False,
         "saved": False,
         "success": False,
+        "enabled": False,
         "message": message,
         "assetPath": asset_path,
         "assetObjectPath": "",
         "packagePath": "",
         "assetName": "",
-        "parentWidgetName": parent_widget_name,
-        "childWidgetName": child_widget_name,
-        "childWidgetAssetPath": child_widget_asset_path,
-        "childWidgetClassPath": "",
-        "childWidgetClassName": "",
-        "finalIndex": -1,
+        "widgetName": widget_name,
+        "duration": 0.0,
+        "startScale": 0.0,
+        "oscillationCount": 0.0,
+        "pivotX": 0.0,
+        "pivotY": 0.0,
         "editorReachable": editor_reachable,
     }
 
@@ -2195,37 +4656,64 @@ def build_add_widget_blueprint_child_instance_tool_error(
     }
 
 
-def build_set_uniform_grid_slot_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+def build_scaffold_widget_blueprint_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
     asset_path = arguments.get("assetPath")
     if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_set_uniform_grid_slot.assetPath must be a non-empty string.")
+        raise JsonRpcError(-32602, "ue_scaffold_widget_blueprint.assetPath must be a non-empty string.")
 
-    widget_name = arguments.get("widgetName")
-    if not isinstance(widget_name, str) or not widget_name.strip():
-        raise JsonRpcError(-32602, "ue_set_uniform_grid_slot.widgetName must be a non-empty string.")
+    scaffold_type = arguments.get("scaffoldType")
+    if not isinstance(scaffold_type, str) or scaffold_type not in {
+        "popup",
+        "bottom_button_bar",
+        "scroll_uniform_grid_host",
+        "virtualized_uniform_grid_host",
+        "tile_view_host",
+        "tile_view_entry",
+        "item_tile_popup",
+        "item_tile_entry",
+    }:
+        raise JsonRpcError(
+            -32602,
+            (
+                "ue_scaffold_widget_blueprint.scaffoldType must be one of: popup, bottom_button_bar, "
+                "scroll_uniform_grid_host, virtualized_uniform_grid_host, tile_view_host, tile_view_entry, item_tile_popup, item_tile_entry."
+            ),
+        )
 
-    row = arguments.get("row")
-    if not isinstance(row, int):
-        raise JsonRpcError(-32602, "ue_set_uniform_grid_slot.row must be an integer.")
+    use_template = arguments.get("useTemplate", False)
+    if not isinstance(use_template, bool):
+        raise JsonRpcError(-32602, "ue_scaffold_widget_blueprint.useTemplate must be a boolean.")
 
-    column = arguments.get("column")
-    if not isinstance(column, int):
-        raise JsonRpcError(-32602, "ue_set_uniform_grid_slot.column must be an integer.")
+    parent_class_path = arguments.get("parentClassPath", "")
+    if not isinstance(parent_class_path, str):
+        raise JsonRpcError(-32602, "ue_scaffold_widget_blueprint.parentClassPath must be a string.")
+
+    invalidation_boundary = arguments.get("invalidationBoundary", "invalidation")
+    if invalidation_boundary not in ("invalidation", "retainer", "none"):
+        raise JsonRpcError(
+            -32602, "ue_scaffold_widget_blueprint.invalidationBoundary must be invalidation, retainer or none."
+        )
 
     save_asset = arguments.get("saveAsset", True)
     if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_set_uniform_grid_slot.saveAsset must be a boolean.")
+        raise JsonRpcError(-32602, "ue_scaffold_widget_blueprint.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_scaffold_widget_blueprint.saveMode must be immediate or deferred.")
 
     bridge_result = call_ue_bridge(
-        "set_uniform_grid_slot",
+        "scaffold_widget_blueprint",
         {
-            "assetPath": asset_path,
-            "widgetName": widget_name,
-            "row": row,
-            "column": column,
+            "assetPath": asset_path,
+            "scaffoldType": scaffold_type,
+            "useTemplate": use_template,
+            "parentClassPath": parent_class_path.strip(),
+            "invalidationBoundary": invalidation_boundary,
             "saveAsset": save_asset,
+            "saveMode": save_mode,
         },
-        timeout_seconds=SET_UNIFORM_GRID_SLOT_TIMEOUT_SECONDS,
+        timeout_seconds=SCAFFOLD_WIDGET_BLUEPRINT_TIMEOUT_SECONDS,
     )
 
     structured_content = {
@@ -2237,17 +4725,24 @@ def build_set_uniform_grid_slot_tool_success(arguments: dict[str, Any]) -> dict[
         "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
         "packagePath": str(bridge_result.get("packagePath", "")),
         "assetName": str(bridge_result.get("assetName", "")),
-        "widgetName": str(bridge_result.get("widgetName", widget_name)),
-        "parentWidgetName": str(bridge_result.get("parentWidgetName", "")),
-        "row": int(bridge_result.get("row", row)),
-        "column": int(bridge_result.get("column", column)),
+        "scaffoldType": str(bridge_result.get("scaffoldType", scaffold_type)),
+        "fromTemplate": bool(bridge_result.get("fromTemplate", False)),
+        "templateCreated": bool(bridge_result.get("templateCreated", False)),
+        "parentRetargeted": bool(bridge_result.get("parentRetargeted", False)),
+        "templateAssetPath": str(bridge_result.get("templateAssetPath", "")),
+        "parentClassPath": str(bridge_result.get("parentClassPath", "")),
+        "invalidationBoundary": str(bridge_result.get("invalidationBoundary", invalidation_boundary)),
+        "boundaryWidgetNames": [
+            str(value) for value in bridge_result.get("boundaryWidgetNames", []) if isinstance(value, str)
+        ],
         "editorReachable": True,
     }
 
     summary = (
-        f"widget={structured_content['widgetName']} | "
-        f"row={structured_content['row']} | "
-        f"column={structured_content['column']} | "
+        f"saved={structured_content['saved']} | "
+        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
+        f"scaffold={structured_content['scaffoldType']} | "
+        f"boundary={structured_content['invalidationBoundary']} | "
         f"{structured_content['message']}"
     )
 
@@ -2258,8 +4753,8 @@ def build_set_uniform_grid_slot_tool_success(arguments: dict[str, Any]) -> dict[
     }
 
 
-def build_set_uniform_grid_slot_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, widget_name: str, row: int, column: int
+def build_scaffold_widget_blueprint_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, scaffold_type: str
 ) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
@@ -2270,10 +4765,14 @@ def build_set_uniform_grid_slot_tool_error(
         "assetObjectPath": "",
         "packagePath": "",
         "assetName": "",
-        "widgetName": widget_name,
-        "parentWidgetName": "",
-        "row": row,
-        "column": column,
+        "scaffoldType": scaffold_type,
+        "fromTemplate": False,
+        "templateCreated": False,
+        "parentRetargeted": False,
+        "templateAssetPath": "",
+        "parentClassPath": "",
+        "invalidationBoundary": "",
+        "boundaryWidgetNames": [],
         "editorReachable": editor_reachable,
     }
 
@@ -2284,88 +4783,59 @@ def build_set_uniform_grid_slot_tool_error(
     }
 
 
-def build_sync_uniform_grid_widget_instances_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+def build_set_blueprint_class_property_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
     asset_path = arguments.get("assetPath")
     if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.assetPath must be a non-empty string.")
-
-    grid_widget_name = arguments.get("gridWidgetName")
-    if not isinstance(grid_widget_name, str) or not grid_widget_name.strip():
-        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.gridWidgetName must be a non-empty string.")
-
-    entry_widget_asset_path = arguments.get("entryWidgetAssetPath")
-    if not isinstance(entry_widget_asset_path, str) or not entry_widget_asset_path.strip():
-        raise JsonRpcError(
-            -32602, "ue_sync_uniform_grid_widget_instances.entryWidgetAssetPath must be a non-empty string."
-        )
-
-    count = arguments.get("count")
-    if not isinstance(count, int):
-        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.count must be an integer.")
-
-    column_count = arguments.get("columnCount")
-    if not isinstance(column_count, int):
-        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.columnCount must be an integer.")
+        raise JsonRpcError(-32602, "ue_set_blueprint_class_property.assetPath must be a non-empty string.")
 
-    instance_name_prefix = arguments.get("instanceNamePrefix")
-    if not isinstance(instance_name_prefix, str) or not instance_name_prefix.strip():
-        raise JsonRpcError(
-            -32602, "ue_sync_uniform_grid_widget_instances.instanceNamePrefix must be a non-empty string."
-        )
+    property_name = arguments.get("propertyName")
+    if not isinstance(property_name, str) or not property_name.strip():
+        raise JsonRpcError(-32602, "ue_set_blueprint_class_property.propertyName must be a non-empty string.")
 
-    trim_managed_children = arguments.get("trimManagedChildren", True)
-    if not isinstance(trim_managed_children, bool):
-        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.trimManagedChildren must be a boolean.")
+    value_class_path = arguments.get("valueClassPath")
+    if not isinstance(value_class_path, str) or not value_class_path.strip():
+        raise JsonRpcError(-32602, "ue_set_blueprint_class_property.valueClassPath must be a non-empty string.")
 
     save_asset = arguments.get("saveAsset", True)
     if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_sync_uniform_grid_widget_instances.saveAsset must be a boolean.")
+        raise JsonRpcError(-32602, "ue_set_blueprint_class_property.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_set_blueprint_class_property.saveMode must be immediate or deferred.")
 
     bridge_result = call_ue_bridge(
-        "sync_uniform_grid_widget_instances",
+        "set_blueprint_class_property",
         {
             "assetPath": asset_path,
-            "gridWidgetName": grid_widget_name,
-            "entryWidgetAssetPath": entry_widget_asset_path,
-            "count": count,
-            "columnCount": column_count,
-            "instanceNamePrefix": instance_name_prefix,
-            "trimManagedChildren": trim_managed_children,
+            "propertyName": property_name,
+            "valueClassPath": value_class_path,
             "saveAsset": save_asset,
+            "saveMode": save_mode,
         },
-        timeout_seconds=SYNC_UNIFORM_GRID_WIDGET_INSTANCES_TIMEOUT_SECONDS,
+        timeout_seconds=SET_BLUEPRINT_CLASS_PROPERTY_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
         "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
-        "trimManagedChildren": bool(bridge_result.get("trimManagedChildren", trim_managed_children)),
         "message": str(bridge_result.get("message", "")),
         "assetPath": str(bridge_result.get("assetPath", "")),
         "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
         "packagePath": str(bridge_result.get("packagePath", "")),
         "assetName": str(bridge_result.get("assetName", "")),
-        "gridWidgetName": str(bridge_result.get("gridWidgetName", grid_widget_name)),
-        "entryWidgetAssetPath": str(bridge_result.get("entryWidgetAssetPath", entry_widget_asset_path)),
-        "entryWidgetClassPath": str(bridge_result.get("entryWidgetClassPath", "")),
-        "entryWidgetClassName": str(bridge_result.get("entryWidgetClassName", "")),
-        "instanceNamePrefix": str(bridge_result.get("instanceNamePrefix", instance_name_prefix)),
-        "count": int(bridge_result.get("count", count)),
-        "columnCount": int(bridge_result.get("columnCount", column_count)),
-        "createdCount": int(bridge_result.get("createdCount", 0)),
-        "reusedCount": int(bridge_result.get("reusedCount", 0)),
-        "removedCount": int(bridge_result.get("removedCount", 0)),
-        "managedCount": int(bridge_result.get("managedCount", 0)),
+        "propertyName": str(bridge_result.get("propertyName", property_name)),
+        "valueClassPath": str(bridge_result.get("valueClassPath", "")),
+        "valueClassName": str(bridge_result.get("valueClassName", "")),
         "editorReachable": True,
     }
 
     summary = (
-        f"grid={structured_content['gridWidgetName']} | "
-        f"managed={structured_content['managedCount']} | "
-        f"created={structured_content['createdCount']} | "
-        f"reused={structured_content['reusedCount']} | "
-        f"removed={structured_content['removedCount']} | "
+        f"saved={structured_content['saved']} | "
+        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
+        f"property={structured_content['propertyName']} | "
+        f"value={structured_content['valueClassPath']} | "
         f"{structured_content['message']}"
     )
 
@@ -2376,35 +4846,21 @@ def build_sync_uniform_grid_widget_instances_tool_success(arguments: dict[str, A
     }
 
 
-def build_sync_uniform_grid_widget_instances_tool_error(
-    message: str,
-    editor_reachable: bool,
-    asset_path: str,
-    grid_widget_name: str,
-    entry_widget_asset_path: str,
-    instance_name_prefix: str,
+def build_set_blueprint_class_property_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, property_name: str, value_class_path: str
 ) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
         "saved": False,
         "success": False,
-        "trimManagedChildren": True,
         "message": message,
         "assetPath": asset_path,
         "assetObjectPath": "",
         "packagePath": "",
         "assetName": "",
-        "gridWidgetName": grid_widget_name,
-        "entryWidgetAssetPath": entry_widget_asset_path,
-        "entryWidgetClassPath": "",
-        "entryWidgetClassName": "",
-        "instanceNamePrefix": instance_name_prefix,
-        "count": 0,
-        "columnCount": 0,
-        "createdCount": 0,
-        "reusedCount": 0,
-        "removedCount": 0,
-        "managedCount": 0,
+        "propertyName": property_name,
+        "valueClassPath": value_class_path,
+        "valueClassName": "",
         "editorReachable": editor_reachable,
     }
 
@@ -2415,32 +4871,46 @@ def build_sync_uniform_grid_widget_instances_tool_error(
     }
 
 
-def build_add_blueprint_interface_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+def build_set_widget_image_texture_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
     asset_path = arguments.get("assetPath")
     if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_add_blueprint_interface.assetPath must be a non-empty string.")
+        raise JsonRpcError(-32602, "ue_set_widget_image_texture.assetPath must be a non-empty string.")
 
-    interface_class_path = arguments.get("interfaceClassPath")
-    if not isinstance(interface_class_path, str) or not interface_class_path.strip():
-        raise JsonRpcError(-32602, "ue_add_blueprint_interface.interfaceClassPath must be a non-empty string.")
+    widget_name = arguments.get("widgetName")
+    if not isinstance(widget_name, str) or not widget_name.strip():
+        raise JsonRpcError(-32602, "ue_set_widget_image_texture.widgetName must be a non-empty string.")
+
+    texture_asset_path = arguments.get("textureAssetPath")
+    if not isinstance(texture_asset_path, str) or not texture_asset_path.strip():
+        raise JsonRpcError(-32602, "ue_set_widget_image_texture.textureAssetPath must be a non-empty string.")
+
+    match_texture_size = arguments.get("matchTextureSize", False)
+    if not isinstance(match_texture_size, bool):
+        raise JsonRpcError(-32602, "ue_set_widget_image_texture.matchTextureSize must be a boolean.")
 
     save_asset = arguments.get("saveAsset", True)
     if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_add_blueprint_interface.saveAsset must be a boolean.")
+        raise JsonRpcError(-32602, "ue_set_widget_image_texture.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_set_widget_image_texture.saveMode must be immediate or deferred.")
 
     bridge_result = call_ue_bridge(
-        "add_blueprint_interface",
+        "set_widget_image_texture",
         {
             "assetPath": asset_path,
-            "interfaceClassPath": interface_class_path,
+            "widgetName": widget_name,
+            "textureAssetPath": texture_asset_path,
+            "matchTextureSize": match_texture_size,
             "saveAsset": save_asset,
+            "saveMode": save_mode,
         },
-        timeout_seconds=ADD_BLUEPRINT_INTERFACE_TIMEOUT_SECONDS,
+        timeout_seconds=SET_WIDGET_IMAGE_TEXTURE_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "added": bool(bridge_result.get("added", False)),
         "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
         "message": str(bridge_result.get("message", "")),
@@ -2448,15 +4918,16 @@ def build_add_blueprint_interface_tool_success(arguments: dict[str, Any]) -> dic
         "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
         "packagePath": str(bridge_result.get("packagePath", "")),
         "assetName": str(bridge_result.get("assetName", "")),
-        "interfaceClassPath": str(bridge_result.get("interfaceClassPath", interface_class_path)),
-        "interfaceClassName": str(bridge_result.get("interfaceClassName", "")),
+        "widgetName": str(bridge_result.get("widgetName", widget_name)),
+        "textureAssetPath": str(bridge_result.get("textureAssetPath", "")),
         "editorReachable": True,
     }
 
     summary = (
-        f"added={structured_content['added']} | "
+        f"saved={structured_content['saved']} | "
         f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"interface={structured_content['interfaceClassPath']} | "
+        f"widget={structured_content['widgetName']} | "
+        f"texture={structured_content['textureAssetPath']} | "
         f"{structured_content['message']}"
     )
 
@@ -2467,12 +4938,11 @@ def build_add_blueprint_interface_tool_success(arguments: dict[str, Any]) -> dic
     }
 
 
-def build_add_blueprint_interface_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, interface_class_path: str
+def build_set_widget_image_texture_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, widget_name: str, texture_asset_path: str
 ) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "added": False,
         "saved": False,
         "success": False,
         "message": message,
@@ -2480,8 +4950,8 @@ def build_add_blueprint_interface_tool_error(
         "assetObjectPath": "",
         "packagePath": "",
         "assetName": "",
-        "interfaceClassPath": interface_class_path,
-        "interfaceClassName": "",
+        "widgetName": widget_name,
+        "textureAssetPath": texture_asset_path,
         "editorReachable": editor_reachable,
     }
 
@@ -2492,47 +4962,22 @@ def build_add_blueprint_interface_tool_error(
     }
 
 
-def build_configure_tile_view_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
-    asset_path = arguments.get("assetPath")
-    if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_configure_tile_view.assetPath must be a non-empty string.")
-
-    widget_name = arguments.get("widgetName")
-    if not isinstance(widget_name, str) or not widget_name.strip():
-        raise JsonRpcError(-32602, "ue_configure_tile_view.widgetName must be a non-empty string.")
-
-    entry_widget_asset_path = arguments.get("entryWidgetAssetPath")
-    if not isinstance(entry_widget_asset_path, str) or not entry_widget_asset_path.strip():
-        raise JsonRpcError(-32602, "ue_configure_tile_view.entryWidgetAssetPath must be a non-empty string.")
-
-    entry_width = arguments.get("entryWidth")
-    if not isinstance(entry_width, (int, float)):
-        raise JsonRpcError(-32602, "ue_configure_tile_view.entryWidth must be a number.")
-
-    entry_height = arguments.get("entryHeight")
-    if not isinstance(entry_height, (int, float)):
-        raise JsonRpcError(-32602, "ue_configure_tile_view.entryHeight must be a number.")
-
-    orientation = arguments.get("orientation", "Vertical")
-    if not isinstance(orientation, str) or not orientation.strip():
-        raise JsonRpcError(-32602, "ue_configure_tile_view.orientation must be a non-empty string when provided.")
+def build_set_global_default_game_mode_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    game_mode_class_path = arguments.get("gameModeClassPath")
+    if not isinstance(game_mode_class_path, str) or not game_mode_class_path.strip():
+        raise JsonRpcError(-32602, "ue_set_global_default_game_mode.gameModeClassPath must be a non-empty string.")
 
-    save_asset = arguments.get("saveAsset", True)
-    if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_configure_tile_view.saveAsset must be a boolean.")
+    save_config = arguments.get("saveConfig", True)
+    if not isinstance(save_config, bool):
+        raise JsonRpcError(-32602, "ue_set_global_default_game_mode.saveConfig must be a boolean.")
 
     bridge_result = call_ue_bridge(
-        "configure_tile_view",
+        "set_global_default_game_mode",
         {
-            "assetPath": asset_path,
-            "widgetName": widget_name,
-            "entryWidgetAssetPath": entry_widget_asset_path,
-            "entryWidth": float(entry_width),
-            "entryHeight": float(entry_height),
-            "orientation": orientation,
-            "saveAsset": save_asset,
+            "gameModeClassPath": game_mode_class_path,
+            "saveConfig": save_config,
         },
-        timeout_seconds=CONFIGURE_TILE_VIEW_TIMEOUT_SECONDS,
+        timeout_seconds=SET_GLOBAL_DEFAULT_GAME_MODE_TIMEOUT_SECONDS,
     )
 
     structured_content = {
@@ -2540,25 +4985,13 @@ def build_configure_tile_view_tool_success(arguments: dict[str, Any]) -> dict[st
         "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
         "message": str(bridge_result.get("message", "")),
-        "assetPath": str(bridge_result.get("assetPath", "")),
-        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
-        "packagePath": str(bridge_result.get("packagePath", "")),
-        "assetName": str(bridge_result.get("assetName", "")),
-        "widgetName": str(bridge_result.get("widgetName", widget_name)),
-        "entryWidgetAssetPath": str(bridge_result.get("entryWidgetAssetPath", entry_widget_asset_path)),
-        "entryWidgetClassPath": str(bridge_result.get("entryWidgetClassPath", "")),
-        "entryWidgetClassName": str(bridge_result.get("entryWidgetClassName", "")),
-        "orientation": str(bridge_result.get("orientation", orientation)),
-        "entryWidth": float(bridge_result.get("entryWidth", entry_width)),
-        "entryHeight": float(bridge_result.get("entryHeight", entry_height)),
+        "gameModeClassPath": str(bridge_result.get("gameModeClassPath", "")),
         "editorReachable": True,
     }
 
     summary = (
-        f"widget={structured_content['widgetName']} | "
-        f"entry={structured_content['entryWidgetClassPath']} | "
-        f"orientation={structured_content['orientation']} | "
-        f"size={structured_content['entryWidth']:.1f}x{structured_content['entryHeight']:.1f} | "
+        f"saved={structured_content['saved']} | "
+        f"gameMode={structured_content['gameModeClassPath']} | "
         f"{structured_content['message']}"
     )
 
@@ -2569,25 +5002,15 @@ def build_configure_tile_view_tool_success(arguments: dict[str, Any]) -> dict[st
     }
 
 
-def build_configure_tile_view_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, widget_name: str, entry_widget_asset_path: str
+def build_set_global_default_game_mode_tool_error(
+    message: str, editor_reachable: bool, game_mode_class_path: str
 ) -> dict[str, Any]:
     structured_content = {
-        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "saved": False,
-        "success": False,
-        "message": message,
-        "assetPath": asset_path,
-        "assetObjectPath": "",
-        "packagePath": "",
-        "assetName": "",
-        "widgetName": widget_name,
-        "entryWidgetAssetPath": entry_widget_asset_path,
-        "entryWidgetClassPath": "",
-        "entryWidgetClassName": "",
-        "orientation": "",
-        "entryWidth": 0.0,
-        "entryHeight": 0.0,
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "saved": False,
+        "success": False,
+        "message": message,
+        "gameModeClassPath": game_mode_class_path,
         "editorReachable": editor_reachable,
     }
 
@@ -2598,58 +5021,49 @@ def build_configure_tile_view_tool_error(
     }
 
 
-def build_reorder_widget_child_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
-    asset_path = arguments.get("assetPath")
-    if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_reorder_widget_child.assetPath must be a non-empty string.")
-
-    widget_name = arguments.get("widgetName")
-    if not isinstance(widget_name, str) or not widget_name.strip():
-        raise JsonRpcError(-32602, "ue_reorder_widget_child.widgetName must be a non-empty string.")
+def build_bootstrap_project_map_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    level_file_name = arguments.get("levelFileName", "BasicMap")
+    if not isinstance(level_file_name, str) or not level_file_name.strip():
+        raise JsonRpcError(-32602, "ue_bootstrap_project_map.levelFileName must be a non-empty string.")
 
-    desired_index = arguments.get("desiredIndex")
-    if not isinstance(desired_index, int):
-        raise JsonRpcError(-32602, "ue_reorder_widget_child.desiredIndex must be an integer.")
+    directory_path = arguments.get("directoryPath", "/Game/Maps")
+    if not isinstance(directory_path, str) or not directory_path.strip():
+        raise JsonRpcError(-32602, "ue_bootstrap_project_map.directoryPath must be a non-empty string.")
 
-    save_asset = arguments.get("saveAsset", True)
-    if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_reorder_widget_child.saveAsset must be a boolean.")
+    force_create = arguments.get("forceCreate", False)
+    if not isinstance(force_create, bool):
+        raise JsonRpcError(-32602, "ue_bootstrap_project_map.forceCreate must be a boolean.")
 
     bridge_result = call_ue_bridge(
-        "reorder_widget_child",
+        "bootstrap_project_map",
         {
-            "assetPath": asset_path,
-            "widgetName": widget_name,
-            "desiredIndex": desired_index,
-            "saveAsset": save_asset,
+            "levelFileName": level_file_name,
+            "directoryPath": directory_path,
+            "forceCreate": force_create,
         },
-        timeout_seconds=REORDER_WIDGET_CHILD_TIMEOUT_SECONDS,
+        timeout_seconds=BOOTSTRAP_PROJECT_MAP_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "reordered": bool(bridge_result.get("reordered", False)),
-        "saved": bool(bridge_result.get("saved", False)),
+        "bootstrapped": bool(bridge_result.get("bootstrapped", False)),
+        "created": bool(bridge_result.get("created", False)),
+        "forceCreate": bool(bridge_result.get("forceCreate", force_create)),
+        "savedConfig": bool(bridge_result.get("savedConfig", False)),
         "success": bool(bridge_result.get("success", False)),
+        "existingLevelCount": int(bridge_result.get("existingLevelCount", 0)),
         "message": str(bridge_result.get("message", "")),
-        "assetPath": str(bridge_result.get("assetPath", "")),
-        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
-        "packagePath": str(bridge_result.get("packagePath", "")),
-        "assetName": str(bridge_result.get("assetName", "")),
-        "widgetName": str(bridge_result.get("widgetName", widget_name)),
-        "parentWidgetName": str(bridge_result.get("parentWidgetName", "")),
-        "requestedIndex": int(bridge_result.get("requestedIndex", desired_index)),
-        "finalIndex": int(bridge_result.get("finalIndex", -1)),
+        "levelFileName": str(bridge_result.get("levelFileName", level_file_name)),
+        "directoryPath": str(bridge_result.get("directoryPath", directory_path)),
+        "levelAssetPath": str(bridge_result.get("levelAssetPath", "")),
+        "levelObjectPath": str(bridge_result.get("levelObjectPath", "")),
         "editorReachable": True,
     }
 
     summary = (
-        f"reordered={structured_content['reordered']} | "
-        f"saved={structured_content['saved']} | "
-        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"widget={structured_content['widgetName']} | "
-        f"parent={structured_content['parentWidgetName']} | "
-        f"index={structured_content['finalIndex']} | "
+        f"bootstrapped={structured_content['bootstrapped']} | "
+        f"forceCreate={structured_content['forceCreate']} | "
+        f"level={structured_content['levelAssetPath'] or structured_content['levelObjectPath']} | "
         f"{structured_content['message']}"
     )
 
@@ -2660,23 +5074,22 @@ def build_reorder_widget_child_tool_success(arguments: dict[str, Any]) -> dict[s
     }
 
 
-def build_reorder_widget_child_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, widget_name: str, desired_index: int
+def build_bootstrap_project_map_tool_error(
+    message: str, editor_reachable: bool, level_file_name: str, directory_path: str, force_create: bool
 ) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "reordered": False,
-        "saved": False,
+        "bootstrapped": False,
+        "created": False,
+        "forceCreate": force_create,
+        "savedConfig": False,
         "success": False,
+        "existingLevelCount": 0,
         "message": message,
-        "assetPath": asset_path,
-        "assetObjectPath": "",
-        "packagePath": "",
-        "assetName": "",
-        "widgetName": widget_name,
-        "parentWidgetName": "",
-        "requestedIndex": desired_index,
-        "finalIndex": -1,
+        "levelFileName": level_file_name,
+        "directoryPath": directory_path,
+        "levelAssetPath": "",
+        "levelObjectPath": "",
         "editorReachable": editor_reachable,
     }
 
@@ -2687,49 +5100,25 @@ def build_reorder_widget_child_tool_error(
     }
 
 
-def build_remove_widget_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
-    asset_path = arguments.get("assetPath")
-    if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_remove_widget.assetPath must be a non-empty string.")
-
-    widget_name = arguments.get("widgetName")
-    if not isinstance(widget_name, str) or not widget_name.strip():
-        raise JsonRpcError(-32602, "ue_remove_widget.widgetName must be a non-empty string.")
-
-    save_asset = arguments.get("saveAsset", True)
-    if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_remove_widget.saveAsset must be a boolean.")
-
-    bridge_result = call_ue_bridge(
-        "remove_widget",
-        {
-            "assetPath": asset_path,
-            "widgetName": widget_name,
-            "saveAsset": save_asset,
-        },
-        timeout_seconds=REMOVE_WIDGET_TIMEOUT_SECONDS,
-    )
-
+def build_flush_saves_tool_success() -> dict[str, Any]:
+    bridge_result = call_ue_bridge("flush_saves", timeout_seconds=FLUSH_SAVES_TIMEOUT_SECONDS)
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "removed": bool(bridge_result.get("removed", False)),
-        "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
+        "savedCount": int(bridge_result.get("savedCount", 0)),
+        "failedCount": int(bridge_result.get("failedCount", 0)),
+        "skippedCount": int(bridge_result.get("skippedCount", 0)),
         "message": str(bridge_result.get("message", "")),
-        "assetPath": str(bridge_result.get("assetPath", "")),
-        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
-        "packagePath": str(bridge_result.get("packagePath", "")),
-        "assetName": str(bridge_result.get("assetName", "")),
-        "widgetName": str(bridge_result.get("widgetName", widget_name)),
-        "parentWidgetName": str(bridge_result.get("parentWidgetName", "")),
+        "savedPackages": [str(value) for value in bridge_result.get("savedPackages", [])],
+        "failedPackages": [str(value) for value in bridge_result.get("failedPackages", [])],
+        "skippedPackages": [str(value) for value in bridge_result.get("skippedPackages", [])],
         "editorReachable": True,
     }
 
     summary = (
-        f"removed={structured_content['removed']} | "
-        f"saved={structured_content['saved']} | "
-        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"widget={structured_content['widgetName']} | "
+        f"saved={structured_content['savedCount']} | "
+        f"failed={structured_content['failedCount']} | "
+        f"skipped={structured_content['skippedCount']} | "
         f"{structured_content['message']}"
     )
 
@@ -2740,21 +5129,17 @@ def build_remove_widget_tool_success(arguments: dict[str, Any]) -> dict[str, Any
     }
 
 
-def build_remove_widget_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, widget_name: str
-) -> dict[str, Any]:
+def build_flush_saves_tool_error(message: str, editor_reachable: bool) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "removed": False,
-        "saved": False,
         "success": False,
+        "savedCount": 0,
+        "failedCount": 0,
+        "skippedCount": 0,
         "message": message,
-        "assetPath": asset_path,
-        "assetObjectPath": "",
-        "packagePath": "",
-        "assetName": "",
-        "widgetName": widget_name,
-        "parentWidgetName": "",
+        "savedPackages": [],
+        "failedPackages": [],
+        "skippedPackages": [],
         "editorReachable": editor_reachable,
     }
 
@@ -2765,102 +5150,144 @@ def build_remove_widget_tool_error(
     }
 
 
-def build_set_widget_background_blur_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
-    asset_path = arguments.get("assetPath")
-    if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_set_widget_background_blur.assetPath must be a non-empty string.")
-
-    widget_name = arguments.get("widgetName")
-    if not isinstance(widget_name, str) or not widget_name.strip():
-        raise JsonRpcError(-32602, "ue_set_widget_background_blur.widgetName must be a non-empty string.")
+def build_get_save_queue_status_tool_success() -> dict[str, Any]:
+    bridge_result = call_ue_bridge("get_save_queue_status")
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "lastFlushSucceeded": bool(bridge_result.get("lastFlushSucceeded", True)),
+        "pendingCount": int(bridge_result.get("pendingCount", 0)),
+        "totalFlushCount": int(bridge_result.get("totalFlushCount", 0)),
+        "secondsSinceLastQueued": float(bridge_result.get("secondsSinceLastQueued", 0.0)),
+        "secondsSinceLastFlush": float(bridge_result.get("secondsSinceLastFlush", -1.0)),
+        "quietPeriodSeconds": float(bridge_result.get("quietPeriodSeconds", 0.0)),
+        "lastFlushMessage": str(bridge_result.get("lastFlushMessage", "")),
+        "pendingPackages": [str(value) for value in bridge_result.get("pendingPackages", [])],
+        "lastFlushFailedPackages": [str(value) for value in bridge_result.get("lastFlushFailedPackages", [])],
+        "editorReachable": True,
+    }
 
-    blur_strength = arguments.get("blurStrength", 30.0)
-    if not isinstance(blur_strength, (int, float)):
-        raise JsonRpcError(-32602, "ue_set_widget_background_blur.blurStrength must be a number.")
+    summary = (
+        f"pending={structured_content['pendingCount']} | "
+        f"lastFlushSucceeded={structured_content['lastFlushSucceeded']} | "
+        f"{structured_content['lastFlushMessage'] or 'no flush yet'}"
+    )
 
-    blur_radius = arguments.get("blurRadius")
-    if blur_radius is not None and not isinstance(blur_radius, int):
-        raise JsonRpcError(-32602, "ue_set_widget_background_blur.blurRadius must be an integer.")
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": False,
+    }
 
-    apply_alpha_to_blur = arguments.get("applyAlphaToBlur", False)
-    if not isinstance(apply_alpha_to_blur, bool):
-        raise JsonRpcError(-32602, "ue_set_widget_background_blur.applyAlphaToBlur must be a boolean.")
 
-    save_asset = arguments.get("saveAsset", True)
-    if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_set_widget_background_blur.saveAsset must be a boolean.")
+def build_get_save_queue_status_tool_error(message: str, editor_reachable: bool) -> dict[str, Any]:
+    structured_content = {
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "lastFlushSucceeded": False,
+        "pendingCount": 0,
+        "totalFlushCount": 0,
+        "secondsSinceLastQueued": 0.0,
+        "secondsSinceLastFlush": -1.0,
+        "quietPeriodSeconds": 0.0,
+        "lastFlushMessage": message,
+        "pendingPackages": [],
+        "lastFlushFailedPackages": [],
+        "editorReachable": editor_reachable,
+    }
 
-    bridge_arguments: dict[str, Any] = {
-        "assetPath": asset_path,
-        "widgetName": widget_name,
-        "blurStrength": float(blur_strength),
-        "applyAlphaToBlur": apply_alpha_to_blur,
-        "saveAsset": save_asset,
+    return {
+        "content": [{"type": "text", "text": message}],
+        "structuredContent": structured_content,
+        "isError": True,
     }
-    if blur_radius is not None:
-        bridge_arguments["blurRadius"] = blur_radius
 
-    bridge_result = call_ue_bridge(
-        "set_widget_background_blur",
-        bridge_arguments,
-        timeout_seconds=SET_WIDGET_BACKGROUND_BLUR_TIMEOUT_SECONDS,
-    )
+
+def build_query_assets_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    bridge_arguments: dict[str, Any] = {}
+    for field_name in ("classPath", "pathPrefix", "nameContains"):
+        value = arguments.get(field_name)
+        if value is None:
+            continue
+        if not isinstance(value, str):
+            raise JsonRpcError(-32602, f"ue_query_assets.{field_name} must be a string.")
+        if value.strip():
+            bridge_arguments[field_name] = value
+
+    tags = arguments.get("tags")
+    if tags is not None:
+        if not isinstance(tags, dict) or not all(isinstance(value, str) for value in tags.values()):
+            raise JsonRpcError(-32602, "ue_query_assets.tags must be an object of string values.")
+        bridge_arguments["tags"] = tags
+
+    offset = arguments.get("offset", 0)
+    if not isinstance(offset, int) or isinstance(offset, bool) or offset < 0:
+        raise JsonRpcError(-32602, "ue_query_assets.offset must be a non-negative integer.")
+
+    limit = arguments.get("limit", 100)
+    if not isinstance(limit, int) or isinstance(limit, bool) or not 1 <= limit <= 1000:
+        raise JsonRpcError(-32602, "ue_query_assets.limit must be an integer between 1 and 1000.")
+
+    bridge_arguments["offset"] = offset
+    bridge_arguments["limit"] = limit
+    bridge_result = call_ue_bridge("query_assets", bridge_arguments)
+
+    assets = []
+    for asset in bridge_result.get("assets", []):
+        if not isinstance(asset, dict):
+            continue
+        assets.append(
+            {
+                "assetObjectPath": str(asset.get("assetObjectPath", "")),
+                "assetPath": str(asset.get("assetPath", "")),
+                "packagePath": str(asset.get("packagePath", "")),
+                "assetName": str(asset.get("assetName", "")),
+                "classPath": str(asset.get("classPath", "")),
+                "className": str(asset.get("className", "")),
+            }
+        )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "converted": bool(bridge_result.get("converted", False)),
-        "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
+        "indexReady": bool(bridge_result.get("indexReady", False)),
+        "totalCount": int(bridge_result.get("totalCount", 0)),
+        "returnedCount": int(bridge_result.get("returnedCount", len(assets))),
+        "offset": int(bridge_result.get("offset", offset)),
+        "limit": int(bridge_result.get("limit", limit)),
+        "indexedAssetCount": int(bridge_result.get("indexedAssetCount", 0)),
+        "indexRevision": int(bridge_result.get("indexRevision", 0)),
         "message": str(bridge_result.get("message", "")),
-        "assetPath": str(bridge_result.get("assetPath", "")),
-        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
-        "packagePath": str(bridge_result.get("packagePath", "")),
-        "assetName": str(bridge_result.get("assetName", "")),
-        "widgetName": str(bridge_result.get("widgetName", widget_name)),
-        "widgetClassName": str(bridge_result.get("widgetClassName", "")),
-        "blurStrength": float(bridge_result.get("blurStrength", float(blur_strength))),
-        "blurRadius": int(bridge_result.get("blurRadius", int(blur_radius) if blur_radius is not None else 0)),
-        "applyAlphaToBlur": bool(bridge_result.get("applyAlphaToBlur", apply_alpha_to_blur)),
-        "overrideAutoRadiusCalculation": bool(bridge_result.get("overrideAutoRadiusCalculation", blur_radius is not None)),
+        "assets": assets,
         "editorReachable": True,
     }
 
-    summary = (
-        f"converted={structured_content['converted']} | "
-        f"saved={structured_content['saved']} | "
-        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"widget={structured_content['widgetName']} | "
-        f"class={structured_content['widgetClassName']} | "
-        f"blur={structured_content['blurStrength']} | "
+    summary_lines = [
+        f"total={structured_content['totalCount']} | "
+        f"returned={structured_content['returnedCount']} | "
+        f"offset={structured_content['offset']} | "
         f"{structured_content['message']}"
-    )
+    ]
+    summary_lines.extend(f"{asset['className']} {asset['assetObjectPath']}" for asset in assets)
 
     return {
-        "content": [{"type": "text", "text": summary}],
+        "content": [{"type": "text", "text": "\n".join(summary_lines)}],
         "structuredContent": structured_content,
         "isError": not structured_content["success"],
     }
 
 
-def build_set_widget_background_blur_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, widget_name: str
-) -> dict[str, Any]:
+def build_query_assets_tool_error(message: str, editor_reachable: bool) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "converted": False,
-        "saved": False,
         "success": False,
+        "indexReady": False,
+        "totalCount": 0,
+        "returnedCount": 0,
+        "offset": 0,
+        "limit": 0,
+        "indexedAssetCount": 0,
+        "indexRevision": 0,
         "message": message,
-        "assetPath": asset_path,
-        "assetObjectPath": "",
-        "packagePath": "",
-        "assetName": "",
-        "widgetName": widget_name,
-        "widgetClassName": "",
-        "blurStrength": 0.0,
-        "blurRadius": 0,
-        "applyAlphaToBlur": False,
-        "overrideAutoRadiusCalculation": False,
+        "assets": [],
         "editorReachable": editor_reachable,
     }
 
@@ -2871,54 +5298,54 @@ def build_set_widget_background_blur_tool_error(
     }
 
 
-def build_set_widget_corner_radius_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
-    asset_path = arguments.get("assetPath")
-    if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_set_widget_corner_radius.assetPath must be a non-empty string.")
-
-    widget_name = arguments.get("widgetName")
-    if not isinstance(widget_name, str) or not widget_name.strip():
-        raise JsonRpcError(-32602, "ue_set_widget_corner_radius.widgetName must be a non-empty string.")
+def build_apply_texture_profile_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    path_prefix = arguments.get("pathPrefix")
+    if not isinstance(path_prefix, str) or not path_prefix.strip():
+        raise JsonRpcError(-32602, "ue_apply_texture_profile.pathPrefix must be a non-empty string.")
 
-    radius = arguments.get("radius")
-    if not isinstance(radius, (int, float)):
-        raise JsonRpcError(-32602, "ue_set_widget_corner_radius.radius must be a number.")
+    import_profile = arguments.get("importProfile")
+    if not isinstance(import_profile, str) or not import_profile.strip():
+        raise JsonRpcError(-32602, "ue_apply_texture_profile.importProfile must be a non-empty string.")
 
     save_asset = arguments.get("saveAsset", True)
     if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_set_widget_corner_radius.saveAsset must be a boolean.")
+        raise JsonRpcError(-32602, "ue_apply_texture_profile.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_apply_texture_profile.saveMode must be immediate or deferred.")
 
     bridge_result = call_ue_bridge(
-        "set_widget_corner_radius",
+        "apply_texture_profile",
         {
-            "assetPath": asset_path,
-            "widgetName": widget_name,
-            "radius": float(radius),
+            "pathPrefix": path_prefix,
+            "importProfile": import_profile,
             "saveAsset": save_asset,
+            "saveMode": save_mode,
         },
-        timeout_seconds=SET_WIDGET_CORNER_RADIUS_TIMEOUT_SECONDS,
+        timeout_seconds=APPLY_TEXTURE_PROFILE_TIMEOUT_SECONDS,
     )
 
     structured_content = {
-        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "saved": bool(bridge_result.get("saved", False)),
-        "success": bool(bridge_result.get("success", False)),
-        "message": str(bridge_result.get("message", "")),
-        "assetPath": str(bridge_result.get("assetPath", "")),
-        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
-        "packagePath": str(bridge_result.get("packagePath", "")),
-        "assetName": str(bridge_result.get("assetName", "")),
-        "widgetName": str(bridge_result.get("widgetName", widget_name)),
-        "widgetClassName": str(bridge_result.get("widgetClassName", "")),
-        "radius": float(bridge_result.get("radius", float(radius))),
+        "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "saved": bool(bridge_result.get("saved", False)),
+        "success": bool(bridge_result.get("success", False)),
+        "matchedCount": int(bridge_result.get("matchedCount", 0)),
+        "updatedCount": int(bridge_result.get("updatedCount", 0)),
+        "unchangedCount": int(bridge_result.get("unchangedCount", 0)),
+        "failedCount": int(bridge_result.get("failedCount", 0)),
+        "message": str(bridge_result.get("message", "")),
+        "pathPrefix": str(bridge_result.get("pathPrefix", path_prefix)),
+        "importProfile": str(bridge_result.get("importProfile", import_profile)),
+        "updatedAssets": [str(value) for value in bridge_result.get("updatedAssets", [])],
+        "failedAssets": [str(value) for value in bridge_result.get("failedAssets", [])],
         "editorReachable": True,
     }
 
     summary = (
-        f"saved={structured_content['saved']} | "
-        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"widget={structured_content['widgetName']} | "
-        f"radius={structured_content['radius']} | "
+        f"updated={structured_content['updatedCount']} | "
+        f"unchanged={structured_content['unchangedCount']} | "
+        f"failed={structured_content['failedCount']} | "
         f"{structured_content['message']}"
     )
 
@@ -2929,21 +5356,22 @@ def build_set_widget_corner_radius_tool_success(arguments: dict[str, Any]) -> di
     }
 
 
-def build_set_widget_corner_radius_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, widget_name: str
+def build_apply_texture_profile_tool_error(
+    message: str, editor_reachable: bool, path_prefix: str, import_profile: str
 ) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
         "saved": False,
         "success": False,
+        "matchedCount": 0,
+        "updatedCount": 0,
+        "unchangedCount": 0,
+        "failedCount": 0,
         "message": message,
-        "assetPath": asset_path,
-        "assetObjectPath": "",
-        "packagePath": "",
-        "assetName": "",
-        "widgetName": widget_name,
-        "widgetClassName": "",
-        "radius": 0.0,
+        "pathPrefix": path_prefix,
+        "importProfile": import_profile,
+        "updatedAssets": [],
+        "failedAssets": [],
         "editorReachable": editor_reachable,
     }
 
@@ -2954,71 +5382,88 @@ def build_set_widget_corner_radius_tool_error(
     }
 
 
-def build_set_widget_panel_color_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
-    asset_path = arguments.get("assetPath")
-    if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_set_widget_panel_color.assetPath must be a non-empty string.")
+def build_pack_icon_atlas_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    atlas_asset_path = arguments.get("atlasAssetPath")
+    if not isinstance(atlas_asset_path, str) or not atlas_asset_path.strip():
+        raise JsonRpcError(-32602, "ue_pack_icon_atlas.atlasAssetPath must be a non-empty string.")
 
-    widget_name = arguments.get("widgetName")
-    if not isinstance(widget_name, str) or not widget_name.strip():
-        raise JsonRpcError(-32602, "ue_set_widget_panel_color.widgetName must be a non-empty string.")
+    texture_asset_paths = arguments.get("textureAssetPaths", [])
+    if not isinstance(texture_asset_paths, list) or not all(
+        isinstance(value, str) and value.strip() for value in texture_asset_paths
+    ):
+        raise JsonRpcError(-32602, "ue_pack_icon_atlas.textureAssetPaths must be an array of non-empty strings.")
 
-    red = arguments.get("red")
-    green = arguments.get("green")
-    blue = arguments.get("blue")
-    alpha = arguments.get("alpha")
-    if not isinstance(red, (int, float)):
-        raise JsonRpcError(-32602, "ue_set_widget_panel_color.red must be a number.")
-    if not isinstance(green, (int, float)):
-        raise JsonRpcError(-32602, "ue_set_widget_panel_color.green must be a number.")
-    if not isinstance(blue, (int, float)):
-        raise JsonRpcError(-32602, "ue_set_widget_panel_color.blue must be a number.")
-    if not isinstance(alpha, (int, float)):
-        raise JsonRpcError(-32602, "ue_set_widget_panel_color.alpha must be a number.")
+    path_prefix = arguments.get("pathPrefix", "")
+    if not isinstance(path_prefix, str):
+        raise JsonRpcError(-32602, "ue_pack_icon_atlas.pathPrefix must be a string.")
+
+    if not texture_asset_paths and not path_prefix.strip():
+        raise JsonRpcError(-32602, "ue_pack_icon_atlas requires textureAssetPaths and/or pathPrefix.")
+
+    entry_widget_asset_path = arguments.get("entryWidgetAssetPath", "")
+    if not isinstance(entry_widget_asset_path, str):
+        raise JsonRpcError(-32602, "ue_pack_icon_atlas.entryWidgetAssetPath must be a string.")
+
+    page_size = arguments.get("pageSize", 1024)
+    if not isinstance(page_size, int) or isinstance(page_size, bool) or page_size <= 0:
+        raise JsonRpcError(-32602, "ue_pack_icon_atlas.pageSize must be a positive integer.")
+
+    padding = arguments.get("padding", 2)
+    if not isinstance(padding, int) or isinstance(padding, bool) or padding < 0:
+        raise JsonRpcError(-32602, "ue_pack_icon_atlas.padding must be a non-negative integer.")
 
     save_asset = arguments.get("saveAsset", True)
     if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_set_widget_panel_color.saveAsset must be a boolean.")
+        raise JsonRpcError(-32602, "ue_pack_icon_atlas.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_pack_icon_atlas.saveMode must be immediate or deferred.")
+
+    bridge_arguments: dict[str, Any] = {
+        "atlasAssetPath": atlas_asset_path,
+        "pageSize": page_size,
+        "padding": padding,
+        "saveAsset": save_asset,
+        "saveMode": save_mode,
+    }
+    if texture_asset_paths:
+        bridge_arguments["textureAssetPaths"] = texture_asset_paths
+    if path_prefix.strip():
+        bridge_arguments["pathPrefix"] = path_prefix
+    if entry_widget_asset_path.strip():
+        bridge_arguments["entryWidgetAssetPath"] = entry_widget_asset_path
 
     bridge_result = call_ue_bridge(
-        "set_widget_panel_color",
-        {
-            "assetPath": asset_path,
-            "widgetName": widget_name,
-            "red": float(red),
-            "green": float(green),
-            "blue": float(blue),
-            "alpha": float(alpha),
-            "saveAsset": save_asset,
-        },
-        timeout_seconds=SET_WIDGET_PANEL_COLOR_TIMEOUT_SECONDS,
+        "pack_icon_atlas",
+        bridge_arguments,
+        timeout_seconds=PACK_ICON_ATLAS_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "created": bool(bridge_result.get("created", False)),
         "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
+        "iconCount": int(bridge_result.get("iconCount", 0)),
+        "pageCount": int(bridge_result.get("pageCount", 0)),
+        "pageSize": int(bridge_result.get("pageSize", page_size)),
+        "padding": int(bridge_result.get("padding", padding)),
         "message": str(bridge_result.get("message", "")),
-        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetPath": str(bridge_result.get("assetPath", atlas_asset_path)),
         "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
-        "packagePath": str(bridge_result.get("packagePath", "")),
-        "assetName": str(bridge_result.get("assetName", "")),
-        "widgetName": str(bridge_result.get("widgetName", widget_name)),
-        "widgetClassName": str(bridge_result.get("widgetClassName", "")),
-        "red": float(bridge_result.get("red", 0.0)),
-        "green": float(bridge_result.get("green", 0.0)),
-        "blue": float(bridge_result.get("blue", 0.0)),
-        "alpha": float(bridge_result.get("alpha", 0.0)),
+        "entryWidgetAssetPath": str(bridge_result.get("entryWidgetAssetPath", "")),
+        "pageAssetPaths": [str(value) for value in bridge_result.get("pageAssetPaths", [])],
+        "skippedTextures": [str(value) for value in bridge_result.get("skippedTextures", [])],
+        "deletedPageAssetPaths": [str(value) for value in bridge_result.get("deletedPageAssetPaths", [])],
+        "stalePageAssetPaths": [str(value) for value in bridge_result.get("stalePageAssetPaths", [])],
         "editorReachable": True,
     }
 
     summary = (
-        f"saved={structured_content['saved']} | "
-        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"widget={structured_content['widgetName']} | "
-        f"class={structured_content['widgetClassName']} | "
-        f"rgba=({structured_content['red']:.3f}, {structured_content['green']:.3f}, "
-        f"{structured_content['blue']:.3f}, {structured_content['alpha']:.3f}) | "
+        f"icons={structured_content['iconCount']} | "
+        f"pages={structured_content['pageCount']} | "
+        f"skipped={len(structured_content['skippedTextures'])} | "
         f"{structured_content['message']}"
     )
 
@@ -3029,24 +5474,24 @@ def build_set_widget_panel_color_tool_success(arguments: dict[str, Any]) -> dict
     }
 
 
-def build_set_widget_panel_color_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, widget_name: str
-) -> dict[str, Any]:
+def build_pack_icon_atlas_tool_error(message: str, editor_reachable: bool, atlas_asset_path: str) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "created": False,
         "saved": False,
         "success": False,
+        "iconCount": 0,
+        "pageCount": 0,
+        "pageSize": 0,
+        "padding": 0,
         "message": message,
-        "assetPath": asset_path,
+        "assetPath": atlas_asset_path,
         "assetObjectPath": "",
-        "packagePath": "",
-        "assetName": "",
-        "widgetName": widget_name,
-        "widgetClassName": "",
-        "red": 0.0,
-        "green": 0.0,
-        "blue": 0.0,
-        "alpha": 0.0,
+        "entryWidgetAssetPath": "",
+        "pageAssetPaths": [],
+        "skippedTextures": [],
+        "deletedPageAssetPaths": [],
+        "stalePageAssetPaths": [],
         "editorReachable": editor_reachable,
     }
 
@@ -3057,53 +5502,57 @@ def build_set_widget_panel_color_tool_error(
     }
 
 
-def build_set_size_box_height_override_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+def build_apply_widget_tree_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
     asset_path = arguments.get("assetPath")
     if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_set_size_box_height_override.assetPath must be a non-empty string.")
-
-    widget_name = arguments.get("widgetName")
-    if not isinstance(widget_name, str) or not widget_name.strip():
-        raise JsonRpcError(-32602, "ue_set_size_box_height_override.widgetName must be a non-empty string.")
+        raise JsonRpcError(-32602, "ue_apply_widget_tree.assetPath must be a non-empty string.")
 
-    height_override = arguments.get("heightOverride")
-    if not isinstance(height_override, (int, float)):
-        raise JsonRpcError(-32602, "ue_set_size_box_height_override.heightOverride must be a number.")
+    tree = arguments.get("tree")
+    if not isinstance(tree, dict):
+        raise JsonRpcError(-32602, "ue_apply_widget_tree.tree must be an object.")
 
     save_asset = arguments.get("saveAsset", True)
     if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_set_size_box_height_override.saveAsset must be a boolean.")
+        raise JsonRpcError(-32602, "ue_apply_widget_tree.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_apply_widget_tree.saveMode must be immediate or deferred.")
 
     bridge_result = call_ue_bridge(
-        "set_size_box_height_override",
+        "apply_widget_tree",
         {
             "assetPath": asset_path,
-            "widgetName": widget_name,
-            "heightOverride": float(height_override),
+            "tree": tree,
             "saveAsset": save_asset,
+            "saveMode": save_mode,
         },
-        timeout_seconds=SET_SIZE_BOX_HEIGHT_OVERRIDE_TIMEOUT_SECONDS,
+        timeout_seconds=APPLY_WIDGET_TREE_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "changed": bool(bridge_result.get("changed", False)),
         "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
+        "widgetCount": int(bridge_result.get("widgetCount", 0)),
+        "createdCount": int(bridge_result.get("createdCount", 0)),
+        "replacedCount": int(bridge_result.get("replacedCount", 0)),
+        "removedCount": int(bridge_result.get("removedCount", 0)),
+        "movedCount": int(bridge_result.get("movedCount", 0)),
+        "propertyChangeCount": int(bridge_result.get("propertyChangeCount", 0)),
         "message": str(bridge_result.get("message", "")),
-        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetPath": str(bridge_result.get("assetPath", asset_path)),
         "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
-        "packagePath": str(bridge_result.get("packagePath", "")),
-        "assetName": str(bridge_result.get("assetName", "")),
-        "widgetName": str(bridge_result.get("widgetName", widget_name)),
-        "heightOverride": float(bridge_result.get("heightOverride", 0.0)),
+        "changes": [str(value) for value in bridge_result.get("changes", [])],
         "editorReachable": True,
     }
 
     summary = (
-        f"saved={structured_content['saved']} | "
-        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"widget={structured_content['widgetName']} | "
-        f"height={structured_content['heightOverride']:.3f} | "
+        f"changed={structured_content['changed']} | "
+        f"created={structured_content['createdCount']} | "
+        f"removed={structured_content['removedCount']} | "
+        f"moved={structured_content['movedCount']} | "
         f"{structured_content['message']}"
     )
 
@@ -3114,20 +5563,22 @@ def build_set_size_box_height_override_tool_success(arguments: dict[str, Any]) -
     }
 
 
-def build_set_size_box_height_override_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, widget_name: str
-) -> dict[str, Any]:
+def build_apply_widget_tree_tool_error(message: str, editor_reachable: bool, asset_path: str) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "changed": False,
         "saved": False,
         "success": False,
+        "widgetCount": 0,
+        "createdCount": 0,
+        "replacedCount": 0,
+        "removedCount": 0,
+        "movedCount": 0,
+        "propertyChangeCount": 0,
         "message": message,
         "assetPath": asset_path,
         "assetObjectPath": "",
-        "packagePath": "",
-        "assetName": "",
-        "widgetName": widget_name,
-        "heightOverride": 0.0,
+        "changes": [],
         "editorReachable": editor_reachable,
     }
 
@@ -3138,87 +5589,50 @@ def build_set_size_box_height_override_tool_error(
     }
 
 
-def build_set_popup_open_elastic_scale_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+def build_get_widget_tree_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
     asset_path = arguments.get("assetPath")
     if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.assetPath must be a non-empty string.")
-
-    enabled = arguments.get("enabled", True)
-    if not isinstance(enabled, bool):
-        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.enabled must be a boolean.")
-
-    widget_name = arguments.get("widgetName", "PopupCard")
-    if not isinstance(widget_name, str) or not widget_name.strip():
-        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.widgetName must be a non-empty string.")
-
-    duration = arguments.get("duration", 0.45)
-    if not isinstance(duration, (int, float)):
-        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.duration must be a number.")
-
-    start_scale = arguments.get("startScale", 0.82)
-    if not isinstance(start_scale, (int, float)):
-        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.startScale must be a number.")
-
-    oscillation_count = arguments.get("oscillationCount", 2.0)
-    if not isinstance(oscillation_count, (int, float)):
-        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.oscillationCount must be a number.")
+        raise JsonRpcError(-32602, "ue_get_widget_tree.assetPath must be a non-empty string.")
 
-    pivot_x = arguments.get("pivotX", 0.5)
-    if not isinstance(pivot_x, (int, float)):
-        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.pivotX must be a number.")
+    last_hash = arguments.get("lastHash", "")
+    if not isinstance(last_hash, str):
+        raise JsonRpcError(-32602, "ue_get_widget_tree.lastHash must be a string.")
 
-    pivot_y = arguments.get("pivotY", 0.5)
-    if not isinstance(pivot_y, (int, float)):
-        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.pivotY must be a number.")
+    include_properties = arguments.get("includeProperties", True)
+    if not isinstance(include_properties, bool):
+        raise JsonRpcError(-32602, "ue_get_widget_tree.includeProperties must be a boolean.")
 
-    save_asset = arguments.get("saveAsset", True)
-    if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_set_popup_open_elastic_scale.saveAsset must be a boolean.")
+    bridge_arguments: dict[str, Any] = {
+        "assetPath": asset_path,
+        "includeProperties": include_properties,
+    }
+    if last_hash.strip():
+        bridge_arguments["lastHash"] = last_hash
 
     bridge_result = call_ue_bridge(
-        "set_popup_open_elastic_scale",
-        {
-            "assetPath": asset_path,
-            "enabled": enabled,
-            "widgetName": widget_name,
-            "duration": float(duration),
-            "startScale": float(start_scale),
-            "oscillationCount": float(oscillation_count),
-            "pivotX": float(pivot_x),
-            "pivotY": float(pivot_y),
-            "saveAsset": save_asset,
-        },
-        timeout_seconds=SET_POPUP_OPEN_ELASTIC_SCALE_TIMEOUT_SECONDS,
+        "get_widget_tree",
+        bridge_arguments,
+        timeout_seconds=GET_WIDGET_TREE_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "saved": bool(bridge_result.get("saved", False)),
+        "notModified": bool(bridge_result.get("notModified", False)),
         "success": bool(bridge_result.get("success", False)),
-        "enabled": bool(bridge_result.get("enabled", enabled)),
+        "widgetCount": int(bridge_result.get("widgetCount", 0)),
         "message": str(bridge_result.get("message", "")),
-        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetPath": str(bridge_result.get("assetPath", asset_path)),
         "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
-        "packagePath": str(bridge_result.get("packagePath", "")),
-        "assetName": str(bridge_result.get("assetName", "")),
-        "widgetName": str(bridge_result.get("widgetName", widget_name)),
-        "duration": float(bridge_result.get("duration", 0.0)),
-        "startScale": float(bridge_result.get("startScale", 0.0)),
-        "oscillationCount": float(bridge_result.get("oscillationCount", 0.0)),
-        "pivotX": float(bridge_result.get("pivotX", 0.0)),
-        "pivotY": float(bridge_result.get("pivotY", 0.0)),
+        "rootWidgetName": str(bridge_result.get("rootWidgetName", "")),
+        "contentHash": str(bridge_result.get("contentHash", "")),
+        "widgets": [value for value in bridge_result.get("widgets", []) if isinstance(value, dict)],
         "editorReachable": True,
     }
 
     summary = (
-        f"saved={structured_content['saved']} | "
-        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"enabled={structured_content['enabled']} | "
-        f"widget={structured_content['widgetName']} | "
-        f"duration={structured_content['duration']:.3f}s | "
-        f"startScale={structured_content['startScale']:.3f} | "
-        f"oscillations={structured_content['oscillationCount']:.3f} | "
-        f"pivot=({structured_content['pivotX']:.3f}, {structured_content['pivotY']:.3f}) | "
+        f"widgets={structured_content['widgetCount']} | "
+        f"hash={structured_content['contentHash']} | "
+        f"notModified={structured_content['notModified']} | "
         f"{structured_content['message']}"
     )
 
@@ -3229,25 +5643,18 @@ def build_set_popup_open_elastic_scale_tool_success(arguments: dict[str, Any]) -
     }
 
 
-def build_set_popup_open_elastic_scale_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, widget_name: str
-) -> dict[str, Any]:
+def build_get_widget_tree_tool_error(message: str, editor_reachable: bool, asset_path: str) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "saved": False,
+        "notModified": False,
         "success": False,
-        "enabled": False,
+        "widgetCount": 0,
         "message": message,
         "assetPath": asset_path,
         "assetObjectPath": "",
-        "packagePath": "",
-        "assetName": "",
-        "widgetName": widget_name,
-        "duration": 0.0,
-        "startScale": 0.0,
-        "oscillationCount": 0.0,
-        "pivotX": 0.0,
-        "pivotY": 0.0,
+        "rootWidgetName": "",
+        "contentHash": "",
+        "widgets": [],
         "editorReachable": editor_reachable,
     }
 
@@ -3258,60 +5665,66 @@ def build_set_popup_open_elastic_scale_tool_error(
     }
 
 
-def build_scaffold_widget_blueprint_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+def build_set_widget_properties_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
     asset_path = arguments.get("assetPath")
     if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_scaffold_widget_blueprint.assetPath must be a non-empty string.")
-
-    scaffold_type = arguments.get("scaffoldType")
-    if not isinstance(scaffold_type, str) or scaffold_type not in {
-        "popup",
-        "bottom_button_bar",
-        "scroll_uniform_grid_host",
-        "tile_view_host",
-        "tile_view_entry",
-        "item_tile_popup",
-        "item_tile_entry",
-    }:
-        raise JsonRpcError(
-            -32602,
-            (
-                "ue_scaffold_widget_blueprint.scaffoldType must be one of: popup, bottom_button_bar, "
-                "scroll_uniform_grid_host, tile_view_host, tile_view_entry, item_tile_popup, item_tile_entry."
-            ),
-        )
+        raise JsonRpcError(-32602, "ue_set_widget_properties.assetPath must be a non-empty string.")
+
+    entries = arguments.get("entries")
+    if not isinstance(entries, list) or not entries:
+        raise JsonRpcError(-32602, "ue_set_widget_properties.entries must be a non-empty array.")
+
+    for index, entry in enumerate(entries):
+        if not isinstance(entry, dict):
+            raise JsonRpcError(-32602, f"ue_set_widget_properties.entries[{index}] must be an object.")
+        for field_name in ("widget", "propertyPath"):
+            value = entry.get(field_name)
+            if not isinstance(value, str) or not value.strip():
+                raise JsonRpcError(
+                    -32602, f"ue_set_widget_properties.entries[{index}].{field_name} must be a non-empty string."
+                )
+        if not isinstance(entry.get("value"), (str, int, float, bool)):
+            raise JsonRpcError(
+                -32602, f"ue_set_widget_properties.entries[{index}].value must be a string, number or boolean."
+            )
 
     save_asset = arguments.get("saveAsset", True)
     if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_scaffold_widget_blueprint.saveAsset must be a boolean.")
+        raise JsonRpcError(-32602, "ue_set_widget_properties.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_set_widget_properties.saveMode must be immediate or deferred.")
 
     bridge_result = call_ue_bridge(
-        "scaffold_widget_blueprint",
+        "set_widget_properties",
         {
             "assetPath": asset_path,
-            "scaffoldType": scaffold_type,
+            "entries": entries,
             "saveAsset": save_asset,
+            "saveMode": save_mode,
         },
-        timeout_seconds=SCAFFOLD_WIDGET_BLUEPRINT_TIMEOUT_SECONDS,
+        timeout_seconds=SET_WIDGET_PROPERTIES_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "changed": bool(bridge_result.get("changed", False)),
         "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
+        "entryCount": int(bridge_result.get("entryCount", 0)),
+        "changedCount": int(bridge_result.get("changedCount", 0)),
+        "unchangedCount": int(bridge_result.get("unchangedCount", 0)),
         "message": str(bridge_result.get("message", "")),
-        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetPath": str(bridge_result.get("assetPath", asset_path)),
         "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
-        "packagePath": str(bridge_result.get("packagePath", "")),
-        "assetName": str(bridge_result.get("assetName", "")),
-        "scaffoldType": str(bridge_result.get("scaffoldType", scaffold_type)),
+        "changes": [str(value) for value in bridge_result.get("changes", [])],
         "editorReachable": True,
     }
 
     summary = (
-        f"saved={structured_content['saved']} | "
-        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"scaffold={structured_content['scaffoldType']} | "
+        f"changed={structured_content['changedCount']} | "
+        f"unchanged={structured_content['unchangedCount']} | "
         f"{structured_content['message']}"
     )
 
@@ -3322,19 +5735,19 @@ def build_scaffold_widget_blueprint_tool_success(arguments: dict[str, Any]) -> d
     }
 
 
-def build_scaffold_widget_blueprint_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, scaffold_type: str
-) -> dict[str, Any]:
+def build_set_widget_properties_tool_error(message: str, editor_reachable: bool, asset_path: str) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
+        "changed": False,
         "saved": False,
         "success": False,
+        "entryCount": 0,
+        "changedCount": 0,
+        "unchangedCount": 0,
         "message": message,
         "assetPath": asset_path,
         "assetObjectPath": "",
-        "packagePath": "",
-        "assetName": "",
-        "scaffoldType": scaffold_type,
+        "changes": [],
         "editorReachable": editor_reachable,
     }
 
@@ -3345,54 +5758,72 @@ def build_scaffold_widget_blueprint_tool_error(
     }
 
 
-def build_set_blueprint_class_property_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
-    asset_path = arguments.get("assetPath")
-    if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_set_blueprint_class_property.assetPath must be a non-empty string.")
-
-    property_name = arguments.get("propertyName")
-    if not isinstance(property_name, str) or not property_name.strip():
-        raise JsonRpcError(-32602, "ue_set_blueprint_class_property.propertyName must be a non-empty string.")
+def build_fan_out_widget_edit_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    command = arguments.get("command")
+    if command not in FAN_OUT_WIDGET_EDIT_COMMANDS:
+        raise JsonRpcError(
+            -32602,
+            f"ue_fan_out_widget_edit.command must be one of {', '.join(FAN_OUT_WIDGET_EDIT_COMMANDS)}.",
+        )
 
-    value_class_path = arguments.get("valueClassPath")
-    if not isinstance(value_class_path, str) or not value_class_path.strip():
-        raise JsonRpcError(-32602, "ue_set_blueprint_class_property.valueClassPath must be a non-empty string.")
+    command_arguments = arguments.get("arguments")
+    if not isinstance(command_arguments, dict):
+        raise JsonRpcError(-32602, "ue_fan_out_widget_edit.arguments must be an object.")
+    if "assetPath" in command_arguments or "assetQuery" in command_arguments:
+        raise JsonRpcError(-32602, "ue_fan_out_widget_edit.arguments must not include assetPath or assetQuery.")
+
+    asset_query = arguments.get("assetQuery")
+    if not isinstance(asset_query, dict):
+        raise JsonRpcError(-32602, "ue_fan_out_widget_edit.assetQuery must be an object.")
+    for field_name, value in asset_query.items():
+        if field_name not in ("pathPrefix", "classPath", "namePattern", "parentClass"):
+            raise JsonRpcError(-32602, f"ue_fan_out_widget_edit.assetQuery.{field_name} is not supported.")
+        if not isinstance(value, str) or not value.strip():
+            raise JsonRpcError(-32602, f"ue_fan_out_widget_edit.assetQuery.{field_name} must be a non-empty string.")
+    if not any(asset_query.get(field_name) for field_name in ("pathPrefix", "namePattern", "parentClass")):
+        raise JsonRpcError(
+            -32602, "ue_fan_out_widget_edit.assetQuery needs at least one of pathPrefix, namePattern or parentClass."
+        )
 
     save_asset = arguments.get("saveAsset", True)
     if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_set_blueprint_class_property.saveAsset must be a boolean.")
+        raise JsonRpcError(-32602, "ue_fan_out_widget_edit.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_fan_out_widget_edit.saveMode must be immediate or deferred.")
 
     bridge_result = call_ue_bridge(
-        "set_blueprint_class_property",
+        command,
         {
-            "assetPath": asset_path,
-            "propertyName": property_name,
-            "valueClassPath": value_class_path,
+            **command_arguments,
+            "assetQuery": asset_query,
             "saveAsset": save_asset,
+            "saveMode": save_mode,
         },
-        timeout_seconds=SET_BLUEPRINT_CLASS_PROPERTY_TIMEOUT_SECONDS,
+        timeout_seconds=FAN_OUT_WIDGET_EDIT_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
         "saved": bool(bridge_result.get("saved", False)),
+        "saveQueued": bool(bridge_result.get("saveQueued", False)),
         "success": bool(bridge_result.get("success", False)),
+        "matchedCount": int(bridge_result.get("matchedCount", 0)),
+        "succeededCount": int(bridge_result.get("succeededCount", 0)),
+        "failedCount": int(bridge_result.get("failedCount", 0)),
+        "savedCount": int(bridge_result.get("savedCount", 0)),
         "message": str(bridge_result.get("message", "")),
-        "assetPath": str(bridge_result.get("assetPath", "")),
-        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
-        "packagePath": str(bridge_result.get("packagePath", "")),
-        "assetName": str(bridge_result.get("assetName", "")),
-        "propertyName": str(bridge_result.get("propertyName", property_name)),
-        "valueClassPath": str(bridge_result.get("valueClassPath", "")),
-        "valueClassName": str(bridge_result.get("valueClassName", "")),
+        "command": command,
+        "failedPackages": [str(value) for value in bridge_result.get("failedPackages", [])],
+        "assets": [value for value in bridge_result.get("assets", []) if isinstance(value, dict)],
         "editorReachable": True,
     }
 
     summary = (
-        f"saved={structured_content['saved']} | "
-        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"property={structured_content['propertyName']} | "
-        f"value={structured_content['valueClassPath']} | "
+        f"matched={structured_content['matchedCount']} | "
+        f"succeeded={structured_content['succeededCount']} | "
+        f"failed={structured_content['failedCount']} | "
         f"{structured_content['message']}"
     )
 
@@ -3403,21 +5834,20 @@ def build_set_blueprint_class_property_tool_success(arguments: dict[str, Any]) -
     }
 
 
-def build_set_blueprint_class_property_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, property_name: str, value_class_path: str
-) -> dict[str, Any]:
+def build_fan_out_widget_edit_tool_error(message: str, editor_reachable: bool, command: str) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
         "saved": False,
+        "saveQueued": False,
         "success": False,
+        "matchedCount": 0,
+        "succeededCount": 0,
+        "failedCount": 0,
+        "savedCount": 0,
         "message": message,
-        "assetPath": asset_path,
-        "assetObjectPath": "",
-        "packagePath": "",
-        "assetName": "",
-        "propertyName": property_name,
-        "valueClassPath": value_class_path,
-        "valueClassName": "",
+        "command": command,
+        "failedPackages": [],
+        "assets": [],
         "editorReachable": editor_reachable,
     }
 
@@ -3428,58 +5858,42 @@ def build_set_blueprint_class_property_tool_error(
     }
 
 
-def build_set_widget_image_texture_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
-    asset_path = arguments.get("assetPath")
-    if not isinstance(asset_path, str) or not asset_path.strip():
-        raise JsonRpcError(-32602, "ue_set_widget_image_texture.assetPath must be a non-empty string.")
-
-    widget_name = arguments.get("widgetName")
-    if not isinstance(widget_name, str) or not widget_name.strip():
-        raise JsonRpcError(-32602, "ue_set_widget_image_texture.widgetName must be a non-empty string.")
-
-    texture_asset_path = arguments.get("textureAssetPath")
-    if not isinstance(texture_asset_path, str) or not texture_asset_path.strip():
-        raise JsonRpcError(-32602, "ue_set_widget_image_texture.textureAssetPath must be a non-empty string.")
-
-    match_texture_size = arguments.get("matchTextureSize", False)
-    if not isinstance(match_texture_size, bool):
-        raise JsonRpcError(-32602, "ue_set_widget_image_texture.matchTextureSize must be a boolean.")
+def build_dry_run_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    command = arguments.get("command")
+    if command not in DRY_RUN_COMMANDS:
+        raise JsonRpcError(-32602, f"ue_dry_run.command must be one of {', '.join(DRY_RUN_COMMANDS)}.")
 
-    save_asset = arguments.get("saveAsset", True)
-    if not isinstance(save_asset, bool):
-        raise JsonRpcError(-32602, "ue_set_widget_image_texture.saveAsset must be a boolean.")
+    command_arguments = arguments.get("arguments")
+    if not isinstance(command_arguments, dict):
+        raise JsonRpcError(-32602, "ue_dry_run.arguments must be an object.")
 
     bridge_result = call_ue_bridge(
-        "set_widget_image_texture",
+        command,
         {
-            "assetPath": asset_path,
-            "widgetName": widget_name,
-            "textureAssetPath": texture_asset_path,
-            "matchTextureSize": match_texture_size,
-            "saveAsset": save_asset,
+            **command_arguments,
+            "dryRun": True,
         },
-        timeout_seconds=SET_WIDGET_IMAGE_TEXTURE_TIMEOUT_SECONDS,
+        timeout_seconds=DRY_RUN_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
+        "widgetTreeChecked": bool(bridge_result.get("widgetTreeChecked", False)),
         "message": str(bridge_result.get("message", "")),
-        "assetPath": str(bridge_result.get("assetPath", "")),
+        "command": command,
         "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
-        "packagePath": str(bridge_result.get("packagePath", "")),
-        "assetName": str(bridge_result.get("assetName", "")),
-        "widgetName": str(bridge_result.get("widgetName", widget_name)),
-        "textureAssetPath": str(bridge_result.get("textureAssetPath", "")),
+        "plannedChanges": [str(value) for value in bridge_result.get("plannedChanges", [])],
+        "problems": [str(value) for value in bridge_result.get("problems", [])],
+        "warnings": [str(value) for value in bridge_result.get("warnings", [])],
+        "assets": [value for value in bridge_result.get("assets", []) if isinstance(value, dict)],
         "editorReachable": True,
     }
 
     summary = (
-        f"saved={structured_content['saved']} | "
-        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
-        f"widget={structured_content['widgetName']} | "
-        f"texture={structured_content['textureAssetPath']} | "
+        f"success={structured_content['success']} | "
+        f"planned={len(structured_content['plannedChanges'])} | "
+        f"problems={len(structured_content['problems'])} | "
         f"{structured_content['message']}"
     )
 
@@ -3490,20 +5904,18 @@ def build_set_widget_image_texture_tool_success(arguments: dict[str, Any]) -> di
     }
 
 
-def build_set_widget_image_texture_tool_error(
-    message: str, editor_reachable: bool, asset_path: str, widget_name: str, texture_asset_path: str
-) -> dict[str, Any]:
+def build_dry_run_tool_error(message: str, editor_reachable: bool, command: str) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "saved": False,
         "success": False,
+        "widgetTreeChecked": False,
         "message": message,
-        "assetPath": asset_path,
+        "command": command,
         "assetObjectPath": "",
-        "packagePath": "",
-        "assetName": "",
-        "widgetName": widget_name,
-        "textureAssetPath": texture_asset_path,
+        "plannedChanges": [],
+        "problems": [],
+        "warnings": [],
+        "assets": [],
         "editorReachable": editor_reachable,
     }
 
@@ -3514,36 +5926,29 @@ def build_set_widget_image_texture_tool_error(
     }
 
 
-def build_set_global_default_game_mode_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
-    game_mode_class_path = arguments.get("gameModeClassPath")
-    if not isinstance(game_mode_class_path, str) or not game_mode_class_path.strip():
-        raise JsonRpcError(-32602, "ue_set_global_default_game_mode.gameModeClassPath must be a non-empty string.")
-
-    save_config = arguments.get("saveConfig", True)
-    if not isinstance(save_config, bool):
-        raise JsonRpcError(-32602, "ue_set_global_default_game_mode.saveConfig must be a boolean.")
-
-    bridge_result = call_ue_bridge(
-        "set_global_default_game_mode",
-        {
-            "gameModeClassPath": game_mode_class_path,
-            "saveConfig": save_config,
-        },
-        timeout_seconds=SET_GLOBAL_DEFAULT_GAME_MODE_TIMEOUT_SECONDS,
-    )
-
-    structured_content = {
+def build_working_set_structured_content(bridge_result: dict[str, Any]) -> dict[str, Any]:
+    return {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
+        "capacity": int(bridge_result.get("capacity", 0)),
+        "count": int(bridge_result.get("count", 0)),
+        "pinnedCount": int(bridge_result.get("pinnedCount", 0)),
+        "memoryPressureReleaseCount": int(bridge_result.get("memoryPressureReleaseCount", 0)),
         "message": str(bridge_result.get("message", "")),
-        "gameModeClassPath": str(bridge_result.get("gameModeClassPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "lastReleaseReason": str(bridge_result.get("lastReleaseReason", "")),
+        "entries": [value for value in bridge_result.get("entries", []) if isinstance(value, dict)],
         "editorReachable": True,
     }
 
+
+def build_get_working_set_tool_success() -> dict[str, Any]:
+    bridge_result = call_ue_bridge("get_working_set")
+    structured_content = build_working_set_structured_content(bridge_result)
+
     summary = (
-        f"saved={structured_content['saved']} | "
-        f"gameMode={structured_content['gameModeClassPath']} | "
+        f"count={structured_content['count']}/{structured_content['capacity']} | "
+        f"pinned={structured_content['pinnedCount']} | "
         f"{structured_content['message']}"
     )
 
@@ -3554,15 +5959,40 @@ def build_set_global_default_game_mode_tool_success(arguments: dict[str, Any]) -
     }
 
 
-def build_set_global_default_game_mode_tool_error(
-    message: str, editor_reachable: bool, game_mode_class_path: str
-) -> dict[str, Any]:
+def build_pin_working_set_asset_tool_success(tool_name: str, arguments: dict[str, Any]) -> dict[str, Any]:
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, f"{tool_name}.assetPath must be a non-empty string.")
+
+    command = "pin_working_set_asset" if tool_name == PIN_WORKING_SET_ASSET_TOOL_NAME else "unpin_working_set_asset"
+    bridge_result = call_ue_bridge(command, {"assetPath": asset_path})
+    structured_content = build_working_set_structured_content(bridge_result)
+
+    summary = (
+        f"success={structured_content['success']} | "
+        f"pinned={structured_content['pinnedCount']} | "
+        f"{structured_content['message']}"
+    )
+
+    return {
+        "content": [{"type": "text", "text": summary}],
+        "structuredContent": structured_content,
+        "isError": not structured_content["success"],
+    }
+
+
+def build_working_set_tool_error(message: str, editor_reachable: bool, asset_path: str) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "saved": False,
         "success": False,
+        "capacity": 0,
+        "count": 0,
+        "pinnedCount": 0,
+        "memoryPressureReleaseCount": 0,
         "message": message,
-        "gameModeClassPath": game_mode_class_path,
+        "assetObjectPath": asset_path,
+        "lastReleaseReason": "",
+        "entries": [],
         "editorReachable": editor_reachable,
     }
 
@@ -3573,49 +6003,63 @@ def build_set_global_default_game_mode_tool_error(
     }
 
 
-def build_bootstrap_project_map_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
-    level_file_name = arguments.get("levelFileName", "BasicMap")
-    if not isinstance(level_file_name, str) or not level_file_name.strip():
-        raise JsonRpcError(-32602, "ue_bootstrap_project_map.levelFileName must be a non-empty string.")
+def build_set_widget_invalidation_boundary_tool_success(arguments: dict[str, Any]) -> dict[str, Any]:
+    asset_path = arguments.get("assetPath")
+    if not isinstance(asset_path, str) or not asset_path.strip():
+        raise JsonRpcError(-32602, "ue_set_widget_invalidation_boundary.assetPath must be a non-empty string.")
 
-    directory_path = arguments.get("directoryPath", "/Game/Maps")
-    if not isinstance(directory_path, str) or not directory_path.strip():
-        raise JsonRpcError(-32602, "ue_bootstrap_project_map.directoryPath must be a non-empty string.")
+    widget_name = arguments.get("widgetName")
+    if not isinstance(widget_name, str) or not widget_name.strip():
+        raise JsonRpcError(-32602, "ue_set_widget_invalidation_boundary.widgetName must be a non-empty string.")
 
-    force_create = arguments.get("forceCreate", False)
-    if not isinstance(force_create, bool):
-        raise JsonRpcError(-32602, "ue_bootstrap_project_map.forceCreate must be a boolean.")
+    boundary = arguments.get("boundary")
+    if boundary not in ("invalidation", "retainer", "none"):
+        raise JsonRpcError(
+            -32602, "ue_set_widget_invalidation_boundary.boundary must be invalidation, retainer or none."
+        )
+
+    save_asset = arguments.get("saveAsset", True)
+    if not isinstance(save_asset, bool):
+        raise JsonRpcError(-32602, "ue_set_widget_invalidation_boundary.saveAsset must be a boolean.")
+
+    save_mode = arguments.get("saveMode", "immediate")
+    if save_mode not in ("immediate", "deferred"):
+        raise JsonRpcError(-32602, "ue_set_widget_invalidation_boundary.saveMode must be immediate or deferred.")
 
     bridge_result = call_ue_bridge(
-        "bootstrap_project_map",
+        "set_widget_invalidation_boundary",
         {
-            "levelFileName": level_file_name,
-            "directoryPath": directory_path,
-            "forceCreate": force_create,
+            "assetPath": asset_path,
+            "widgetName": widget_name,
+            "boundary": boundary,
+            "saveAsset": save_asset,
+            "saveMode": save_mode,
         },
-        timeout_seconds=BOOTSTRAP_PROJECT_MAP_TIMEOUT_SECONDS,
+        timeout_seconds=SET_WIDGET_INVALIDATION_BOUNDARY_TIMEOUT_SECONDS,
     )
 
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "bootstrapped": bool(bridge_result.get("bootstrapped", False)),
-        "created": bool(bridge_result.get("created", False)),
-        "forceCreate": bool(bridge_result.get("forceCreate", force_create)),
-        "savedConfig": bool(bridge_result.get("savedConfig", False)),
+        "changed": bool(bridge_result.get("changed", False)),
+        "saved": bool(bridge_result.get("saved", False)),
         "success": bool(bridge_result.get("success", False)),
-        "existingLevelCount": int(bridge_result.get("existingLevelCount", 0)),
         "message": str(bridge_result.get("message", "")),
-        "levelFileName": str(bridge_result.get("levelFileName", level_file_name)),
-        "directoryPath": str(bridge_result.get("directoryPath", directory_path)),
-        "levelAssetPath": str(bridge_result.get("levelAssetPath", "")),
-        "levelObjectPath": str(bridge_result.get("levelObjectPath", "")),
+        "assetPath": str(bridge_result.get("assetPath", "")),
+        "assetObjectPath": str(bridge_result.get("assetObjectPath", "")),
+        "packagePath": str(bridge_result.get("packagePath", "")),
+        "assetName": str(bridge_result.get("assetName", "")),
+        "widgetName": str(bridge_result.get("widgetName", widget_name)),
+        "boundary": str(bridge_result.get("boundary", boundary)),
+        "boundaryWidgetName": str(bridge_result.get("boundaryWidgetName", "")),
         "editorReachable": True,
     }
 
     summary = (
-        f"bootstrapped={structured_content['bootstrapped']} | "
-        f"forceCreate={structured_content['forceCreate']} | "
-        f"level={structured_content['levelAssetPath'] or structured_content['levelObjectPath']} | "
+        f"changed={structured_content['changed']} | "
+        f"saved={structured_content['saved']} | "
+        f"asset={structured_content['assetObjectPath'] or structured_content['assetPath']} | "
+        f"widget={structured_content['widgetName']} | "
+        f"boundary={structured_content['boundary']} | "
         f"{structured_content['message']}"
     )
 
@@ -3626,22 +6070,22 @@ def build_bootstrap_project_map_tool_success(arguments: dict[str, Any]) -> dict[
     }
 
 
-def build_bootstrap_project_map_tool_error(
-    message: str, editor_reachable: bool, level_file_name: str, directory_path: str, force_create: bool
+def build_set_widget_invalidation_boundary_tool_error(
+    message: str, editor_reachable: bool, asset_path: str, widget_name: str, boundary: str
 ) -> dict[str, Any]:
     structured_content = {
         "mcpProtocolVersion": MCP_PROTOCOL_VERSION,
-        "bootstrapped": False,
-        "created": False,
-        "forceCreate": force_create,
-        "savedConfig": False,
+        "changed": False,
+        "saved": False,
         "success": False,
-        "existingLevelCount": 0,
         "message": message,
-        "levelFileName": level_file_name,
-        "directoryPath": directory_path,
-        "levelAssetPath": "",
-        "levelObjectPath": "",
+        "assetPath": asset_path,
+        "assetObjectPath": "",
+        "packagePath": "",
+        "assetName": "",
+        "widgetName": widget_name,
+        "boundary": boundary,
+        "boundaryWidgetName": "",
         "editorReachable": editor_reachable,
     }
 
@@ -3685,6 +6129,7 @@ def handle_initialize(message_id: Any, params: Any) -> dict[str, Any]:
                 "ue_configure_tile_view to assign an entry widget class and layout to a TileView, "
                 "ue_reorder_widget_child to reorder a widget inside its current parent in a Widget Blueprint, "
                 "ue_remove_widget to remove a widget from a Widget Blueprint, "
+                "ue_set_widget_invalidation_boundary to wrap or unwrap a widget in an InvalidationBox or RetainerBox, "
                 "ue_set_widget_background_blur to convert/configure a widget as a BackgroundBlur panel, "
                 "ue_set_widget_corner_radius to set rounded corners on supported panel widgets, "
                 "ue_set_widget_panel_color to set RGBA color on supported panel widgets, "
@@ -3728,6 +6173,20 @@ def handle_tools_list(message_id: Any) -> dict[str, Any]:
                 build_set_widget_image_texture_tool_definition(),
                 build_set_global_default_game_mode_tool_definition(),
                 build_bootstrap_project_map_tool_definition(),
+                build_flush_saves_tool_definition(),
+                build_get_save_queue_status_tool_definition(),
+                build_query_assets_tool_definition(),
+                build_apply_texture_profile_tool_definition(),
+                build_pack_icon_atlas_tool_definition(),
+                build_apply_widget_tree_tool_definition(),
+                build_get_widget_tree_tool_definition(),
+                build_set_widget_properties_tool_definition(),
+                build_fan_out_widget_edit_tool_definition(),
+                build_dry_run_tool_definition(),
+                build_get_working_set_tool_definition(),
+                build_pin_working_set_asset_tool_definition(PIN_WORKING_SET_ASSET_TOOL_NAME),
+                build_pin_working_set_asset_tool_definition(UNPIN_WORKING_SET_ASSET_TOOL_NAME),
+                build_set_widget_invalidation_boundary_tool_definition(),
             ]
         },
     )
@@ -4215,6 +6674,122 @@ def handle_tools_call(message_id: Any, params: Any) -> dict[str, Any]:
             )
         return make_response(message_id, result)
 
+    if tool_name == FLUSH_SAVES_TOOL_NAME:
+        try:
+            result = build_flush_saves_tool_success()
+        except UeBridgeError as exc:
+            result = build_flush_saves_tool_error(str(exc), exc.editor_reachable)
+        return make_response(message_id, result)
+
+    if tool_name == GET_SAVE_QUEUE_STATUS_TOOL_NAME:
+        try:
+            result = build_get_save_queue_status_tool_success()
+        except UeBridgeError as exc:
+            result = build_get_save_queue_status_tool_error(str(exc), exc.editor_reachable)
+        return make_response(message_id, result)
+
+    if tool_name == QUERY_ASSETS_TOOL_NAME:
+        try:
+            result = build_query_assets_tool_success(tool_arguments)
+        except UeBridgeError as exc:
+            result = build_query_assets_tool_error(str(exc), exc.editor_reachable)
+        return make_response(message_id, result)
+
+    if tool_name == APPLY_TEXTURE_PROFILE_TOOL_NAME:
+        path_prefix = tool_arguments.get("pathPrefix", "")
+        import_profile = tool_arguments.get("importProfile", "")
+        try:
+            result = build_apply_texture_profile_tool_success(tool_arguments)
+        except UeBridgeError as exc:
+            result = build_apply_texture_profile_tool_error(
+                str(exc),
+                exc.editor_reachable,
+                str(path_prefix or ""),
+                str(import_profile or ""),
+            )
+        return make_response(message_id, result)
+
+    if tool_name == PACK_ICON_ATLAS_TOOL_NAME:
+        atlas_asset_path = tool_arguments.get("atlasAssetPath", "")
+        try:
+            result = build_pack_icon_atlas_tool_success(tool_arguments)
+        except UeBridgeError as exc:
+            result = build_pack_icon_atlas_tool_error(
+                str(exc),
+                exc.editor_reachable,
+                str(atlas_asset_path or ""),
+            )
+        return make_response(message_id, result)
+
+    if tool_name == APPLY_WIDGET_TREE_TOOL_NAME:
+        asset_path = tool_arguments.get("assetPath", "")
+        try:
+            result = build_apply_widget_tree_tool_success(tool_arguments)
+        except UeBridgeError as exc:
+            result = build_apply_widget_tree_tool_error(str(exc), exc.editor_reachable, str(asset_path or ""))
+        return make_response(message_id, result)
+
+    if tool_name == GET_WIDGET_TREE_TOOL_NAME:
+        asset_path = tool_arguments.get("assetPath", "")
+        try:
+            result = build_get_widget_tree_tool_success(tool_arguments)
+        except UeBridgeError as exc:
+            result = build_get_widget_tree_tool_error(str(exc), exc.editor_reachable, str(asset_path or ""))
+        return make_response(message_id, result)
+
+    if tool_name == SET_WIDGET_PROPERTIES_TOOL_NAME:
+        asset_path = tool_arguments.get("assetPath", "")
+        try:
+            result = build_set_widget_properties_tool_success(tool_arguments)
+        except UeBridgeError as exc:
+            result = build_set_widget_properties_tool_error(str(exc), exc.editor_reachable, str(asset_path or ""))
+        return make_response(message_id, result)
+
+    if tool_name == FAN_OUT_WIDGET_EDIT_TOOL_NAME:
+        command = tool_arguments.get("command", "")
+        try:
+            result = build_fan_out_widget_edit_tool_success(tool_arguments)
+        except UeBridgeError as exc:
+            result = build_fan_out_widget_edit_tool_error(str(exc), exc.editor_reachable, str(command or ""))
+        return make_response(message_id, result)
+
+    if tool_name == DRY_RUN_TOOL_NAME:
+        command = tool_arguments.get("command", "")
+        try:
+            result = build_dry_run_tool_success(tool_arguments)
+        except UeBridgeError as exc:
+            result = build_dry_run_tool_error(str(exc), exc.editor_reachable, str(command or ""))
+        return make_response(message_id, result)
+
+    if tool_name == GET_WORKING_SET_TOOL_NAME:
+        try:
+            result = build_get_working_set_tool_success()
+        except UeBridgeError as exc:
+            result = build_working_set_tool_error(str(exc), exc.editor_reachable, "")
+        return make_response(message_id, result)
+
+    if tool_name in (PIN_WORKING_SET_ASSET_TOOL_NAME, UNPIN_WORKING_SET_ASSET_TOOL_NAME):
+        try:
+            result = build_pin_working_set_asset_tool_success(tool_name, tool_arguments)
+        except UeBridgeError as exc:
+            result = build_working_set_tool_error(
+                str(exc), exc.editor_reachable, str(tool_arguments.get("assetPath", ""))
+            )
+        return make_response(message_id, result)
+
+    if tool_name == SET_WIDGET_INVALIDATION_BOUNDARY_TOOL_NAME:
+        try:
+            result = build_set_widget_invalidation_boundary_tool_success(tool_arguments)
+        except UeBridgeError as exc:
+            result = build_set_widget_invalidation_boundary_tool_error(
+                str(exc),
+                exc.editor_reachable,
+                str(tool_arguments.get("assetPath", "")),
+                str(tool_arguments.get("widgetName", "")),
+                str(tool_arguments.get("boundary", "")),
+            )
+        return make_response(message_id, result)
+
     raise JsonRpcError(-32602, f"Unknown tool: {tool_name!r}")
 
 
@@ -16,6 +16,7 @@ public class OctoMCP : ModuleRules
 				"Engine",
 				"EngineSettings",
 				"HTTPServer",
+				"ImageCore",
 				"Json",
 				"Projects",
 				"UMG",
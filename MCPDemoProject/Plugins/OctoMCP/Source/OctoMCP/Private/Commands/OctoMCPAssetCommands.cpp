@@ -142,10 +142,13 @@
 	TSharedRef<FJsonObject> FOctoMCPModule::BuildCreateWidgetBlueprintObject(
 		const FString& AssetPath,
 		const FString& ParentClassPath,
+		const FString& ScaffoldType,
+		const FString& InvalidationBoundary,
 		const bool bSaveAsset) const
 	{
-		const FCreateWidgetBlueprintResult CreateResult =
-			CreateWidgetBlueprintAsset(AssetPath, ParentClassPath, bSaveAsset);
+		const FCreateWidgetBlueprintResult CreateResult = ScaffoldType.IsEmpty()
+			? CreateWidgetBlueprintAsset(AssetPath, ParentClassPath, bSaveAsset)
+			: CreateWidgetBlueprintFromScaffoldTemplate(AssetPath, ParentClassPath, ScaffoldType, InvalidationBoundary, bSaveAsset);
 
 		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
 		ResultObject->SetBoolField(TEXT("created"), CreateResult.bCreated);
@@ -158,6 +161,10 @@
 		ResultObject->SetStringField(TEXT("assetName"), CreateResult.AssetName);
 		ResultObject->SetStringField(TEXT("parentClassPath"), CreateResult.ParentClassPath);
 		ResultObject->SetStringField(TEXT("parentClassName"), CreateResult.ParentClassName);
+		ResultObject->SetStringField(TEXT("scaffoldType"), CreateResult.ScaffoldType);
+		ResultObject->SetBoolField(TEXT("fromTemplate"), CreateResult.bFromTemplate);
+		ResultObject->SetBoolField(TEXT("templateCreated"), CreateResult.bTemplateCreated);
+		ResultObject->SetStringField(TEXT("templateAssetPath"), CreateResult.TemplateAssetPath);
 		return ResultObject;
 	}
 
@@ -513,7 +520,7 @@
 			return nullptr;
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr)
 		{
 			OutError = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
@@ -679,6 +686,40 @@
 		return true;
 	}
 
+	bool FOctoMCPModule::SetObjectPropertyValue(
+		UClass* const OwnerClass,
+		UObject* const ObjectInstance,
+		const TCHAR* PropertyName,
+		UObject* const Value,
+		FString& OutError) const
+	{
+		check(OwnerClass != nullptr);
+		check(ObjectInstance != nullptr);
+
+		FObjectProperty* const Property = CastField<FObjectProperty>(OwnerClass->FindPropertyByName(*FString(PropertyName)));
+		if (Property == nullptr)
+		{
+			OutError = FString::Printf(
+				TEXT("Object property %s was not found on %s."),
+				PropertyName,
+				*OwnerClass->GetPathName());
+			return false;
+		}
+
+		if (Value != nullptr && Property->PropertyClass != nullptr && !Value->IsA(Property->PropertyClass))
+		{
+			OutError = FString::Printf(
+				TEXT("Object %s is not compatible with property %s on %s."),
+				*Value->GetPathName(),
+				PropertyName,
+				*OwnerClass->GetPathName());
+			return false;
+		}
+
+		Property->SetObjectPropertyValue_InContainer(ObjectInstance, Value);
+		return true;
+	}
+
 	bool FOctoMCPModule::SetNamePropertyValue(
 		UClass* const OwnerClass,
 		UObject* const ObjectInstance,
@@ -768,6 +809,150 @@
 		return false;
 	}
 
+	bool FOctoMCPModule::ResolvePropertyPath(
+		const UStruct* const OwnerStruct,
+		const FString& PropertyPath,
+		FOctoMCPResolvedPropertyPath& OutResolvedPath,
+		FString& OutError) const
+	{
+		check(OwnerStruct != nullptr);
+
+		const TPair<TWeakObjectPtr<const UStruct>, FString> CacheKey(OwnerStruct, PropertyPath);
+		if (const FOctoMCPResolvedPropertyPath* const CachedPath = ResolvedPropertyPathCache.Find(CacheKey))
+		{
+			OutResolvedPath = *CachedPath;
+			return true;
+		}
+
+		TArray<FString> Segments;
+		PropertyPath.ParseIntoArray(Segments, TEXT("."), true);
+		if (Segments.IsEmpty())
+		{
+			OutError = TEXT("Property path must not be empty.");
+			return false;
+		}
+
+		OutResolvedPath.PropertyChain.Reset();
+
+		// Blueprint-owned properties are recreated on every compile, so only paths made entirely of
+		// native properties are kept; anything else is resolved again on the next call.
+		bool bCacheable = true;
+		const UStruct* CurrentStruct = OwnerStruct;
+		for (int32 SegmentIndex = 0; SegmentIndex < Segments.Num(); ++SegmentIndex)
+		{
+			FProperty* const Property = FindFProperty<FProperty>(CurrentStruct, *Segments[SegmentIndex]);
+			if (Property == nullptr)
+			{
+				OutError = FString::Printf(
+					TEXT("Property %s was not found on %s."),
+					*Segments[SegmentIndex],
+					*CurrentStruct->GetPathName());
+				return false;
+			}
+
+			const UClass* const OwnerClass = Property->GetOwnerClass();
+			const UScriptStruct* const OwnerScriptStruct = Cast<UScriptStruct>(Property->GetOwnerStruct());
+			const bool bNativeOwner =
+				(OwnerClass != nullptr && OwnerClass->HasAnyClassFlags(CLASS_Native))
+				|| (OwnerScriptStruct != nullptr && (OwnerScriptStruct->StructFlags & STRUCT_Native) != 0);
+			bCacheable &= bNativeOwner;
+
+			OutResolvedPath.PropertyChain.Add(Property);
+			if (SegmentIndex + 1 < Segments.Num())
+			{
+				const FStructProperty* const StructProperty = CastField<FStructProperty>(Property);
+				if (StructProperty == nullptr)
+				{
+					OutError = FString::Printf(
+						TEXT("Property path %s: %s is not a struct property on %s."),
+						*PropertyPath,
+						*Segments[SegmentIndex],
+						*CurrentStruct->GetPathName());
+					return false;
+				}
+
+				CurrentStruct = StructProperty->Struct;
+			}
+		}
+
+		if (bCacheable)
+		{
+			ResolvedPropertyPathCache.Add(CacheKey, OutResolvedPath);
+		}
+
+		return true;
+	}
+
+	bool FOctoMCPModule::ParsePropertyValueText(
+		const UStruct* const OwnerStruct,
+		UObject* const ImportOwner,
+		const FString& PropertyPath,
+		const FString& ValueText,
+		FOctoMCPParsedPropertyValue& OutParsedValue,
+		FString& OutError) const
+	{
+		check(OwnerStruct != nullptr);
+		check(OutParsedValue.Value == nullptr);
+
+		if (!ResolvePropertyPath(OwnerStruct, PropertyPath, OutParsedValue.ResolvedPath, OutError))
+		{
+			return false;
+		}
+
+		FProperty* const Property = OutParsedValue.ResolvedPath.PropertyChain.Last();
+
+		// Parse into scratch storage first so an unchanged value never dirties the object.
+		void* const ScratchValue = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+		Property->InitializeValue(ScratchValue);
+
+		const TCHAR* const ImportEnd = Property->ImportText_Direct(*ValueText, ScratchValue, ImportOwner, PPF_None);
+		if (ImportEnd == nullptr)
+		{
+			Property->DestroyValue(ScratchValue);
+			FMemory::Free(ScratchValue);
+			OutError = FString::Printf(
+				TEXT("Could not parse value \"%s\" for property %s on %s."),
+				*ValueText,
+				*PropertyPath,
+				*OwnerStruct->GetPathName());
+			return false;
+		}
+
+		OutParsedValue.PropertyPath = PropertyPath;
+		OutParsedValue.Value = ScratchValue;
+		return true;
+	}
+
+	bool FOctoMCPModule::ApplyParsedPropertyValue(
+		UObject* const ObjectInstance,
+		const FOctoMCPParsedPropertyValue& ParsedValue) const
+	{
+		check(ObjectInstance != nullptr);
+		check(ParsedValue.Value != nullptr);
+
+		void* CurrentValue = ObjectInstance;
+		for (const FProperty* const Property : ParsedValue.ResolvedPath.PropertyChain)
+		{
+			CurrentValue = Property->ContainerPtrToValuePtr<void>(CurrentValue);
+		}
+
+		FProperty* const MemberProperty = ParsedValue.ResolvedPath.PropertyChain[0];
+		FProperty* const Property = ParsedValue.ResolvedPath.PropertyChain.Last();
+		if (Property->Identical(CurrentValue, ParsedValue.Value, PPF_None))
+		{
+			return false;
+		}
+
+		ObjectInstance->SetFlags(RF_Transactional);
+		ObjectInstance->Modify();
+		Property->CopyCompleteValue(CurrentValue, ParsedValue.Value);
+
+		FPropertyChangedEvent PropertyChangedEvent(Property, EPropertyChangeType::ValueSet);
+		PropertyChangedEvent.SetActiveMemberProperty(MemberProperty);
+		ObjectInstance->PostEditChangeProperty(PropertyChangedEvent);
+		return true;
+	}
+
 	bool FOctoMCPModule::ParseOrientationValue(
 		const FString& InOrientation,
 		EOrientation& OutOrientation,
@@ -803,17 +988,76 @@
 		return false;
 	}
 
+	bool FOctoMCPModule::ResolveTextureImportProfile(
+		const FString& InProfileName,
+		FOctoMCPTextureImportProfile& OutProfile,
+		FString& OutError) const
+	{
+		const FString ProfileName = InProfileName.TrimStartAndEnd().ToLower();
+
+		OutProfile = FOctoMCPTextureImportProfile();
+		OutProfile.Name = ProfileName;
+
+		if (ProfileName == TEXT("ui_icon"))
+		{
+			OutProfile.MaxTextureSize = 256;
+			return true;
+		}
+
+		if (ProfileName == TEXT("ui_image"))
+		{
+			OutProfile.MaxTextureSize = 2048;
+			return true;
+		}
+
+		OutError = FString::Printf(
+			TEXT("Unsupported texture import profile %s. Expected ui_icon or ui_image."),
+			*InProfileName);
+		return false;
+	}
+
+	bool FOctoMCPModule::ApplyTextureImportProfile(
+		UTexture2D* const Texture,
+		const FOctoMCPTextureImportProfile& Profile) const
+	{
+		check(Texture != nullptr);
+
+		if (Texture->LODGroup == Profile.LODGroup
+			&& Texture->MipGenSettings == Profile.MipGenSettings
+			&& Texture->CompressionSettings == Profile.CompressionSettings
+			&& Texture->MaxTextureSize == Profile.MaxTextureSize
+			&& Texture->NeverStream == Profile.bNeverStream
+			&& Texture->SRGB == Profile.bSRGB)
+		{
+			return false;
+		}
+
+		Texture->Modify();
+		Texture->PreEditChange(nullptr);
+		Texture->LODGroup = Profile.LODGroup;
+		Texture->MipGenSettings = Profile.MipGenSettings;
+		Texture->CompressionSettings = Profile.CompressionSettings;
+		Texture->MaxTextureSize = Profile.MaxTextureSize;
+		Texture->NeverStream = Profile.bNeverStream;
+		Texture->SRGB = Profile.bSRGB;
+		Texture->PostEditChange();
+		return true;
+	}
+
 	TSharedRef<FJsonObject> FOctoMCPModule::BuildImportTextureAssetObject(
 		const FString& SourceFilePath,
 		const FString& AssetPath,
+		const FString& ImportProfile,
 		const bool bReplaceExisting,
 		const bool bSaveAsset) const
 	{
 		const FImportTextureAssetResult ImportResult =
-			ImportTextureAsset(SourceFilePath, AssetPath, bReplaceExisting, bSaveAsset);
+			ImportTextureAsset(SourceFilePath, AssetPath, ImportProfile, bReplaceExisting, bSaveAsset);
 
 		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
 		ResultObject->SetBoolField(TEXT("imported"), ImportResult.bImported);
+		ResultObject->SetBoolField(TEXT("skippedUnchanged"), ImportResult.bSkippedUnchanged);
+		ResultObject->SetBoolField(TEXT("profileApplied"), ImportResult.bProfileApplied);
 		ResultObject->SetBoolField(TEXT("saved"), ImportResult.bSaved);
 		ResultObject->SetBoolField(TEXT("success"), ImportResult.bSuccess);
 		ResultObject->SetStringField(TEXT("message"), ImportResult.Message);
@@ -822,12 +1066,14 @@
 		ResultObject->SetStringField(TEXT("assetObjectPath"), ImportResult.AssetObjectPath);
 		ResultObject->SetStringField(TEXT("packagePath"), ImportResult.PackagePath);
 		ResultObject->SetStringField(TEXT("assetName"), ImportResult.AssetName);
+		ResultObject->SetStringField(TEXT("importProfile"), ImportResult.ImportProfile);
 		return ResultObject;
 	}
 
 	FImportTextureAssetResult FOctoMCPModule::ImportTextureAsset(
 		const FString& InSourceFilePath,
 		const FString& InAssetPath,
+		const FString& InImportProfile,
 		const bool bReplaceExisting,
 		const bool bSaveAsset) const
 	{
@@ -846,9 +1092,22 @@
 			return Result;
 		}
 
+		FString ErrorMessage;
+		FOctoMCPTextureImportProfile ImportProfile;
+		const bool bHasImportProfile = !InImportProfile.TrimStartAndEnd().IsEmpty();
+		if (bHasImportProfile)
+		{
+			if (!ResolveTextureImportProfile(InImportProfile, ImportProfile, ErrorMessage))
+			{
+				Result.Message = ErrorMessage;
+				return Result;
+			}
+
+			Result.ImportProfile = ImportProfile.Name;
+		}
+
 		FString AssetPackageName;
 		FString AssetObjectPath;
-		FString ErrorMessage;
 		if (!NormalizeWidgetBlueprintAssetPath(
 				InAssetPath,
 				AssetPackageName,
@@ -886,55 +1145,90 @@
 			return Result;
 		}
 
-		const FString FileExtension = FPaths::GetExtension(Result.SourceFilePath);
-		if (FileExtension.IsEmpty())
+		FMD5Hash SourceFileHash;
 		{
-			Result.Message = FString::Printf(TEXT("Could not determine file extension: %s"), *Result.SourceFilePath);
-			return Result;
+			FMD5 SourceFileMD5;
+			SourceFileMD5.Update(SourceFileData.GetData(), SourceFileData.Num());
+			SourceFileHash.Set(SourceFileMD5);
 		}
 
-		UTextureFactory* const TextureFactory = NewObject<UTextureFactory>();
-		TextureFactory->AddToRoot();
-		UTextureFactory::SuppressImportOverwriteDialog(bReplaceExisting);
+		// AssetImportData stores the MD5 of the file it was last imported from, so an identical
+		// source can skip the factory, the re-compression and the save entirely.
+		UTexture2D* TargetTexture = ExistingTexture;
+		Result.bSkippedUnchanged = ExistingTexture != nullptr
+			&& ExistingTexture->AssetImportData != nullptr
+			&& ExistingTexture->AssetImportData->SourceData.SourceFiles.Num() > 0
+			&& ExistingTexture->AssetImportData->SourceData.SourceFiles[0].FileHash == SourceFileHash;
 
-		const uint8* TextureDataStart = SourceFileData.GetData();
-		UObject* const ImportedObject = TextureFactory->FactoryCreateBinary(
-			UTexture2D::StaticClass(),
-			TexturePackage,
-			*Result.AssetName,
-			RF_Standalone | RF_Public,
-			nullptr,
-			*FileExtension,
-			TextureDataStart,
-			TextureDataStart + SourceFileData.Num(),
-			GWarn);
+		if (!Result.bSkippedUnchanged)
+		{
+			const FString FileExtension = FPaths::GetExtension(Result.SourceFilePath);
+			if (FileExtension.IsEmpty())
+			{
+				Result.Message = FString::Printf(TEXT("Could not determine file extension: %s"), *Result.SourceFilePath);
+				return Result;
+			}
 
-		TextureFactory->RemoveFromRoot();
+			UTextureFactory* const TextureFactory = NewObject<UTextureFactory>();
+			TextureFactory->AddToRoot();
+			UTextureFactory::SuppressImportOverwriteDialog(bReplaceExisting);
+
+			const uint8* TextureDataStart = SourceFileData.GetData();
+			UObject* const ImportedObject = TextureFactory->FactoryCreateBinary(
+				UTexture2D::StaticClass(),
+				TexturePackage,
+				*Result.AssetName,
+				RF_Standalone | RF_Public,
+				nullptr,
+				*FileExtension,
+				TextureDataStart,
+				TextureDataStart + SourceFileData.Num(),
+				GWarn);
+
+			TextureFactory->RemoveFromRoot();
+
+			UTexture2D* const ImportedTexture = Cast<UTexture2D>(ImportedObject);
+			if (ImportedTexture == nullptr)
+			{
+				Result.Message = FString::Printf(
+					TEXT("Failed to import %s as a texture asset."),
+					*Result.SourceFilePath);
+				return Result;
+			}
 
-		UTexture2D* const ImportedTexture = Cast<UTexture2D>(ImportedObject);
-		if (ImportedTexture == nullptr)
-		{
-			Result.Message = FString::Printf(
-				TEXT("Failed to import %s as a texture asset."),
-				*Result.SourceFilePath);
-			return Result;
+			Result.bImported = true;
+			Result.AssetPath = ImportedTexture->GetOutermost()->GetName();
+			Result.PackagePath = FPackageName::GetLongPackagePath(Result.AssetPath);
+			Result.AssetName = FPackageName::GetLongPackageAssetName(Result.AssetPath);
+			TargetTexture = ImportedTexture;
+
+			if (ImportedTexture->AssetImportData != nullptr)
+			{
+				ImportedTexture->AssetImportData->Update(
+					IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*Result.SourceFilePath));
+			}
+
+			if (ExistingTexture == nullptr)
+			{
+				FAssetRegistryModule::AssetCreated(ImportedTexture);
+			}
 		}
 
-		Result.bImported = true;
-		Result.AssetObjectPath = ImportedTexture->GetPathName();
-		Result.AssetPath = ImportedTexture->GetOutermost()->GetName();
-		Result.PackagePath = FPackageName::GetLongPackagePath(Result.AssetPath);
-		Result.AssetName = FPackageName::GetLongPackageAssetName(Result.AssetPath);
+		Result.AssetObjectPath = TargetTexture->GetPathName();
 
-		if (ImportedTexture->AssetImportData != nullptr)
+		if (bHasImportProfile)
 		{
-			ImportedTexture->AssetImportData->Update(
-				IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*Result.SourceFilePath));
+			Result.bProfileApplied = ApplyTextureImportProfile(TargetTexture, ImportProfile);
 		}
 
-		if (ExistingTexture == nullptr)
+		if (Result.bSkippedUnchanged && !Result.bProfileApplied)
 		{
-			FAssetRegistryModule::AssetCreated(ImportedTexture);
+			Result.bSuccess = true;
+			Result.Message = FString::Printf(
+				TEXT("Skipped re-import of %s because %s is unchanged."),
+				*Result.AssetObjectPath,
+				*Result.SourceFilePath);
+			return Result;
 		}
 
 		TexturePackage->MarkPackageDirty();
@@ -951,7 +1245,7 @@
 				return Result;
 			}
 
-			Result.bSaved = EditorAssetSubsystem->SaveLoadedAsset(ImportedTexture, false);
+			Result.bSaved = EditorAssetSubsystem->SaveLoadedAsset(TargetTexture, false);
 			if (!Result.bSaved)
 			{
 				Result.Message = FString::Printf(
@@ -962,9 +1256,161 @@
 		}
 
 		Result.bSuccess = true;
+		if (Result.bSkippedUnchanged)
+		{
+			Result.Message = FString::Printf(
+				TEXT("Source %s is unchanged; applied import profile %s to %s."),
+				*Result.SourceFilePath,
+				*Result.ImportProfile,
+				*Result.AssetObjectPath);
+		}
+		else
+		{
+			Result.Message = FString::Printf(
+				TEXT("Imported texture %s from %s%s."),
+				*Result.AssetObjectPath,
+				*Result.SourceFilePath,
+				bHasImportProfile ? *FString::Printf(TEXT(" with import profile %s"), *Result.ImportProfile) : TEXT(""));
+		}
+		return Result;
+	}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildApplyTextureProfileObject(
+		const FString& PathPrefix,
+		const FString& ImportProfile,
+		const bool bSaveAsset,
+		const bool bDeferSave) const
+	{
+		const FApplyTextureProfileResult ApplyResult =
+			ApplyTextureProfileToPath(PathPrefix, ImportProfile, bSaveAsset, bDeferSave);
+
+		TArray<TSharedPtr<FJsonValue>> UpdatedAssetValues;
+		for (const FString& UpdatedAsset : ApplyResult.UpdatedAssets)
+		{
+			UpdatedAssetValues.Add(MakeShared<FJsonValueString>(UpdatedAsset));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> FailedAssetValues;
+		for (const FString& FailedAsset : ApplyResult.FailedAssets)
+		{
+			FailedAssetValues.Add(MakeShared<FJsonValueString>(FailedAsset));
+		}
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetBoolField(TEXT("saved"), ApplyResult.bSaved);
+		ResultObject->SetBoolField(TEXT("success"), ApplyResult.bSuccess);
+		ResultObject->SetNumberField(TEXT("matchedCount"), ApplyResult.MatchedCount);
+		ResultObject->SetNumberField(TEXT("updatedCount"), ApplyResult.UpdatedCount);
+		ResultObject->SetNumberField(TEXT("unchangedCount"), ApplyResult.UnchangedCount);
+		ResultObject->SetNumberField(TEXT("failedCount"), ApplyResult.FailedCount);
+		ResultObject->SetStringField(TEXT("message"), ApplyResult.Message);
+		ResultObject->SetStringField(TEXT("pathPrefix"), ApplyResult.PathPrefix);
+		ResultObject->SetStringField(TEXT("importProfile"), ApplyResult.ImportProfile);
+		ResultObject->SetArrayField(TEXT("updatedAssets"), UpdatedAssetValues);
+		ResultObject->SetArrayField(TEXT("failedAssets"), FailedAssetValues);
+		return ResultObject;
+	}
+
+	FApplyTextureProfileResult FOctoMCPModule::ApplyTextureProfileToPath(
+		const FString& InPathPrefix,
+		const FString& InImportProfile,
+		const bool bSaveAsset,
+		const bool bDeferSave) const
+	{
+		FApplyTextureProfileResult Result;
+		Result.PathPrefix = InPathPrefix.TrimStartAndEnd();
+		if (!Result.PathPrefix.StartsWith(TEXT("/")))
+		{
+			Result.Message = FString::Printf(TEXT("pathPrefix must be a package path such as /Game/UI: %s"), *InPathPrefix);
+			return Result;
+		}
+
+		FString ErrorMessage;
+		FOctoMCPTextureImportProfile ImportProfile;
+		if (!ResolveTextureImportProfile(InImportProfile, ImportProfile, ErrorMessage))
+		{
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		Result.ImportProfile = ImportProfile.Name;
+
+		if (!bAssetIndexReady)
+		{
+			Result.Message = TEXT("The asset registry is still scanning; try again once the asset index is ready.");
+			return Result;
+		}
+
+		TArray<FSoftObjectPath> TexturePaths;
+		CollectIndexedAssetPaths(UTexture2D::StaticClass()->GetClassPathName(), Result.PathPrefix, TexturePaths);
+		Result.MatchedCount = TexturePaths.Num();
+
+		TArray<UObject*> UpdatedTextures;
+		for (const FSoftObjectPath& TexturePath : TexturePaths)
+		{
+			UTexture2D* const Texture = Cast<UTexture2D>(TexturePath.TryLoad());
+			if (Texture == nullptr)
+			{
+				Result.FailedAssets.Add(TexturePath.ToString());
+				continue;
+			}
+
+			if (!ApplyTextureImportProfile(Texture, ImportProfile))
+			{
+				++Result.UnchangedCount;
+				continue;
+			}
+
+			Texture->MarkPackageDirty();
+			Result.UpdatedAssets.Add(Texture->GetPathName());
+			UpdatedTextures.Add(Texture);
+		}
+
+		Result.UpdatedCount = Result.UpdatedAssets.Num();
+		Result.FailedCount = Result.FailedAssets.Num();
+
+		if (bSaveAsset && !UpdatedTextures.IsEmpty())
+		{
+			if (bDeferSave)
+			{
+				for (UObject* const UpdatedTexture : UpdatedTextures)
+				{
+					QueueDeferredPackageSave(UpdatedTexture->GetOutermost()->GetName());
+				}
+			}
+			else
+			{
+				UEditorAssetSubsystem* const EditorAssetSubsystem =
+					GEditor != nullptr ? GEditor->GetEditorSubsystem<UEditorAssetSubsystem>() : nullptr;
+				if (EditorAssetSubsystem == nullptr)
+				{
+					Result.Message = FString::Printf(
+						TEXT("Applied profile %s to %d texture(s) but could not access the EditorAssetSubsystem to save them."),
+						*Result.ImportProfile,
+						Result.UpdatedCount);
+					return Result;
+				}
+
+				Result.bSaved = EditorAssetSubsystem->SaveLoadedAssets(UpdatedTextures, true);
+				if (!Result.bSaved)
+				{
+					Result.Message = FString::Printf(
+						TEXT("Applied profile %s to %d texture(s) but failed to save them."),
+						*Result.ImportProfile,
+						Result.UpdatedCount);
+					return Result;
+				}
+			}
+		}
+
+		Result.bSuccess = Result.FailedCount == 0;
 		Result.Message = FString::Printf(
-			TEXT("Imported texture %s from %s."),
-			*Result.AssetObjectPath,
-			*Result.SourceFilePath);
+			TEXT("Applied profile %s under %s: %d updated, %d already matching, %d failed to load%s."),
+			*Result.ImportProfile,
+			*Result.PathPrefix,
+			Result.UpdatedCount,
+			Result.UnchangedCount,
+			Result.FailedCount,
+			bSaveAsset && bDeferSave && Result.UpdatedCount > 0 ? TEXT("; saves queued") : TEXT(""));
 		return Result;
 	}
@@ -0,0 +1,528 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OctoMCPModule.h"
+
+namespace
+{
+	bool DoesFolderOverlapPathPrefix(const FName Folder, const FString& PathPrefix)
+	{
+		const FNameBuilder FolderBuilder(Folder);
+		const FStringView FolderView = FolderBuilder.ToView();
+		if (FolderView.StartsWith(PathPrefix, ESearchCase::IgnoreCase))
+		{
+			return true;
+		}
+
+		// The prefix may point inside this folder, e.g. /Game/UI/Widget/WBP_ against /Game/UI/Widget.
+		return FStringView(PathPrefix).StartsWith(FolderView, ESearchCase::IgnoreCase)
+			&& PathPrefix.Len() > FolderView.Len()
+			&& PathPrefix[FolderView.Len()] == TEXT('/');
+	}
+
+	bool DoesIndexedAssetMatchTags(const FAssetData& AssetData, const TArray<TPair<FName, FString>>& TagFilters)
+	{
+		for (const TPair<FName, FString>& TagFilter : TagFilters)
+		{
+			FString TagValue;
+			if (!AssetData.GetTagValue(TagFilter.Key, TagValue))
+			{
+				return false;
+			}
+
+			if (!TagFilter.Value.IsEmpty()
+				&& TagFilter.Value != TEXT("*")
+				&& !TagValue.Equals(TagFilter.Value, ESearchCase::IgnoreCase))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+	void FOctoMCPModule::StartAssetIndex()
+	{
+		IAssetRegistry& AssetRegistry =
+			FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+		AssetIndexAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FOctoMCPModule::HandleIndexedAssetAdded);
+		AssetIndexRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FOctoMCPModule::HandleIndexedAssetRemoved);
+		AssetIndexRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FOctoMCPModule::HandleIndexedAssetRenamed);
+		AssetIndexUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FOctoMCPModule::HandleIndexedAssetAdded);
+
+		if (AssetRegistry.IsLoadingAssets())
+		{
+			AssetIndexFilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FOctoMCPModule::SeedAssetIndex);
+			return;
+		}
+
+		SeedAssetIndex();
+	}
+
+	void FOctoMCPModule::StopAssetIndex()
+	{
+		if (FModuleManager::Get().IsModuleLoaded(TEXT("AssetRegistry")))
+		{
+			IAssetRegistry& AssetRegistry =
+				FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+			AssetRegistry.OnFilesLoaded().Remove(AssetIndexFilesLoadedHandle);
+			AssetRegistry.OnAssetAdded().Remove(AssetIndexAddedHandle);
+			AssetRegistry.OnAssetRemoved().Remove(AssetIndexRemovedHandle);
+			AssetRegistry.OnAssetRenamed().Remove(AssetIndexRenamedHandle);
+			AssetRegistry.OnAssetUpdated().Remove(AssetIndexUpdatedHandle);
+		}
+
+		AssetIndexFilesLoadedHandle.Reset();
+		AssetIndexAddedHandle.Reset();
+		AssetIndexRemovedHandle.Reset();
+		AssetIndexRenamedHandle.Reset();
+		AssetIndexUpdatedHandle.Reset();
+
+		FRWScopeLock WriteLock(AssetIndexLock, SLT_Write);
+		IndexedAssets.Empty();
+		FreeIndexedAssetSlots.Empty();
+		IndexedAssetSlotByObjectPath.Empty();
+		IndexedAssetSlotsByClass.Empty();
+		IndexedAssetSlotsByPackagePath.Empty();
+		IndexedAssetSlotsByTagKey.Empty();
+		bAssetIndexReady = false;
+	}
+
+	void FOctoMCPModule::SeedAssetIndex()
+	{
+		IAssetRegistry& AssetRegistry =
+			FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		if (AssetIndexFilesLoadedHandle.IsValid())
+		{
+			AssetRegistry.OnFilesLoaded().Remove(AssetIndexFilesLoadedHandle);
+			AssetIndexFilesLoadedHandle.Reset();
+		}
+
+		// The only full enumeration; every later change arrives through the registry delegates.
+		TArray<FAssetData> AllAssets;
+		AssetRegistry.GetAllAssets(AllAssets, true);
+
+		FRWScopeLock WriteLock(AssetIndexLock, SLT_Write);
+		IndexedAssets.Reset(AllAssets.Num());
+		FreeIndexedAssetSlots.Reset();
+		IndexedAssetSlotByObjectPath.Reset();
+		IndexedAssetSlotByObjectPath.Reserve(AllAssets.Num());
+		IndexedAssetSlotsByClass.Reset();
+		IndexedAssetSlotsByPackagePath.Reset();
+		IndexedAssetSlotsByTagKey.Reset();
+
+		for (const FAssetData& AssetData : AllAssets)
+		{
+			AddOrUpdateIndexedAsset(AssetData);
+		}
+
+		bAssetIndexReady = true;
+
+		UE_LOG(LogOctoMCP, Log, TEXT("OctoMCP asset index seeded with %d assets."), IndexedAssetSlotByObjectPath.Num());
+	}
+
+	void FOctoMCPModule::HandleIndexedAssetAdded(const FAssetData& AssetData)
+	{
+		if (!bAssetIndexReady)
+		{
+			return;
+		}
+
+		FRWScopeLock WriteLock(AssetIndexLock, SLT_Write);
+		AddOrUpdateIndexedAsset(AssetData);
+	}
+
+	void FOctoMCPModule::HandleIndexedAssetRemoved(const FAssetData& AssetData)
+	{
+		if (!bAssetIndexReady)
+		{
+			return;
+		}
+
+		FRWScopeLock WriteLock(AssetIndexLock, SLT_Write);
+		RemoveIndexedAsset(AssetData.GetSoftObjectPath());
+	}
+
+	void FOctoMCPModule::HandleIndexedAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+	{
+		if (!bAssetIndexReady)
+		{
+			return;
+		}
+
+		FRWScopeLock WriteLock(AssetIndexLock, SLT_Write);
+		RemoveIndexedAsset(FSoftObjectPath(OldObjectPath));
+		AddOrUpdateIndexedAsset(AssetData);
+	}
+
+	void FOctoMCPModule::AddOrUpdateIndexedAsset(const FAssetData& AssetData)
+	{
+		// Callers hold AssetIndexLock for writing.
+		const FSoftObjectPath ObjectPath = AssetData.GetSoftObjectPath();
+		RemoveIndexedAsset(ObjectPath);
+
+		const int32 Slot = FreeIndexedAssetSlots.IsEmpty()
+			? IndexedAssets.AddDefaulted()
+			: FreeIndexedAssetSlots.Pop(EAllowShrinking::No);
+
+		FOctoMCPIndexedAsset& Entry = IndexedAssets[Slot];
+		Entry.bValid = true;
+		Entry.AssetData = AssetData;
+		Entry.PackageNameString = AssetData.PackageName.ToString();
+		Entry.AssetNameLower = AssetData.AssetName.ToString().ToLower();
+
+		IndexedAssetSlotByObjectPath.Add(ObjectPath, Slot);
+		IndexedAssetSlotsByClass.FindOrAdd(AssetData.AssetClassPath).Add(Slot);
+		IndexedAssetSlotsByPackagePath.FindOrAdd(AssetData.PackagePath).Add(Slot);
+		for (const TPair<FName, FAssetTagValueRef>& Tag : AssetData.TagsAndValues)
+		{
+			IndexedAssetSlotsByTagKey.FindOrAdd(Tag.Key).Add(Slot);
+		}
+		++AssetIndexRevision;
+	}
+
+	void FOctoMCPModule::RemoveIndexedAsset(const FSoftObjectPath& ObjectPath)
+	{
+		// Callers hold AssetIndexLock for writing.
+		int32 Slot = INDEX_NONE;
+		if (!IndexedAssetSlotByObjectPath.RemoveAndCopyValue(ObjectPath, Slot))
+		{
+			return;
+		}
+
+		FOctoMCPIndexedAsset& Entry = IndexedAssets[Slot];
+		if (TSet<int32>* const ClassSlots = IndexedAssetSlotsByClass.Find(Entry.AssetData.AssetClassPath))
+		{
+			ClassSlots->Remove(Slot);
+			if (ClassSlots->IsEmpty())
+			{
+				IndexedAssetSlotsByClass.Remove(Entry.AssetData.AssetClassPath);
+			}
+		}
+
+		if (TSet<int32>* const PathSlots = IndexedAssetSlotsByPackagePath.Find(Entry.AssetData.PackagePath))
+		{
+			PathSlots->Remove(Slot);
+			if (PathSlots->IsEmpty())
+			{
+				IndexedAssetSlotsByPackagePath.Remove(Entry.AssetData.PackagePath);
+			}
+		}
+
+		for (const TPair<FName, FAssetTagValueRef>& Tag : Entry.AssetData.TagsAndValues)
+		{
+			if (TSet<int32>* const TagSlots = IndexedAssetSlotsByTagKey.Find(Tag.Key))
+			{
+				TagSlots->Remove(Slot);
+				if (TagSlots->IsEmpty())
+				{
+					IndexedAssetSlotsByTagKey.Remove(Tag.Key);
+				}
+			}
+		}
+
+		Entry = FOctoMCPIndexedAsset();
+		FreeIndexedAssetSlots.Add(Slot);
+		++AssetIndexRevision;
+	}
+
+	bool FOctoMCPModule::FindIndexedAsset(const FString& AssetObjectPath, FAssetData& OutAssetData) const
+	{
+		const FSoftObjectPath ObjectPath(AssetObjectPath);
+		{
+			FRWScopeLock ReadLock(AssetIndexLock, SLT_ReadOnly);
+			if (bAssetIndexReady)
+			{
+				const int32* const Slot = IndexedAssetSlotByObjectPath.Find(ObjectPath);
+				if (Slot == nullptr)
+				{
+					return false;
+				}
+
+				OutAssetData = IndexedAssets[*Slot].AssetData;
+				return true;
+			}
+		}
+
+		// Until the index is seeded, ask the registry directly. Neither path loads the asset.
+		IAssetRegistry& AssetRegistry =
+			FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		OutAssetData = AssetRegistry.GetAssetByObjectPath(ObjectPath);
+		return OutAssetData.IsValid();
+	}
+
+	void FOctoMCPModule::CollectIndexedAssetPaths(
+		const FTopLevelAssetPath& ClassPath,
+		const FString& PathPrefix,
+		TArray<FSoftObjectPath>& OutObjectPaths) const
+	{
+		OutObjectPaths.Reset();
+
+		FRWScopeLock ReadLock(AssetIndexLock, SLT_ReadOnly);
+		const TSet<int32>* const ClassSlots = IndexedAssetSlotsByClass.Find(ClassPath);
+		if (ClassSlots == nullptr)
+		{
+			return;
+		}
+
+		for (const int32 Slot : *ClassSlots)
+		{
+			const FOctoMCPIndexedAsset& Entry = IndexedAssets[Slot];
+			if (PathPrefix.IsEmpty() || Entry.PackageNameString.StartsWith(PathPrefix, ESearchCase::IgnoreCase))
+			{
+				OutObjectPaths.Add(Entry.AssetData.GetSoftObjectPath());
+			}
+		}
+
+		OutObjectPaths.Sort([](const FSoftObjectPath& Left, const FSoftObjectPath& Right)
+		{
+			return Left.ToString() < Right.ToString();
+		});
+	}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildQueryAssetsObject(
+		const FString& ClassPath,
+		const FString& PathPrefix,
+		const FString& NameContains,
+		const TArray<TPair<FName, FString>>& TagFilters,
+		const int32 Offset,
+		const int32 Limit) const
+	{
+		const FQueryAssetsResult QueryResult =
+			QueryAssets(ClassPath, PathPrefix, NameContains, TagFilters, Offset, Limit);
+
+		TArray<TSharedPtr<FJsonValue>> AssetValues;
+		AssetValues.Reserve(QueryResult.Assets.Num());
+		for (const FQueryAssetsEntry& Asset : QueryResult.Assets)
+		{
+			TSharedRef<FJsonObject> AssetObject = MakeShared<FJsonObject>();
+			AssetObject->SetStringField(TEXT("assetObjectPath"), Asset.AssetObjectPath);
+			AssetObject->SetStringField(TEXT("assetPath"), Asset.AssetPath);
+			AssetObject->SetStringField(TEXT("packagePath"), Asset.PackagePath);
+			AssetObject->SetStringField(TEXT("assetName"), Asset.AssetName);
+			AssetObject->SetStringField(TEXT("classPath"), Asset.ClassPath);
+			AssetObject->SetStringField(TEXT("className"), Asset.ClassName);
+			AssetValues.Add(MakeShared<FJsonValueObject>(AssetObject));
+		}
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetBoolField(TEXT("success"), QueryResult.bSuccess);
+		ResultObject->SetBoolField(TEXT("indexReady"), QueryResult.bIndexReady);
+		ResultObject->SetNumberField(TEXT("totalCount"), QueryResult.TotalCount);
+		ResultObject->SetNumberField(TEXT("returnedCount"), QueryResult.Assets.Num());
+		ResultObject->SetNumberField(TEXT("offset"), QueryResult.Offset);
+		ResultObject->SetNumberField(TEXT("limit"), QueryResult.Limit);
+		ResultObject->SetNumberField(TEXT("indexedAssetCount"), QueryResult.IndexedAssetCount);
+		ResultObject->SetNumberField(TEXT("indexRevision"), static_cast<double>(QueryResult.IndexRevision));
+		ResultObject->SetStringField(TEXT("message"), QueryResult.Message);
+		ResultObject->SetArrayField(TEXT("assets"), AssetValues);
+		return ResultObject;
+	}
+
+	void FOctoMCPModule::CollectMatchingIndexedAssetSlots(
+		const FString& InClassPath,
+		const FString& InPathPrefix,
+		const FString& InNameContains,
+		const TArray<TPair<FName, FString>>& TagFilters,
+		TArray<int32>& OutSlots) const
+	{
+		OutSlots.Reset();
+
+		FString PathPrefix = InPathPrefix.TrimStartAndEnd();
+		while (PathPrefix.Len() > 1 && PathPrefix.EndsWith(TEXT("/")))
+		{
+			PathPrefix.LeftChopInline(1, EAllowShrinking::No);
+		}
+
+		const FString NameContainsLower = InNameContains.TrimStartAndEnd().ToLower();
+		const FString ClassFilter = InClassPath.TrimStartAndEnd();
+
+		// Narrow the candidates through the class and folder maps before touching any entries.
+		TArray<const TSet<int32>*> ClassCandidateSets;
+		TSet<FTopLevelAssetPath> AllowedClasses;
+		int32 ClassCandidateCount = 0;
+		if (!ClassFilter.IsEmpty())
+		{
+			const bool bIsFullClassPath = ClassFilter.StartsWith(TEXT("/"));
+			const FName ClassShortName(*ClassFilter);
+			for (const TPair<FTopLevelAssetPath, TSet<int32>>& ClassEntry : IndexedAssetSlotsByClass)
+			{
+				const bool bMatches = bIsFullClassPath
+					? ClassEntry.Key.ToString().Equals(ClassFilter, ESearchCase::IgnoreCase)
+					: ClassEntry.Key.GetAssetName() == ClassShortName;
+				if (bMatches)
+				{
+					ClassCandidateSets.Add(&ClassEntry.Value);
+					AllowedClasses.Add(ClassEntry.Key);
+					ClassCandidateCount += ClassEntry.Value.Num();
+				}
+			}
+		}
+
+		TArray<const TSet<int32>*> PathCandidateSets;
+		int32 PathCandidateCount = 0;
+		if (!PathPrefix.IsEmpty())
+		{
+			for (const TPair<FName, TSet<int32>>& PathEntry : IndexedAssetSlotsByPackagePath)
+			{
+				if (DoesFolderOverlapPathPrefix(PathEntry.Key, PathPrefix))
+				{
+					PathCandidateSets.Add(&PathEntry.Value);
+					PathCandidateCount += PathEntry.Value.Num();
+				}
+			}
+		}
+
+		// Every tag filter requires its tag to exist, so the rarest filtered tag bounds the candidates. A tag no
+		// indexed asset carries leaves the candidate set empty.
+		TArray<const TSet<int32>*> TagCandidateSets;
+		int32 TagCandidateCount = 0;
+		if (!TagFilters.IsEmpty())
+		{
+			const TSet<int32>* RarestTagSlots = nullptr;
+			bool bAllTagsIndexed = true;
+			for (const TPair<FName, FString>& TagFilter : TagFilters)
+			{
+				const TSet<int32>* const TagSlots = IndexedAssetSlotsByTagKey.Find(TagFilter.Key);
+				if (TagSlots == nullptr)
+				{
+					bAllTagsIndexed = false;
+					break;
+				}
+
+				if (RarestTagSlots == nullptr || TagSlots->Num() < RarestTagSlots->Num())
+				{
+					RarestTagSlots = TagSlots;
+				}
+			}
+
+			if (bAllTagsIndexed && RarestTagSlots != nullptr)
+			{
+				TagCandidateSets.Add(RarestTagSlots);
+				TagCandidateCount = RarestTagSlots->Num();
+			}
+		}
+
+		const auto MatchesRemainingFilters = [&](const FOctoMCPIndexedAsset& Entry) -> bool
+		{
+			if (!ClassFilter.IsEmpty() && !AllowedClasses.Contains(Entry.AssetData.AssetClassPath))
+			{
+				return false;
+			}
+
+			if (!PathPrefix.IsEmpty() && !Entry.PackageNameString.StartsWith(PathPrefix, ESearchCase::IgnoreCase))
+			{
+				return false;
+			}
+
+			if (!NameContainsLower.IsEmpty() && !Entry.AssetNameLower.Contains(NameContainsLower, ESearchCase::CaseSensitive))
+			{
+				return false;
+			}
+
+			return TagFilters.IsEmpty() || DoesIndexedAssetMatchTags(Entry.AssetData, TagFilters);
+		};
+
+		// The indexed filter with the fewest candidates drives the scan; the other filters are checked per entry.
+		const TArray<const TSet<int32>*>* DrivingCandidateSets = nullptr;
+		int32 DrivingCandidateCount = MAX_int32;
+		const auto ConsiderDrivingFilter = [&DrivingCandidateSets, &DrivingCandidateCount](
+			const bool bActive,
+			const TArray<const TSet<int32>*>& CandidateSets,
+			const int32 CandidateCount)
+		{
+			if (bActive && CandidateCount < DrivingCandidateCount)
+			{
+				DrivingCandidateSets = &CandidateSets;
+				DrivingCandidateCount = CandidateCount;
+			}
+		};
+		ConsiderDrivingFilter(!ClassFilter.IsEmpty(), ClassCandidateSets, ClassCandidateCount);
+		ConsiderDrivingFilter(!PathPrefix.IsEmpty(), PathCandidateSets, PathCandidateCount);
+		ConsiderDrivingFilter(!TagFilters.IsEmpty(), TagCandidateSets, TagCandidateCount);
+
+		if (DrivingCandidateSets != nullptr)
+		{
+			OutSlots.Reserve(DrivingCandidateCount);
+			for (const TSet<int32>* const CandidateSet : *DrivingCandidateSets)
+			{
+				for (const int32 Slot : *CandidateSet)
+				{
+					if (MatchesRemainingFilters(IndexedAssets[Slot]))
+					{
+						OutSlots.Add(Slot);
+					}
+				}
+			}
+		}
+		else
+		{
+			// Only a nameContains-only (or unfiltered) query gets here. Substring matches cannot be served from a
+			// hash index, so this walks every entry; combine it with classPath, pathPrefix or tags to narrow it.
+			for (int32 Slot = 0; Slot < IndexedAssets.Num(); ++Slot)
+			{
+				if (IndexedAssets[Slot].bValid && MatchesRemainingFilters(IndexedAssets[Slot]))
+				{
+					OutSlots.Add(Slot);
+				}
+			}
+		}
+
+		// Object path order, so a page boundary only moves when assets are added or removed before it.
+		// Slots are reused after removals and would reshuffle pages.
+		OutSlots.Sort([this](const int32 LeftSlot, const int32 RightSlot)
+		{
+			const FOctoMCPIndexedAsset& Left = IndexedAssets[LeftSlot];
+			const FOctoMCPIndexedAsset& Right = IndexedAssets[RightSlot];
+			const int32 PackageOrder = Left.PackageNameString.Compare(Right.PackageNameString, ESearchCase::CaseSensitive);
+			return PackageOrder != 0 ? PackageOrder < 0 : Left.AssetData.AssetName.LexicalLess(Right.AssetData.AssetName);
+		});
+	}
+
+	FQueryAssetsResult FOctoMCPModule::QueryAssets(
+		const FString& InClassPath,
+		const FString& InPathPrefix,
+		const FString& InNameContains,
+		const TArray<TPair<FName, FString>>& InTagFilters,
+		const int32 InOffset,
+		const int32 InLimit) const
+	{
+		FQueryAssetsResult Result;
+		Result.Offset = FMath::Max(InOffset, 0);
+		Result.Limit = FMath::Clamp(InLimit, 1, OctoMCP::MaxQueryAssetsLimit);
+
+		FRWScopeLock ReadLock(AssetIndexLock, SLT_ReadOnly);
+
+		Result.bIndexReady = bAssetIndexReady;
+		Result.IndexedAssetCount = IndexedAssetSlotByObjectPath.Num();
+		Result.IndexRevision = AssetIndexRevision;
+
+		TArray<int32> MatchedSlots;
+		CollectMatchingIndexedAssetSlots(InClassPath, InPathPrefix, InNameContains, InTagFilters, MatchedSlots);
+		Result.TotalCount = MatchedSlots.Num();
+
+		const int32 PageEnd = FMath::Min(Result.Offset + Result.Limit, MatchedSlots.Num());
+		for (int32 MatchIndex = Result.Offset; MatchIndex < PageEnd; ++MatchIndex)
+		{
+			const FAssetData& AssetData = IndexedAssets[MatchedSlots[MatchIndex]].AssetData;
+
+			FQueryAssetsEntry& Asset = Result.Assets.AddDefaulted_GetRef();
+			Asset.AssetObjectPath = AssetData.GetObjectPathString();
+			Asset.AssetPath = AssetData.PackageName.ToString();
+			Asset.PackagePath = AssetData.PackagePath.ToString();
+			Asset.AssetName = AssetData.AssetName.ToString();
+			Asset.ClassPath = AssetData.AssetClassPath.ToString();
+			Asset.ClassName = AssetData.AssetClassPath.GetAssetName().ToString();
+		}
+
+		Result.bSuccess = true;
+		Result.Message = Result.bIndexReady
+			? FString::Printf(
+				TEXT("Matched %d of %d indexed assets; returned %d."),
+				Result.TotalCount,
+				Result.IndexedAssetCount,
+				Result.Assets.Num())
+			: TEXT("The asset registry is still scanning; the index is not populated yet.");
+		return Result;
+	}
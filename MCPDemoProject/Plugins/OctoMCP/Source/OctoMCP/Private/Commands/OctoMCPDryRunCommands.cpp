@@ -0,0 +1,1374 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OctoMCPModule.h"
+
+namespace
+{
+	const TCHAR* const DryRunCommands[] = {
+		OctoMCP::CommandCreateBlueprintAsset,
+		OctoMCP::CommandCreateWidgetBlueprint,
+		OctoMCP::CommandImportTextureAsset,
+		OctoMCP::CommandAddWidgetBlueprintChildInstance,
+		OctoMCP::CommandSetUniformGridSlot,
+		OctoMCP::CommandSyncUniformGridWidgetInstances,
+		OctoMCP::CommandAddBlueprintInterface,
+		OctoMCP::CommandConfigureTileView,
+		OctoMCP::CommandReorderWidgetChild,
+		OctoMCP::CommandRemoveWidget,
+		OctoMCP::CommandScaffoldWidgetBlueprint,
+		OctoMCP::CommandSetBlueprintClassProperty,
+		OctoMCP::CommandSetGlobalDefaultGameMode,
+		OctoMCP::CommandBootstrapProjectMap,
+		OctoMCP::CommandApplyTextureProfile,
+		OctoMCP::CommandPackIconAtlas,
+		OctoMCP::CommandApplyWidgetTree,
+		OctoMCP::CommandSetWidgetInvalidationBoundary,
+		OctoMCP::CommandFlushSaves};
+
+	// Commands that accept assetQuery in place of assetPath.
+	const TCHAR* const FanOutDryRunCommands[] = {
+		OctoMCP::CommandSetWidgetBackgroundBlur,
+		OctoMCP::CommandSetWidgetCornerRadius,
+		OctoMCP::CommandSetWidgetPanelColor,
+		OctoMCP::CommandSetSizeBoxHeightOverride,
+		OctoMCP::CommandSetPopupOpenElasticScale,
+		OctoMCP::CommandSetWidgetImageTexture,
+		OctoMCP::CommandSetWidgetProperties};
+
+	TArray<TSharedPtr<FJsonValue>> ToJsonStringArray(const TArray<FString>& Values)
+	{
+		TArray<TSharedPtr<FJsonValue>> JsonValues;
+		JsonValues.Reserve(Values.Num());
+		for (const FString& Value : Values)
+		{
+			JsonValues.Add(MakeShared<FJsonValueString>(Value));
+		}
+
+		return JsonValues;
+	}
+
+	TSharedRef<FJsonObject> BuildDryRunResultObject(const FDryRunResult& DryRunResult)
+	{
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetBoolField(TEXT("dryRun"), true);
+		ResultObject->SetBoolField(TEXT("success"), DryRunResult.bSuccess);
+		ResultObject->SetBoolField(TEXT("widgetTreeChecked"), DryRunResult.bWidgetTreeChecked);
+		ResultObject->SetStringField(TEXT("message"), DryRunResult.Message);
+		ResultObject->SetStringField(TEXT("command"), DryRunResult.Command);
+		ResultObject->SetStringField(TEXT("assetPath"), DryRunResult.AssetPath);
+		ResultObject->SetStringField(TEXT("assetObjectPath"), DryRunResult.AssetObjectPath);
+		ResultObject->SetArrayField(TEXT("plannedChanges"), ToJsonStringArray(DryRunResult.PlannedChanges));
+		ResultObject->SetArrayField(TEXT("problems"), ToJsonStringArray(DryRunResult.Problems));
+		ResultObject->SetArrayField(TEXT("warnings"), ToJsonStringArray(DryRunResult.Warnings));
+		return ResultObject;
+	}
+}
+
+	void FOctoMCPModule::StartWidgetTreeMetadataCache()
+	{
+		WidgetTreeMetadataSavedHandle =
+			UPackage::PackageSavedWithContextEvent.AddRaw(this, &FOctoMCPModule::HandlePackageSavedForWidgetTreeMetadata);
+	}
+
+	void FOctoMCPModule::StopWidgetTreeMetadataCache()
+	{
+		UPackage::PackageSavedWithContextEvent.Remove(WidgetTreeMetadataSavedHandle);
+		WidgetTreeMetadataSavedHandle.Reset();
+		WidgetTreeMetadataCache.Empty();
+	}
+
+	void FOctoMCPModule::HandlePackageSavedForWidgetTreeMetadata(
+		const FString& PackageFileName,
+		UPackage* Package,
+		FObjectPostSaveContext ObjectSaveContext)
+	{
+		if (Package == nullptr || ObjectSaveContext.IsProceduralSave())
+		{
+			return;
+		}
+
+		// The saved tree is what a later load will see, so it stays valid after the blueprint is unloaded.
+		ForEachObjectWithPackage(Package, [this](UObject* Object)
+		{
+			if (const UWidgetBlueprint* const WidgetBlueprint = Cast<UWidgetBlueprint>(Object))
+			{
+				CacheWidgetTreeMetadata(WidgetBlueprint);
+			}
+
+			return true;
+		}, false);
+	}
+
+	void FOctoMCPModule::CacheWidgetTreeMetadata(const UWidgetBlueprint* const WidgetBlueprint) const
+	{
+		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
+		{
+			return;
+		}
+
+		FOctoMCPWidgetTreeMetadata& TreeMetadata = WidgetTreeMetadataCache.FindOrAdd(WidgetBlueprint->GetPathName());
+		TreeMetadata.Widgets.Reset();
+		TreeMetadata.ParentClass = WidgetBlueprint->ParentClass.Get();
+		TreeMetadata.RootWidgetName = WidgetBlueprint->WidgetTree->RootWidget != nullptr
+			? WidgetBlueprint->WidgetTree->RootWidget->GetFName()
+			: NAME_None;
+
+		WidgetBlueprint->WidgetTree->ForEachWidget([&TreeMetadata](UWidget* Widget)
+		{
+			FOctoMCPWidgetMetadata& WidgetMetadata = TreeMetadata.Widgets.Add(Widget->GetFName());
+			WidgetMetadata.bIsVariable = Widget->bIsVariable;
+			WidgetMetadata.WidgetClass = Widget->GetClass();
+			if (Widget->Slot != nullptr)
+			{
+				WidgetMetadata.SlotClass = Widget->Slot->GetClass();
+				if (Widget->Slot->Parent != nullptr)
+				{
+					WidgetMetadata.ParentName = Widget->Slot->Parent->GetFName();
+					WidgetMetadata.ChildIndex = Widget->Slot->Parent->GetChildIndex(Widget);
+				}
+			}
+		});
+	}
+
+	const FOctoMCPWidgetTreeMetadata* FOctoMCPModule::FindWidgetTreeMetadata(const FString& AssetObjectPath) const
+	{
+		// A blueprint already in memory is snapshotted fresh; FindObject never triggers a load.
+		if (const UWidgetBlueprint* const LoadedBlueprint = FindObject<UWidgetBlueprint>(nullptr, *AssetObjectPath))
+		{
+			CacheWidgetTreeMetadata(LoadedBlueprint);
+		}
+
+		return WidgetTreeMetadataCache.Find(AssetObjectPath);
+	}
+
+	bool FOctoMCPModule::HandleDryRunRequest(
+		const FString& Command,
+		const TSharedRef<FJsonObject>& RequestObject,
+		const FString& RequestId,
+		const FHttpResultCallback& OnComplete) const
+	{
+		TSharedPtr<FJsonObject> ArgumentsObject;
+		FString BodyError;
+		if (!TryGetArgumentsObject(RequestObject, ArgumentsObject, BodyError) || !ArgumentsObject->HasField(TEXT("dryRun")))
+		{
+			return false;
+		}
+
+		bool bDryRun = false;
+		if (!TryGetOptionalBoolArgument(ArgumentsObject, TEXT("dryRun"), bDryRun, BodyError))
+		{
+			OnComplete(CreateErrorResponse(
+				EHttpServerResponseCodes::BadRequest,
+				TEXT("invalid_arguments"),
+				BodyError,
+				RequestId));
+			return true;
+		}
+
+		if (!bDryRun)
+		{
+			return false;
+		}
+
+		bool bSupportsFanOut = false;
+		if (!IsDryRunSupported(Command, bSupportsFanOut))
+		{
+			OnComplete(CreateErrorResponse(
+				EHttpServerResponseCodes::BadRequest,
+				TEXT("invalid_arguments"),
+				FString::Printf(TEXT("dryRun is not supported by command %s."), *Command),
+				RequestId));
+			return true;
+		}
+
+		FOctoMCPAssetTargets AssetTargets;
+		if (bSupportsFanOut && !TryGetAssetTargetsArgument(ArgumentsObject, AssetTargets, BodyError))
+		{
+			OnComplete(CreateErrorResponse(
+				EHttpServerResponseCodes::BadRequest,
+				TEXT("invalid_arguments"),
+				BodyError,
+				RequestId));
+			return true;
+		}
+
+		const FHttpResultCallback CompletionCallback = OnComplete;
+		const FString CapturedRequestId = RequestId;
+		// Queued behind earlier commands so the report reflects their edits.
+		RunAfterPreloadingAssets(
+			{},
+			[this, CompletionCallback, CapturedRequestId, Command, AssetTargets, ArgumentsObject]()
+			{
+				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+				ResponseObject->SetBoolField(TEXT("ok"), true);
+				if (!CapturedRequestId.IsEmpty())
+				{
+					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
+				}
+				ResponseObject->SetObjectField(TEXT("result"), BuildDryRunObject(Command, AssetTargets, ArgumentsObject));
+
+				CompletionCallback(CreateJsonResponse(ResponseObject));
+			});
+		return true;
+	}
+
+	bool FOctoMCPModule::IsDryRunSupported(const FString& Command, bool& bOutSupportsFanOut) const
+	{
+		bOutSupportsFanOut = false;
+		for (const TCHAR* const FanOutCommand : FanOutDryRunCommands)
+		{
+			if (Command == FanOutCommand)
+			{
+				bOutSupportsFanOut = true;
+				return true;
+			}
+		}
+
+		for (const TCHAR* const DryRunCommand : DryRunCommands)
+		{
+			if (Command == DryRunCommand)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildDryRunObject(
+		const FString& Command,
+		const FOctoMCPAssetTargets& AssetTargets,
+		const TSharedPtr<FJsonObject>& ArgumentsObject) const
+	{
+		if (!AssetTargets.bFanOut)
+		{
+			return BuildDryRunResultObject(DryRunCommand(Command, AssetTargets.AssetPath, ArgumentsObject));
+		}
+
+		// Saving is off, so the fan-out only resolves the query and collects one dry-run result per asset.
+		TSharedRef<FJsonObject> ResultObject = BuildFanOutObject(
+			AssetTargets,
+			false,
+			false,
+			[this, &Command, &ArgumentsObject](const FString& AssetPath, const bool bSaveEachAsset)
+			{
+				return BuildDryRunResultObject(DryRunCommand(Command, AssetPath, ArgumentsObject));
+			});
+
+		int32 MatchedCount = 0;
+		int32 SucceededCount = 0;
+		int32 FailedCount = 0;
+		ResultObject->TryGetNumberField(TEXT("matchedCount"), MatchedCount);
+		ResultObject->TryGetNumberField(TEXT("succeededCount"), SucceededCount);
+		ResultObject->TryGetNumberField(TEXT("failedCount"), FailedCount);
+
+		ResultObject->SetBoolField(TEXT("dryRun"), true);
+		if (MatchedCount > 0)
+		{
+			ResultObject->SetStringField(
+				TEXT("message"),
+				FString::Printf(
+					TEXT("Dry run of %s over %d matched asset(s): %d passed, %d failed; nothing was modified."),
+					*Command,
+					MatchedCount,
+					SucceededCount,
+					FailedCount));
+		}
+
+		return ResultObject;
+	}
+
+	UClass* FOctoMCPModule::FindClassWithoutLoading(
+		const FString& InClassPath,
+		const UClass* RequiredBaseClass,
+		bool& bOutFoundUnloadedBlueprint,
+		FString& OutError) const
+	{
+		bOutFoundUnloadedBlueprint = false;
+
+		const FString TrimmedClassPath = InClassPath.TrimStartAndEnd();
+		if (TrimmedClassPath.IsEmpty())
+		{
+			OutError = TEXT("classPath must not be empty.");
+			return nullptr;
+		}
+
+		// Same candidates as ResolveClassReference, but only classes already in memory are accepted.
+		TArray<FString> CandidateClassPaths;
+		CandidateClassPaths.AddUnique(TrimmedClassPath);
+
+		if (!TrimmedClassPath.StartsWith(TEXT("/")))
+		{
+			FString NativeClassName = TrimmedClassPath;
+			if ((NativeClassName.StartsWith(TEXT("A")) || NativeClassName.StartsWith(TEXT("U"))) && NativeClassName.Len() > 1)
+			{
+				NativeClassName.RightChopInline(1, EAllowShrinking::No);
+			}
+
+			CandidateClassPaths.AddUnique(FString::Printf(TEXT("/Script/%s.%s"), FApp::GetProjectName(), *NativeClassName));
+		}
+
+		FString BlueprintAssetPath;
+		FString IgnoredPackagePath;
+		FString BlueprintAssetName;
+		FString BlueprintAssetObjectPath;
+		FString NormalizedAssetError;
+		if (NormalizeWidgetBlueprintAssetPath(
+				TrimmedClassPath,
+				BlueprintAssetPath,
+				IgnoredPackagePath,
+				BlueprintAssetName,
+				BlueprintAssetObjectPath,
+				NormalizedAssetError))
+		{
+			CandidateClassPaths.AddUnique(FString::Printf(TEXT("%s.%s_C"), *BlueprintAssetPath, *BlueprintAssetName));
+		}
+
+		for (const FString& CandidateClassPath : CandidateClassPaths)
+		{
+			UClass* const ResolvedClass = FindObject<UClass>(nullptr, *CandidateClassPath);
+			if (ResolvedClass == nullptr)
+			{
+				continue;
+			}
+
+			if (RequiredBaseClass != nullptr && !ResolvedClass->IsChildOf(RequiredBaseClass))
+			{
+				OutError = FString::Printf(
+					TEXT("Resolved class %s does not derive from required base class %s."),
+					*ResolvedClass->GetPathName(),
+					*RequiredBaseClass->GetPathName());
+				return nullptr;
+			}
+
+			return ResolvedClass;
+		}
+
+		// An unloaded Blueprint is checked through its registry tags; the native parent is always in memory.
+		FAssetData BlueprintAssetData;
+		if (!BlueprintAssetObjectPath.IsEmpty()
+			&& FindIndexedAsset(BlueprintAssetObjectPath, BlueprintAssetData)
+			&& BlueprintAssetData.IsInstanceOf(UBlueprint::StaticClass()))
+		{
+			FString NativeParentClassTag;
+			BlueprintAssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentClassTag);
+			const UClass* const NativeParentClass = NativeParentClassTag.IsEmpty()
+				? nullptr
+				: FindObject<UClass>(nullptr, *FPackageName::ExportTextPathToObjectPath(NativeParentClassTag));
+			if (RequiredBaseClass != nullptr
+				&& RequiredBaseClass->HasAnyClassFlags(CLASS_Native)
+				&& NativeParentClass != nullptr
+				&& !NativeParentClass->IsChildOf(RequiredBaseClass))
+			{
+				OutError = FString::Printf(
+					TEXT("Blueprint %s derives from %s, not from required base class %s."),
+					*BlueprintAssetObjectPath,
+					*NativeParentClass->GetPathName(),
+					*RequiredBaseClass->GetPathName());
+				return nullptr;
+			}
+
+			bOutFoundUnloadedBlueprint = true;
+			return nullptr;
+		}
+
+		OutError = FString::Printf(TEXT("Could not resolve class reference: %s"), *TrimmedClassPath);
+		return nullptr;
+	}
+
+	FDryRunResult FOctoMCPModule::DryRunCommand(
+		const FString& Command,
+		const FString& InAssetPath,
+		const TSharedPtr<FJsonObject>& ArgumentsObject) const
+	{
+		FDryRunResult Result;
+		Result.Command = Command;
+
+		FString ErrorMessage;
+		const FOctoMCPWidgetTreeMetadata* TreeMetadata = nullptr;
+
+		const auto AddProblem = [&Result](const FString& Problem)
+		{
+			Result.Problems.Add(Problem);
+		};
+
+		const auto AddPlannedChange = [&Result](const FString& PlannedChange)
+		{
+			Result.PlannedChanges.Add(PlannedChange);
+		};
+
+		const auto GetString = [&](const TCHAR* FieldName, const bool bRequired, FString& OutValue)
+		{
+			const bool bValid = bRequired
+				? TryGetRequiredStringArgument(ArgumentsObject, FieldName, OutValue, ErrorMessage)
+				: TryGetOptionalStringArgument(ArgumentsObject, FieldName, OutValue, ErrorMessage);
+			if (!bValid)
+			{
+				AddProblem(ErrorMessage);
+			}
+
+			return bValid;
+		};
+
+		const auto GetInt = [&](const TCHAR* FieldName, const bool bRequired, int32& OutValue)
+		{
+			bool bHasValue = false;
+			const bool bValid = bRequired
+				? TryGetRequiredIntArgument(ArgumentsObject, FieldName, OutValue, ErrorMessage)
+				: TryGetOptionalIntArgument(ArgumentsObject, FieldName, OutValue, bHasValue, ErrorMessage);
+			if (!bValid)
+			{
+				AddProblem(ErrorMessage);
+			}
+
+			return bValid;
+		};
+
+		const auto GetFloat = [&](const TCHAR* FieldName, const bool bRequired, float& OutValue)
+		{
+			const bool bValid = bRequired
+				? TryGetRequiredFloatArgument(ArgumentsObject, FieldName, OutValue, ErrorMessage)
+				: TryGetOptionalFloatArgument(ArgumentsObject, FieldName, OutValue, ErrorMessage);
+			if (!bValid)
+			{
+				AddProblem(ErrorMessage);
+			}
+
+			return bValid;
+		};
+
+		const auto GetBool = [&](const TCHAR* FieldName, bool& OutValue)
+		{
+			const bool bValid = TryGetOptionalBoolArgument(ArgumentsObject, FieldName, OutValue, ErrorMessage);
+			if (!bValid)
+			{
+				AddProblem(ErrorMessage);
+			}
+
+			return bValid;
+		};
+
+		// Looks the asset up in the asset index and returns its object path; never loads it.
+		const auto CheckAsset = [&](const FString& AssetPath, const UClass* AssetClass, FString& OutAssetObjectPath)
+		{
+			FString AssetPackageName;
+			FString PackagePath;
+			FString AssetName;
+			if (!NormalizeWidgetBlueprintAssetPath(AssetPath, AssetPackageName, PackagePath, AssetName, OutAssetObjectPath, ErrorMessage))
+			{
+				AddProblem(ErrorMessage);
+				return false;
+			}
+
+			FAssetData AssetData;
+			if (!FindIndexedAsset(OutAssetObjectPath, AssetData))
+			{
+				AddProblem(FString::Printf(TEXT("Asset does not exist: %s"), *OutAssetObjectPath));
+				return false;
+			}
+
+			if (AssetClass != nullptr && !AssetData.IsInstanceOf(AssetClass))
+			{
+				AddProblem(FString::Printf(
+					TEXT("%s is a %s, not a %s."),
+					*OutAssetObjectPath,
+					*AssetData.AssetClassPath.GetAssetName().ToString(),
+					*AssetClass->GetName()));
+				return false;
+			}
+
+			return true;
+		};
+
+		// Resolves the command's target asset; a Widget Blueprint also brings in its widget tree metadata.
+		const auto CheckTargetAsset = [&](const UClass* AssetClass)
+		{
+			FString AssetPath = InAssetPath;
+			if (AssetPath.IsEmpty() && !GetString(TEXT("assetPath"), true, AssetPath))
+			{
+				return false;
+			}
+
+			if (!CheckAsset(AssetPath, AssetClass, Result.AssetObjectPath))
+			{
+				return false;
+			}
+
+			Result.AssetPath = FPackageName::ObjectPathToPackageName(Result.AssetObjectPath);
+			if (AssetClass != UWidgetBlueprint::StaticClass())
+			{
+				return true;
+			}
+
+			TreeMetadata = FindWidgetTreeMetadata(Result.AssetObjectPath);
+			Result.bWidgetTreeChecked = TreeMetadata != nullptr;
+			if (TreeMetadata == nullptr)
+			{
+				Result.Warnings.Add(FString::Printf(
+					TEXT("%s is not loaded and was not saved this session, so widget names and types were not checked."),
+					*Result.AssetObjectPath));
+			}
+
+			return true;
+		};
+
+		// Returns the widget's metadata, or nullptr when it is missing, of the wrong type, or the tree is unknown.
+		const auto CheckWidget = [&](const FString& WidgetName, const TArray<const UClass*>& AllowedClasses)
+			-> const FOctoMCPWidgetMetadata*
+		{
+			if (TreeMetadata == nullptr)
+			{
+				return nullptr;
+			}
+
+			const FOctoMCPWidgetMetadata* const WidgetMetadata = TreeMetadata->Widgets.Find(FName(*WidgetName));
+			if (WidgetMetadata == nullptr)
+			{
+				AddProblem(FString::Printf(TEXT("Could not find widget %s in %s."), *WidgetName, *Result.AssetObjectPath));
+				return nullptr;
+			}
+
+			const UClass* const WidgetClass = WidgetMetadata->WidgetClass.Get();
+			if (WidgetClass == nullptr || AllowedClasses.IsEmpty())
+			{
+				return WidgetMetadata;
+			}
+
+			TArray<FString> AllowedClassNames;
+			for (const UClass* const AllowedClass : AllowedClasses)
+			{
+				if (WidgetClass->IsChildOf(AllowedClass))
+				{
+					return WidgetMetadata;
+				}
+
+				AllowedClassNames.Add(AllowedClass->GetName());
+			}
+
+			AddProblem(FString::Printf(
+				TEXT("Widget %s is a %s; expected %s."),
+				*WidgetName,
+				*WidgetClass->GetName(),
+				*FString::Join(AllowedClassNames, TEXT(" or "))));
+			return nullptr;
+		};
+
+		const auto CheckClass = [&](const FString& ClassPath, const UClass* RequiredBaseClass)
+		{
+			bool bFoundUnloadedBlueprint = false;
+			if (FindClassWithoutLoading(ClassPath, RequiredBaseClass, bFoundUnloadedBlueprint, ErrorMessage) != nullptr)
+			{
+				return true;
+			}
+
+			if (!bFoundUnloadedBlueprint)
+			{
+				AddProblem(ErrorMessage);
+				return false;
+			}
+
+			Result.Warnings.Add(FString::Printf(
+				TEXT("Blueprint class %s is not loaded; only its asset registry entry was checked."),
+				*ClassPath));
+			return true;
+		};
+
+		if (Command == OctoMCP::CommandCreateBlueprintAsset || Command == OctoMCP::CommandCreateWidgetBlueprint)
+		{
+			const bool bWidgetBlueprint = Command == OctoMCP::CommandCreateWidgetBlueprint;
+			FString AssetPath;
+			FString ParentClassPath;
+			if (GetString(TEXT("assetPath"), true, AssetPath) && GetString(TEXT("parentClassPath"), true, ParentClassPath))
+			{
+				FString AssetPackageName;
+				FString PackagePath;
+				FString AssetName;
+				FAssetData ExistingAssetData;
+				if (!NormalizeWidgetBlueprintAssetPath(AssetPath, AssetPackageName, PackagePath, AssetName, Result.AssetObjectPath, ErrorMessage))
+				{
+					AddProblem(ErrorMessage);
+				}
+				else if (FindIndexedAsset(Result.AssetObjectPath, ExistingAssetData))
+				{
+					AddProblem(FString::Printf(TEXT("Asset already exists: %s"), *Result.AssetObjectPath));
+				}
+
+				FString ScaffoldType;
+				FString InvalidationBoundary;
+				if (bWidgetBlueprint
+					&& GetString(TEXT("scaffoldType"), false, ScaffoldType)
+					&& GetString(TEXT("invalidationBoundary"), false, InvalidationBoundary)
+					&& !ScaffoldType.IsEmpty())
+				{
+					ScaffoldType = ScaffoldType.ToLower();
+					InvalidationBoundary = InvalidationBoundary.IsEmpty()
+						? FString(OctoMCP::InvalidationBoundaryInvalidation)
+						: InvalidationBoundary.ToLower();
+					if (!IsScaffoldType(ScaffoldType))
+					{
+						AddProblem(FString::Printf(TEXT("Unsupported scaffoldType: %s"), *ScaffoldType));
+					}
+
+					if (!IsInvalidationBoundaryType(InvalidationBoundary))
+					{
+						AddProblem(FString::Printf(TEXT("Unsupported invalidationBoundary: %s"), *InvalidationBoundary));
+					}
+				}
+
+				Result.AssetPath = AssetPackageName;
+				if (CheckClass(ParentClassPath, bWidgetBlueprint ? UUserWidget::StaticClass() : nullptr))
+				{
+					if (!ScaffoldType.IsEmpty())
+					{
+						AddPlannedChange(FString::Printf(
+							TEXT("copy %s to %s and retarget it to %s"),
+							*GetScaffoldTemplateAssetPath(ScaffoldType, InvalidationBoundary),
+							*Result.AssetObjectPath,
+							*ParentClassPath));
+					}
+					else
+					{
+						AddPlannedChange(FString::Printf(
+							TEXT("create %s %s with parent %s"),
+							bWidgetBlueprint ? TEXT("Widget Blueprint") : TEXT("Blueprint"),
+							*Result.AssetObjectPath,
+							*ParentClassPath));
+					}
+				}
+			}
+		}
+		else if (Command == OctoMCP::CommandImportTextureAsset)
+		{
+			FString SourceFilePath;
+			FString AssetPath;
+			FString ImportProfileName;
+			bool bReplaceExisting = false;
+			if (GetString(TEXT("sourceFilePath"), true, SourceFilePath)
+				&& GetString(TEXT("assetPath"), true, AssetPath)
+				&& GetString(TEXT("importProfile"), false, ImportProfileName)
+				&& GetBool(TEXT("replaceExisting"), bReplaceExisting))
+			{
+				// Resolved like the import itself, so a relative path that imports fine is not reported missing.
+				SourceFilePath = FPaths::ConvertRelativePathToFull(SourceFilePath);
+				if (!IFileManager::Get().FileExists(*SourceFilePath))
+				{
+					AddProblem(FString::Printf(TEXT("Source file does not exist: %s"), *SourceFilePath));
+				}
+
+				FOctoMCPTextureImportProfile ImportProfile;
+				if (!ImportProfileName.IsEmpty() && !ResolveTextureImportProfile(ImportProfileName, ImportProfile, ErrorMessage))
+				{
+					AddProblem(ErrorMessage);
+				}
+
+				FString AssetPackageName;
+				FString PackagePath;
+				FString AssetName;
+				FAssetData ExistingAssetData;
+				if (!NormalizeWidgetBlueprintAssetPath(AssetPath, AssetPackageName, PackagePath, AssetName, Result.AssetObjectPath, ErrorMessage))
+				{
+					AddProblem(ErrorMessage);
+				}
+				else
+				{
+					Result.AssetPath = AssetPackageName;
+					const bool bExists = FindIndexedAsset(Result.AssetObjectPath, ExistingAssetData);
+					if (bExists && !bReplaceExisting)
+					{
+						AddProblem(FString::Printf(
+							TEXT("Texture asset already exists: %s; set replaceExisting to reimport it."),
+							*Result.AssetObjectPath));
+					}
+
+					AddPlannedChange(FString::Printf(
+						TEXT("%s %s from %s"),
+						bExists ? TEXT("reimport") : TEXT("import"),
+						*Result.AssetObjectPath,
+						*SourceFilePath));
+				}
+			}
+		}
+		else if (Command == OctoMCP::CommandAddWidgetBlueprintChildInstance)
+		{
+			FString ParentWidgetName;
+			FString ChildWidgetAssetPath;
+			FString ChildWidgetName;
+			int32 DesiredIndex = INDEX_NONE;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass())
+				&& GetString(TEXT("parentWidgetName"), true, ParentWidgetName)
+				&& GetString(TEXT("childWidgetAssetPath"), true, ChildWidgetAssetPath)
+				&& GetString(TEXT("childWidgetName"), true, ChildWidgetName)
+				&& GetInt(TEXT("desiredIndex"), true, DesiredIndex))
+			{
+				FString ChildWidgetObjectPath;
+				CheckWidget(ParentWidgetName, {UPanelWidget::StaticClass()});
+				CheckAsset(ChildWidgetAssetPath, UWidgetBlueprint::StaticClass(), ChildWidgetObjectPath);
+
+				const bool bChildExists = TreeMetadata != nullptr && TreeMetadata->Widgets.Contains(FName(*ChildWidgetName));
+				AddPlannedChange(FString::Printf(
+					TEXT("%s %s (%s) under %s at %d"),
+					bChildExists ? TEXT("place existing") : TEXT("create"),
+					*ChildWidgetName,
+					*ChildWidgetAssetPath,
+					*ParentWidgetName,
+					DesiredIndex));
+			}
+		}
+		else if (Command == OctoMCP::CommandSetUniformGridSlot)
+		{
+			FString WidgetName;
+			int32 Row = 0;
+			int32 Column = 0;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass())
+				&& GetString(TEXT("widgetName"), true, WidgetName)
+				&& GetInt(TEXT("row"), true, Row)
+				&& GetInt(TEXT("column"), true, Column))
+			{
+				const FOctoMCPWidgetMetadata* const WidgetMetadata = CheckWidget(WidgetName, {});
+				const UClass* const SlotClass = WidgetMetadata != nullptr ? WidgetMetadata->SlotClass.Get() : nullptr;
+				if (WidgetMetadata != nullptr && (SlotClass == nullptr || !SlotClass->IsChildOf(UUniformGridSlot::StaticClass())))
+				{
+					AddProblem(FString::Printf(TEXT("Widget %s is not inside a UniformGridPanel."), *WidgetName));
+				}
+
+				AddPlannedChange(FString::Printf(TEXT("set %s to row %d, column %d"), *WidgetName, Row, Column));
+			}
+		}
+		else if (Command == OctoMCP::CommandSyncUniformGridWidgetInstances)
+		{
+			FString GridWidgetName;
+			FString EntryWidgetAssetPath;
+			FString InstanceNamePrefix;
+			int32 Count = 0;
+			int32 ColumnCount = 0;
+			bool bTrimManagedChildren = false;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass())
+				&& GetString(TEXT("gridWidgetName"), true, GridWidgetName)
+				&& GetString(TEXT("entryWidgetAssetPath"), true, EntryWidgetAssetPath)
+				&& GetInt(TEXT("count"), true, Count)
+				&& GetInt(TEXT("columnCount"), true, ColumnCount)
+				&& GetString(TEXT("instanceNamePrefix"), true, InstanceNamePrefix)
+				&& GetBool(TEXT("trimManagedChildren"), bTrimManagedChildren))
+			{
+				FString EntryWidgetObjectPath;
+				CheckWidget(GridWidgetName, {UUniformGridPanel::StaticClass()});
+				CheckAsset(EntryWidgetAssetPath, UWidgetBlueprint::StaticClass(), EntryWidgetObjectPath);
+
+				// The sync clamps rather than rejects these, so report the values it will actually use.
+				if (Count < 0 || ColumnCount < 1)
+				{
+					Result.Warnings.Add(FString::Printf(
+						TEXT("count %d and columnCount %d are clamped to %d and %d."),
+						Count,
+						ColumnCount,
+						FMath::Max(Count, 0),
+						FMath::Max(ColumnCount, 1)));
+					Count = FMath::Max(Count, 0);
+					ColumnCount = FMath::Max(ColumnCount, 1);
+				}
+
+				int32 ExistingCount = 0;
+				if (TreeMetadata != nullptr)
+				{
+					const FName GridFName(*GridWidgetName);
+					for (const TPair<FName, FOctoMCPWidgetMetadata>& Widget : TreeMetadata->Widgets)
+					{
+						if (Widget.Value.ParentName == GridFName && Widget.Key.ToString().StartsWith(InstanceNamePrefix))
+						{
+							++ExistingCount;
+						}
+					}
+				}
+
+				AddPlannedChange(FString::Printf(
+					TEXT("sync %s to %d %s instance(s) in %d column(s); %d managed instance(s) exist%s"),
+					*GridWidgetName,
+					Count,
+					*EntryWidgetAssetPath,
+					ColumnCount,
+					ExistingCount,
+					bTrimManagedChildren ? TEXT(", extras are trimmed") : TEXT("")));
+			}
+		}
+		else if (Command == OctoMCP::CommandAddBlueprintInterface)
+		{
+			FString InterfaceClassPath;
+			if (CheckTargetAsset(UBlueprint::StaticClass())
+				&& GetString(TEXT("interfaceClassPath"), true, InterfaceClassPath)
+				&& CheckClass(InterfaceClassPath, UInterface::StaticClass()))
+			{
+				AddPlannedChange(FString::Printf(TEXT("implement %s"), *InterfaceClassPath));
+			}
+		}
+		else if (Command == OctoMCP::CommandConfigureTileView)
+		{
+			FString WidgetName;
+			FString EntryWidgetAssetPath;
+			FString Orientation;
+			float EntryWidth = 0.0f;
+			float EntryHeight = 0.0f;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass())
+				&& GetString(TEXT("widgetName"), true, WidgetName)
+				&& GetString(TEXT("entryWidgetAssetPath"), true, EntryWidgetAssetPath)
+				&& GetFloat(TEXT("entryWidth"), true, EntryWidth)
+				&& GetFloat(TEXT("entryHeight"), true, EntryHeight)
+				&& GetString(TEXT("orientation"), false, Orientation))
+			{
+				FString EntryWidgetObjectPath;
+				CheckWidget(WidgetName, {UTileView::StaticClass()});
+				CheckAsset(EntryWidgetAssetPath, UWidgetBlueprint::StaticClass(), EntryWidgetObjectPath);
+
+				EOrientation ParsedOrientation = Orient_Vertical;
+				FString NormalizedOrientation;
+				if (!Orientation.IsEmpty() && !ParseOrientationValue(Orientation, ParsedOrientation, NormalizedOrientation, ErrorMessage))
+				{
+					AddProblem(ErrorMessage);
+				}
+
+				AddPlannedChange(FString::Printf(
+					TEXT("configure %s with entry %s at %.1fx%.1f"),
+					*WidgetName,
+					*EntryWidgetAssetPath,
+					EntryWidth,
+					EntryHeight));
+			}
+		}
+		else if (Command == OctoMCP::CommandReorderWidgetChild)
+		{
+			FString WidgetName;
+			int32 DesiredIndex = INDEX_NONE;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass())
+				&& GetString(TEXT("widgetName"), true, WidgetName)
+				&& GetInt(TEXT("desiredIndex"), true, DesiredIndex))
+			{
+				const FOctoMCPWidgetMetadata* const WidgetMetadata = CheckWidget(WidgetName, {});
+				if (WidgetMetadata != nullptr && WidgetMetadata->ParentName.IsNone())
+				{
+					AddProblem(FString::Printf(TEXT("Widget %s has no parent panel to reorder within."), *WidgetName));
+				}
+				else if (WidgetMetadata != nullptr && WidgetMetadata->ChildIndex == DesiredIndex)
+				{
+					Result.Warnings.Add(FString::Printf(TEXT("%s is already at index %d."), *WidgetName, DesiredIndex));
+				}
+				else
+				{
+					AddPlannedChange(FString::Printf(TEXT("move %s to index %d"), *WidgetName, DesiredIndex));
+				}
+			}
+		}
+		else if (Command == OctoMCP::CommandRemoveWidget)
+		{
+			FString WidgetName;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass()) && GetString(TEXT("widgetName"), true, WidgetName))
+			{
+				int32 DescendantCount = 0;
+				if (CheckWidget(WidgetName, {}) != nullptr)
+				{
+					TArray<FName> PendingParents = {FName(*WidgetName)};
+					while (!PendingParents.IsEmpty())
+					{
+						const FName ParentName = PendingParents.Pop(EAllowShrinking::No);
+						for (const TPair<FName, FOctoMCPWidgetMetadata>& Widget : TreeMetadata->Widgets)
+						{
+							if (Widget.Value.ParentName == ParentName)
+							{
+								PendingParents.Add(Widget.Key);
+								++DescendantCount;
+							}
+						}
+					}
+				}
+
+				AddPlannedChange(FString::Printf(
+					TEXT("remove %s and %d descendant widget(s)"),
+					*WidgetName,
+					DescendantCount));
+			}
+		}
+		else if (Command == OctoMCP::CommandSetWidgetInvalidationBoundary)
+		{
+			FString WidgetName;
+			FString Boundary;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass())
+				&& GetString(TEXT("widgetName"), true, WidgetName)
+				&& GetString(TEXT("boundary"), true, Boundary))
+			{
+				Boundary = Boundary.ToLower();
+				if (!IsInvalidationBoundaryType(Boundary))
+				{
+					AddProblem(FString::Printf(TEXT("Unsupported boundary: %s"), *Boundary));
+				}
+				else if (CheckWidget(WidgetName, {}) != nullptr)
+				{
+					AddPlannedChange(Boundary == OctoMCP::InvalidationBoundaryNone
+						? FString::Printf(TEXT("remove any invalidation boundary around %s"), *WidgetName)
+						: FString::Printf(TEXT("wrap %s in a %s boundary"), *WidgetName, *Boundary));
+				}
+			}
+		}
+		else if (Command == OctoMCP::CommandScaffoldWidgetBlueprint)
+		{
+			FString AssetPath;
+			FString ScaffoldType;
+			FString ParentClassPath;
+			FString InvalidationBoundary;
+			bool bUseTemplate = false;
+			if (GetString(TEXT("assetPath"), true, AssetPath)
+				&& GetString(TEXT("scaffoldType"), true, ScaffoldType)
+				&& GetString(TEXT("parentClassPath"), false, ParentClassPath)
+				&& GetString(TEXT("invalidationBoundary"), false, InvalidationBoundary)
+				&& GetBool(TEXT("useTemplate"), bUseTemplate))
+			{
+				ScaffoldType = ScaffoldType.ToLower();
+				InvalidationBoundary = InvalidationBoundary.IsEmpty()
+					? FString(OctoMCP::InvalidationBoundaryInvalidation)
+					: InvalidationBoundary.ToLower();
+				if (!IsInvalidationBoundaryType(InvalidationBoundary))
+				{
+					AddProblem(FString::Printf(TEXT("Unsupported invalidationBoundary: %s"), *InvalidationBoundary));
+				}
+
+				const bool bKnownScaffoldType = IsScaffoldType(ScaffoldType);
+				if (!bKnownScaffoldType)
+				{
+					AddProblem(FString::Printf(TEXT("Unsupported scaffoldType: %s"), *ScaffoldType));
+				}
+
+				FString AssetPackageName;
+				FString PackagePath;
+				FString AssetName;
+				FAssetData ExistingAssetData;
+				const bool bValidAssetPath =
+					NormalizeWidgetBlueprintAssetPath(AssetPath, AssetPackageName, PackagePath, AssetName, Result.AssetObjectPath, ErrorMessage);
+				if (!bValidAssetPath)
+				{
+					AddProblem(ErrorMessage);
+				}
+				else if (bUseTemplate && !FindIndexedAsset(Result.AssetObjectPath, ExistingAssetData))
+				{
+					Result.AssetPath = AssetPackageName;
+					if (ParentClassPath.IsEmpty() || CheckClass(ParentClassPath, UUserWidget::StaticClass()))
+					{
+						const FString TemplateAssetPath = GetScaffoldTemplateAssetPath(ScaffoldType, InvalidationBoundary);
+						AddPlannedChange(FString::Printf(
+							TEXT("copy %s to %s%s"),
+							*TemplateAssetPath,
+							*Result.AssetObjectPath,
+							ParentClassPath.IsEmpty() ? TEXT("") : *FString::Printf(TEXT(" and retarget it to %s"), *ParentClassPath)));
+					}
+				}
+				else if (!ParentClassPath.IsEmpty())
+				{
+					AddProblem(FString::Printf(
+						TEXT("parentClassPath only applies when useTemplate creates a new asset; %s already exists."),
+						*Result.AssetObjectPath));
+				}
+				else if (CheckTargetAsset(UWidgetBlueprint::StaticClass()) && bKnownScaffoldType)
+				{
+					AddPlannedChange(FString::Printf(
+						TEXT("rebuild the widget tree as a %s scaffold, replacing %d existing widget(s)"),
+						*ScaffoldType,
+						TreeMetadata != nullptr ? TreeMetadata->Widgets.Num() : 0));
+				}
+			}
+		}
+		else if (Command == OctoMCP::CommandSetBlueprintClassProperty)
+		{
+			FString PropertyName;
+			FString ValueClassPath;
+			if (CheckTargetAsset(UBlueprint::StaticClass())
+				&& GetString(TEXT("propertyName"), true, PropertyName)
+				&& GetString(TEXT("valueClassPath"), true, ValueClassPath))
+			{
+				const UBlueprint* const LoadedBlueprint = FindObject<UBlueprint>(nullptr, *Result.AssetObjectPath);
+				const FClassProperty* const ClassProperty = LoadedBlueprint != nullptr && LoadedBlueprint->GeneratedClass != nullptr
+					? CastField<FClassProperty>(LoadedBlueprint->GeneratedClass->FindPropertyByName(*PropertyName))
+					: nullptr;
+				if (LoadedBlueprint == nullptr || LoadedBlueprint->GeneratedClass == nullptr)
+				{
+					Result.Warnings.Add(FString::Printf(
+						TEXT("%s is not loaded, so property %s was not checked."),
+						*Result.AssetObjectPath,
+						*PropertyName));
+					CheckClass(ValueClassPath, nullptr);
+				}
+				else if (ClassProperty == nullptr)
+				{
+					AddProblem(FString::Printf(
+						TEXT("Could not find class property %s on %s."),
+						*PropertyName,
+						*LoadedBlueprint->GeneratedClass->GetName()));
+				}
+				else
+				{
+					CheckClass(ValueClassPath, ClassProperty->MetaClass);
+				}
+
+				AddPlannedChange(FString::Printf(TEXT("set %s to %s"), *PropertyName, *ValueClassPath));
+			}
+		}
+		else if (Command == OctoMCP::CommandSetGlobalDefaultGameMode)
+		{
+			FString GameModeClassPath;
+			bool bSaveConfig = true;
+			if (GetString(TEXT("gameModeClassPath"), true, GameModeClassPath)
+				&& GetBool(TEXT("saveConfig"), bSaveConfig)
+				&& CheckClass(GameModeClassPath, AGameModeBase::StaticClass()))
+			{
+				AddPlannedChange(FString::Printf(
+					TEXT("set GlobalDefaultGameMode to %s%s"),
+					*GameModeClassPath,
+					bSaveConfig ? TEXT(" and write DefaultEngine.ini") : TEXT("")));
+			}
+		}
+		else if (Command == OctoMCP::CommandBootstrapProjectMap)
+		{
+			FString LevelFileName = OctoMCP::DefaultBootstrapLevelFileName;
+			FString DirectoryPath = OctoMCP::DefaultBootstrapDirectoryPath;
+			bool bForceCreate = false;
+			if (GetString(TEXT("levelFileName"), false, LevelFileName)
+				&& GetString(TEXT("directoryPath"), false, DirectoryPath)
+				&& GetBool(TEXT("forceCreate"), bForceCreate))
+			{
+				Result.AssetPath = FString::Printf(TEXT("%s/%s"), *DirectoryPath, *LevelFileName);
+				FText ValidationError;
+				if (!FPackageName::IsValidLongPackageName(Result.AssetPath, false, &ValidationError))
+				{
+					AddProblem(ValidationError.ToString());
+				}
+				else
+				{
+					Result.AssetObjectPath = FString::Printf(TEXT("%s.%s"), *Result.AssetPath, *LevelFileName);
+					FAssetData ExistingAssetData;
+					const bool bExists = FindIndexedAsset(Result.AssetObjectPath, ExistingAssetData);
+					AddPlannedChange(FString::Printf(
+						TEXT("%s %s and set it as the editor startup and game default map"),
+						bExists && !bForceCreate ? TEXT("use existing") : TEXT("create"),
+						*Result.AssetPath));
+				}
+			}
+		}
+		else if (Command == OctoMCP::CommandApplyTextureProfile)
+		{
+			FString PathPrefix;
+			FString ImportProfileName;
+			if (GetString(TEXT("pathPrefix"), true, PathPrefix) && GetString(TEXT("importProfile"), true, ImportProfileName))
+			{
+				FOctoMCPTextureImportProfile ImportProfile;
+				if (!ResolveTextureImportProfile(ImportProfileName, ImportProfile, ErrorMessage))
+				{
+					AddProblem(ErrorMessage);
+				}
+				else
+				{
+					const FQueryAssetsResult QueryResult = QueryAssets(
+						UTexture2D::StaticClass()->GetClassPathName().ToString(),
+						PathPrefix,
+						FString(),
+						TArray<TPair<FName, FString>>(),
+						0,
+						1);
+					AddPlannedChange(FString::Printf(
+						TEXT("apply profile %s to up to %d texture(s) under %s"),
+						*ImportProfile.Name,
+						QueryResult.TotalCount,
+						*PathPrefix));
+				}
+			}
+		}
+		else if (Command == OctoMCP::CommandPackIconAtlas)
+		{
+			FString AtlasAssetPath;
+			FString PathPrefix;
+			FString EntryWidgetAssetPath;
+			TArray<FString> TextureAssetPaths;
+			int32 PageSize = OctoMCP::DefaultIconAtlasPageSize;
+			int32 Padding = OctoMCP::DefaultIconAtlasPadding;
+			if (GetString(TEXT("atlasAssetPath"), true, AtlasAssetPath)
+				&& GetString(TEXT("pathPrefix"), false, PathPrefix)
+				&& GetString(TEXT("entryWidgetAssetPath"), false, EntryWidgetAssetPath)
+				&& GetInt(TEXT("pageSize"), false, PageSize)
+				&& GetInt(TEXT("padding"), false, Padding))
+			{
+				if (!TryGetOptionalStringArrayArgument(ArgumentsObject, TEXT("textureAssetPaths"), TextureAssetPaths, ErrorMessage))
+				{
+					AddProblem(ErrorMessage);
+				}
+
+				if (TextureAssetPaths.IsEmpty() && PathPrefix.IsEmpty())
+				{
+					AddProblem(TEXT("Either textureAssetPaths or pathPrefix must be provided."));
+				}
+
+				if (PageSize < OctoMCP::MinIconAtlasPageSize || PageSize > OctoMCP::MaxIconAtlasPageSize || Padding < 0)
+				{
+					AddProblem(FString::Printf(
+						TEXT("pageSize must be between %d and %d and padding must not be negative."),
+						OctoMCP::MinIconAtlasPageSize,
+						OctoMCP::MaxIconAtlasPageSize));
+				}
+
+				for (const FString& TextureAssetPath : TextureAssetPaths)
+				{
+					FString TextureObjectPath;
+					CheckAsset(TextureAssetPath, UTexture2D::StaticClass(), TextureObjectPath);
+				}
+
+				FString EntryWidgetObjectPath;
+				if (!EntryWidgetAssetPath.IsEmpty())
+				{
+					CheckAsset(EntryWidgetAssetPath, UWidgetBlueprint::StaticClass(), EntryWidgetObjectPath);
+				}
+
+				int32 TextureCount = TextureAssetPaths.Num();
+				if (!PathPrefix.IsEmpty())
+				{
+					TextureCount += QueryAssets(
+						UTexture2D::StaticClass()->GetClassPathName().ToString(),
+						PathPrefix,
+						FString(),
+						TArray<TPair<FName, FString>>(),
+						0,
+						1).TotalCount;
+				}
+
+				Result.AssetPath = AtlasAssetPath;
+				AddPlannedChange(FString::Printf(
+					TEXT("pack up to %d icon(s) into %s on %dx%d pages"),
+					TextureCount,
+					*AtlasAssetPath,
+					PageSize,
+					PageSize));
+			}
+		}
+		else if (Command == OctoMCP::CommandApplyWidgetTree)
+		{
+			TSharedPtr<FJsonObject> TreeObject;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass()))
+			{
+				if (!TryGetRequiredObjectArgument(ArgumentsObject, TEXT("tree"), TreeObject, ErrorMessage))
+				{
+					AddProblem(ErrorMessage);
+				}
+				else
+				{
+					DryRunApplyWidgetTree(TreeObject, TreeMetadata, Result);
+				}
+			}
+		}
+		else if (Command == OctoMCP::CommandFlushSaves)
+		{
+			for (const FString& PackageName : PendingSavePackageNames)
+			{
+				AddPlannedChange(FString::Printf(TEXT("save %s"), *PackageName));
+			}
+		}
+		else if (Command == OctoMCP::CommandSetWidgetBackgroundBlur)
+		{
+			FString WidgetName;
+			float BlurStrength = 0.0f;
+			int32 BlurRadius = 0;
+			bool bApplyAlphaToBlur = true;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass())
+				&& GetString(TEXT("widgetName"), true, WidgetName)
+				&& GetFloat(TEXT("blurStrength"), false, BlurStrength)
+				&& GetInt(TEXT("blurRadius"), false, BlurRadius)
+				&& GetBool(TEXT("applyAlphaToBlur"), bApplyAlphaToBlur))
+			{
+				const FOctoMCPWidgetMetadata* const WidgetMetadata =
+					CheckWidget(WidgetName, {UBackgroundBlur::StaticClass(), UContentWidget::StaticClass()});
+				const UClass* const WidgetClass = WidgetMetadata != nullptr ? WidgetMetadata->WidgetClass.Get() : nullptr;
+				AddPlannedChange(FString::Printf(
+					TEXT("%s background blur on %s"),
+					WidgetClass != nullptr && !WidgetClass->IsChildOf(UBackgroundBlur::StaticClass()) ? TEXT("wrap content in a") : TEXT("set"),
+					*WidgetName));
+			}
+		}
+		else if (Command == OctoMCP::CommandSetWidgetCornerRadius)
+		{
+			FString WidgetName;
+			float Radius = 0.0f;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass())
+				&& GetString(TEXT("widgetName"), true, WidgetName)
+				&& GetFloat(TEXT("radius"), true, Radius))
+			{
+				CheckWidget(WidgetName, {UBackgroundBlur::StaticClass(), UBorder::StaticClass()});
+				AddPlannedChange(FString::Printf(TEXT("set corner radius of %s to %.1f"), *WidgetName, Radius));
+			}
+		}
+		else if (Command == OctoMCP::CommandSetWidgetPanelColor)
+		{
+			FString WidgetName;
+			float Red = 0.0f;
+			float Green = 0.0f;
+			float Blue = 0.0f;
+			float Alpha = 1.0f;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass())
+				&& GetString(TEXT("widgetName"), true, WidgetName)
+				&& GetFloat(TEXT("red"), true, Red)
+				&& GetFloat(TEXT("green"), true, Green)
+				&& GetFloat(TEXT("blue"), true, Blue)
+				&& GetFloat(TEXT("alpha"), true, Alpha))
+			{
+				CheckWidget(WidgetName, {UBorder::StaticClass(), UButton::StaticClass(), UImage::StaticClass()});
+				AddPlannedChange(FString::Printf(
+					TEXT("set color of %s to (%.3f, %.3f, %.3f, %.3f)"),
+					*WidgetName,
+					Red,
+					Green,
+					Blue,
+					Alpha));
+			}
+		}
+		else if (Command == OctoMCP::CommandSetSizeBoxHeightOverride)
+		{
+			FString WidgetName;
+			float HeightOverride = 0.0f;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass())
+				&& GetString(TEXT("widgetName"), true, WidgetName)
+				&& GetFloat(TEXT("heightOverride"), true, HeightOverride))
+			{
+				CheckWidget(WidgetName, {USizeBox::StaticClass()});
+				AddPlannedChange(FString::Printf(TEXT("set HeightOverride of %s to %.1f"), *WidgetName, HeightOverride));
+			}
+		}
+		else if (Command == OctoMCP::CommandSetPopupOpenElasticScale)
+		{
+			FString WidgetName = TEXT("PopupCard");
+			bool bEnabled = true;
+			float Duration = 0.0f;
+			float StartScale = 0.0f;
+			float OscillationCount = 0.0f;
+			float PivotX = 0.0f;
+			float PivotY = 0.0f;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass())
+				&& GetBool(TEXT("enabled"), bEnabled)
+				&& GetString(TEXT("widgetName"), false, WidgetName)
+				&& GetFloat(TEXT("duration"), false, Duration)
+				&& GetFloat(TEXT("startScale"), false, StartScale)
+				&& GetFloat(TEXT("oscillationCount"), false, OscillationCount)
+				&& GetFloat(TEXT("pivotX"), false, PivotX)
+				&& GetFloat(TEXT("pivotY"), false, PivotY))
+			{
+				bool bFoundUnloadedBlueprint = false;
+				const UClass* const PopupWidgetClass =
+					FindClassWithoutLoading(TEXT("UMCPPopupWidget"), UUserWidget::StaticClass(), bFoundUnloadedBlueprint, ErrorMessage);
+				const UClass* const ParentClass = TreeMetadata != nullptr ? TreeMetadata->ParentClass.Get() : nullptr;
+				if (PopupWidgetClass == nullptr)
+				{
+					AddProblem(ErrorMessage);
+				}
+				else if (ParentClass != nullptr && !ParentClass->IsChildOf(PopupWidgetClass))
+				{
+					AddProblem(FString::Printf(
+						TEXT("%s derives from %s, not from %s."),
+						*Result.AssetObjectPath,
+						*ParentClass->GetName(),
+						*PopupWidgetClass->GetName()));
+				}
+
+				CheckWidget(WidgetName, {});
+				AddPlannedChange(FString::Printf(
+					TEXT("%s the open elastic scale on %s"),
+					bEnabled ? TEXT("enable") : TEXT("disable"),
+					*WidgetName));
+			}
+		}
+		else if (Command == OctoMCP::CommandSetWidgetImageTexture)
+		{
+			FString WidgetName;
+			FString TextureAssetPath;
+			bool bMatchTextureSize = true;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass())
+				&& GetString(TEXT("widgetName"), true, WidgetName)
+				&& GetString(TEXT("textureAssetPath"), true, TextureAssetPath)
+				&& GetBool(TEXT("matchTextureSize"), bMatchTextureSize))
+			{
+				FString TextureObjectPath;
+				CheckWidget(WidgetName, {UImage::StaticClass()});
+				CheckAsset(TextureAssetPath, UTexture2D::StaticClass(), TextureObjectPath);
+				AddPlannedChange(FString::Printf(TEXT("set %s brush to %s"), *WidgetName, *TextureAssetPath));
+			}
+		}
+		else if (Command == OctoMCP::CommandSetWidgetProperties)
+		{
+			TArray<TSharedPtr<FJsonObject>> EntryObjects;
+			if (CheckTargetAsset(UWidgetBlueprint::StaticClass()))
+			{
+				if (!TryGetRequiredObjectArrayArgument(ArgumentsObject, TEXT("entries"), EntryObjects, ErrorMessage))
+				{
+					AddProblem(ErrorMessage);
+				}
+
+				for (int32 EntryIndex = 0; EntryIndex < EntryObjects.Num(); ++EntryIndex)
+				{
+					FString WidgetName;
+					FString PropertyPath;
+					if (!EntryObjects[EntryIndex]->TryGetStringField(TEXT("widget"), WidgetName)
+						|| !EntryObjects[EntryIndex]->TryGetStringField(TEXT("propertyPath"), PropertyPath)
+						|| !EntryObjects[EntryIndex]->HasField(TEXT("value")))
+					{
+						AddProblem(FString::Printf(TEXT("entries[%d] must have widget, propertyPath and value."), EntryIndex));
+						continue;
+					}
+
+					WidgetName.TrimStartAndEndInline();
+					PropertyPath.TrimStartAndEndInline();
+					AddPlannedChange(FString::Printf(TEXT("set %s.%s"), *WidgetName, *PropertyPath));
+
+					const FOctoMCPWidgetMetadata* const WidgetMetadata = CheckWidget(WidgetName, {});
+					if (WidgetMetadata == nullptr)
+					{
+						continue;
+					}
+
+					FString ValueText;
+					if (!OctoMCP::JsonValueToImportText(EntryObjects[EntryIndex]->TryGetField(TEXT("value")), ValueText))
+					{
+						AddProblem(FString::Printf(
+							TEXT("entries[%d].value must be a string (Unreal import text), number or boolean."),
+							EntryIndex));
+						continue;
+					}
+
+					// Paths and values are parsed against the classes alone, with the same parser the real edit uses.
+					const bool bSlotPath = PropertyPath.StartsWith(TEXT("Slot."), ESearchCase::IgnoreCase);
+					const UClass* const OwnerClass = bSlotPath ? WidgetMetadata->SlotClass.Get() : WidgetMetadata->WidgetClass.Get();
+					if (OwnerClass == nullptr)
+					{
+						if (bSlotPath)
+						{
+							AddProblem(FString::Printf(TEXT("entries[%d]: %s has no parent panel slot."), EntryIndex, *WidgetName));
+						}
+
+						continue;
+					}
+
+					FOctoMCPParsedPropertyValue ParsedValue;
+					if (!ParsePropertyValueText(
+							OwnerClass,
+							OwnerClass->GetDefaultObject(),
+							bSlotPath ? PropertyPath.RightChop(5) : PropertyPath,
+							ValueText,
+							ParsedValue,
+							ErrorMessage))
+					{
+						AddProblem(FString::Printf(TEXT("entries[%d]: %s"), EntryIndex, *ErrorMessage));
+					}
+				}
+			}
+		}
+
+		Result.bSuccess = Result.Problems.IsEmpty();
+		Result.Message = Result.bSuccess
+			? FString::Printf(
+				TEXT("Dry run of %s passed with %d planned change(s); nothing was modified."),
+				*Command,
+				Result.PlannedChanges.Num())
+			: FString::Printf(
+				TEXT("Dry run of %s found %d problem(s): %s"),
+				*Command,
+				Result.Problems.Num(),
+				*Result.Problems[0]);
+		return Result;
+	}
@@ -58,7 +58,7 @@
 			return Result;
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr)
 		{
 			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
@@ -192,7 +192,7 @@
 			return Result;
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
 		{
 			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
@@ -365,7 +365,7 @@
 			return Result;
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
 		{
 			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
@@ -523,7 +523,7 @@
 			return Result;
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
 		{
 			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
@@ -664,7 +664,7 @@
 			return Result;
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
 		{
 			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
@@ -796,7 +796,7 @@
 			Result.WidgetName = TEXT("PopupCard");
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr)
 		{
 			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
@@ -996,7 +996,7 @@
 			return Result;
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
 		{
 			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
@@ -1162,7 +1162,7 @@
 			return Result;
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
 		{
 			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
@@ -1324,7 +1324,7 @@
 			return Result;
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
 		{
 			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
@@ -1354,97 +1354,207 @@
 		}
 		Result.EntryWidgetClassName = EntryWidgetClass->GetName();
 
-		WidgetBlueprint->Modify();
-		WidgetBlueprint->WidgetTree->Modify();
-		GridWidget->SetFlags(RF_Transactional);
-		GridWidget->Modify();
+		// Everything below is linear in the tree and grid size: one name index, one classification pass,
+		// a single batched delete, and one rebuild of the grid's slot array from the first out-of-place child.
+		TMap<FName, UWidget*> WidgetsByName;
+		{
+			TArray<UWidget*> AllWidgets;
+			WidgetBlueprint->WidgetTree->GetAllWidgets(AllWidgets);
+			WidgetsByName.Reserve(AllWidgets.Num());
+			for (UWidget* const Widget : AllWidgets)
+			{
+				if (Widget != nullptr)
+				{
+					WidgetsByName.Add(Widget->GetFName(), Widget);
+				}
+			}
+		}
 
-		TSet<FString> DesiredChildNames;
+		TArray<FName> DesiredChildNames;
+		TSet<UWidget*> DesiredChildren;
+		TArray<UWidget*> TargetChildren;
+		TSet<UWidget*> WidgetsToDelete;
+		DesiredChildNames.Reserve(Result.Count);
+		DesiredChildren.Reserve(Result.Count);
+		TargetChildren.Reserve(Result.Count);
 		for (int32 Index = 0; Index < Result.Count; ++Index)
 		{
-			const FString DesiredWidgetName = FString::Printf(TEXT("%s%d"), *Result.InstanceNamePrefix, Index);
+			const FName DesiredWidgetName(*FString::Printf(TEXT("%s%d"), *Result.InstanceNamePrefix, Index));
 			DesiredChildNames.Add(DesiredWidgetName);
 
-			bool bCreatedChild = false;
-			bool bReplacedChild = false;
-			UWidget* const ChildWidget = EnsureWidgetInstanceOfClass(
-				WidgetBlueprint,
-				EntryWidgetClass,
-				*DesiredWidgetName,
-				bCreatedChild,
-				bReplacedChild,
-				ErrorMessage);
-			if (ChildWidget == nullptr)
+			UWidget* const ExistingWidget = WidgetsByName.FindRef(DesiredWidgetName);
+			if (ExistingWidget != nullptr && ExistingWidget->IsA(EntryWidgetClass))
 			{
-				Result.Message = ErrorMessage;
-				return Result;
+				DesiredChildren.Add(ExistingWidget);
+				TargetChildren.Add(ExistingWidget);
+				++Result.ReusedCount;
+				continue;
 			}
 
-			ChildWidget->SetFlags(RF_Transactional);
-			ChildWidget->Modify();
+			if (ExistingWidget != nullptr)
+			{
+				if (ExistingWidget->bIsVariable && FBlueprintEditorUtils::IsVariableUsed(WidgetBlueprint, ExistingWidget->GetFName()))
+				{
+					Result.Message = FString::Printf(
+						TEXT("Widget %s is referenced in the graph and cannot be replaced automatically."),
+						*DesiredWidgetName.ToString());
+					return Result;
+				}
 
-			UUniformGridSlot* const GridSlot = Cast<UUniformGridSlot>(EnsurePanelChildAt(GridWidget, ChildWidget, Index));
-			if (GridSlot == nullptr)
+				WidgetsToDelete.Add(ExistingWidget);
+			}
+
+			// Placeholder; the instance is constructed once any widget holding its name has been deleted.
+			TargetChildren.Add(nullptr);
+			++Result.CreatedCount;
+		}
+
+		const TArray<UWidget*> CurrentChildren = GridWidget->GetAllChildren();
+		for (UWidget* const ChildWidget : CurrentChildren)
+		{
+			if (ChildWidget == nullptr || DesiredChildren.Contains(ChildWidget) || WidgetsToDelete.Contains(ChildWidget))
+			{
+				continue;
+			}
+
+			if (bTrimManagedChildren && ChildWidget->GetName().StartsWith(Result.InstanceNamePrefix))
+			{
+				WidgetsToDelete.Add(ChildWidget);
+				++Result.RemovedCount;
+				continue;
+			}
+
+			TargetChildren.Add(ChildWidget);
+		}
+
+		int32 FirstMismatchIndex = 0;
+		while (FirstMismatchIndex < CurrentChildren.Num()
+			&& FirstMismatchIndex < TargetChildren.Num()
+			&& CurrentChildren[FirstMismatchIndex] == TargetChildren[FirstMismatchIndex])
+		{
+			++FirstMismatchIndex;
+		}
+
+		const bool bStructureChanged =
+			FirstMismatchIndex < CurrentChildren.Num() || FirstMismatchIndex < TargetChildren.Num() || !WidgetsToDelete.IsEmpty();
+
+		if (bStructureChanged)
+		{
+			WidgetBlueprint->Modify();
+			WidgetBlueprint->WidgetTree->Modify();
+			GridWidget->SetFlags(RF_Transactional);
+			GridWidget->Modify();
+		}
+
+		// Detach the tail from the end so each removal is O(1); the old slots are kept as templates
+		// so re-added children keep their alignment and other slot settings.
+		TMap<UWidget*, UPanelSlot*> SlotTemplates;
+		SlotTemplates.Reserve(CurrentChildren.Num() - FirstMismatchIndex);
+		for (int32 ChildIndex = CurrentChildren.Num() - 1; ChildIndex >= FirstMismatchIndex; --ChildIndex)
+		{
+			if (UWidget* const ChildWidget = CurrentChildren[ChildIndex])
+			{
+				SlotTemplates.Add(ChildWidget, ChildWidget->Slot);
+			}
+
+			GridWidget->RemoveChildAt(ChildIndex);
+		}
+
+		if (!WidgetsToDelete.IsEmpty())
+		{
+			FWidgetBlueprintEditorUtils::DeleteWidgets(
+				WidgetBlueprint,
+				WidgetsToDelete,
+				FWidgetBlueprintEditorUtils::EDeleteWidgetWarningType::DeleteSilently);
+		}
+
+		for (int32 Index = 0; Index < Result.Count; ++Index)
+		{
+			if (TargetChildren[Index] != nullptr)
+			{
+				continue;
+			}
+
+			TargetChildren[Index] = WidgetBlueprint->WidgetTree->ConstructWidget<UWidget>(EntryWidgetClass, DesiredChildNames[Index]);
+			if (TargetChildren[Index] == nullptr)
 			{
 				Result.Message = FString::Printf(
-					TEXT("Failed to insert widget %s into UniformGridPanel %s."),
-					*DesiredWidgetName,
-					*Result.GridWidgetName);
+					TEXT("Failed to create widget %s of class %s."),
+					*DesiredChildNames[Index].ToString(),
+					*EntryWidgetClass->GetPathName());
 				return Result;
 			}
+		}
 
-			GridSlot->SetRow(Index / Result.ColumnCount);
-			GridSlot->SetColumn(Index % Result.ColumnCount);
+		for (int32 ChildIndex = FirstMismatchIndex; ChildIndex < TargetChildren.Num(); ++ChildIndex)
+		{
+			UWidget* const ChildWidget = TargetChildren[ChildIndex];
+			ChildWidget->SetFlags(RF_Transactional);
+			ChildWidget->Modify();
 
-			if (bCreatedChild || bReplacedChild)
+			UPanelSlot* SlotTemplate = SlotTemplates.FindRef(ChildWidget);
+			if (SlotTemplate == nullptr && ChildWidget->Slot != nullptr && ChildWidget->Slot->IsA(GridWidget->GetSlotClass()))
 			{
-				++Result.CreatedCount;
+				SlotTemplate = ChildWidget->Slot;
 			}
-			else
+
+			UPanelSlot* const AddedSlot = SlotTemplate != nullptr
+				? GridWidget->AddChild(ChildWidget, SlotTemplate)
+				: GridWidget->AddChild(ChildWidget);
+			if (AddedSlot == nullptr)
 			{
-				++Result.ReusedCount;
+				Result.Message = FString::Printf(
+					TEXT("Failed to insert widget %s into UniformGridPanel %s."),
+					*ChildWidget->GetName(),
+					*Result.GridWidgetName);
+				return Result;
 			}
 		}
 
-		if (bTrimManagedChildren)
+		bool bSlotsChanged = false;
+		for (int32 Index = 0; Index < Result.Count; ++Index)
 		{
-			TSet<UWidget*> WidgetsToDelete;
-			for (int32 ChildIndex = 0; ChildIndex < GridWidget->GetChildrenCount(); ++ChildIndex)
+			UUniformGridSlot* const GridSlot = Cast<UUniformGridSlot>(TargetChildren[Index]->Slot);
+			if (GridSlot == nullptr)
 			{
-				UWidget* const ChildWidget = GridWidget->GetChildAt(ChildIndex);
-				if (ChildWidget == nullptr)
-				{
-					continue;
-				}
-
-				const FString ChildWidgetName = ChildWidget->GetName();
-				if (ChildWidgetName.StartsWith(Result.InstanceNamePrefix) && !DesiredChildNames.Contains(ChildWidgetName))
-				{
-					WidgetsToDelete.Add(ChildWidget);
-				}
+				Result.Message = FString::Printf(
+					TEXT("Widget %s is not in a UniformGridSlot of %s."),
+					*DesiredChildNames[Index].ToString(),
+					*Result.GridWidgetName);
+				return Result;
 			}
 
-			if (WidgetsToDelete.Num() > 0)
+			const int32 Row = Index / Result.ColumnCount;
+			const int32 Column = Index % Result.ColumnCount;
+			if (GridSlot->GetRow() != Row || GridSlot->GetColumn() != Column)
 			{
-				Result.RemovedCount = WidgetsToDelete.Num();
-				FWidgetBlueprintEditorUtils::DeleteWidgets(
-					WidgetBlueprint,
-					WidgetsToDelete,
-					FWidgetBlueprintEditorUtils::EDeleteWidgetWarningType::DeleteSilently);
+				GridSlot->SetFlags(RF_Transactional);
+				GridSlot->Modify();
+				GridSlot->SetRow(Row);
+				GridSlot->SetColumn(Column);
+				bSlotsChanged = true;
 			}
 		}
 
-		for (int32 ChildIndex = 0; ChildIndex < GridWidget->GetChildrenCount(); ++ChildIndex)
+		for (UWidget* const ChildWidget : TargetChildren)
 		{
-			if (UWidget* const ChildWidget = GridWidget->GetChildAt(ChildIndex))
+			if (ChildWidget->GetName().StartsWith(Result.InstanceNamePrefix))
 			{
-				if (ChildWidget->GetName().StartsWith(Result.InstanceNamePrefix))
-				{
-					++Result.ManagedCount;
-				}
+				++Result.ManagedCount;
 			}
 		}
 
+		if (!bStructureChanged && !bSlotsChanged)
+		{
+			Result.bSuccess = true;
+			Result.Message = FString::Printf(
+				TEXT("UniformGridPanel %s already has %d managed widget instances with prefix %s; nothing to compile."),
+				*Result.GridWidgetName,
+				Result.ManagedCount,
+				*Result.InstanceNamePrefix);
+			return Result;
+		}
+
 		WidgetBlueprint->MarkPackageDirty();
 		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
 		FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
@@ -1675,7 +1785,7 @@
 			return Result;
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
 		{
 			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
@@ -1838,7 +1948,7 @@
 			return Result;
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
 		{
 			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
@@ -1981,7 +2091,7 @@
 			return Result;
 		}
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
 		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
 		{
 			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
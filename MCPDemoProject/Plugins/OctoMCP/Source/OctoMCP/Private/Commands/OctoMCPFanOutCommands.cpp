@@ -0,0 +1,248 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OctoMCPModule.h"
+
+namespace
+{
+	// Accepts a short class name (with or without the U prefix), a /Script path, or a Blueprint asset path.
+	bool DoesParentClassTagMatch(const FString& TagValue, const FString& ParentClass)
+	{
+		if (TagValue.IsEmpty())
+		{
+			return false;
+		}
+
+		const FString ClassObjectPath = FPackageName::ExportTextPathToObjectPath(TagValue);
+		if (ClassObjectPath.Equals(ParentClass, ESearchCase::IgnoreCase))
+		{
+			return true;
+		}
+
+		FString ClassName = ClassObjectPath;
+		int32 SeparatorIndex = INDEX_NONE;
+		if (ClassName.FindLastChar(TEXT('.'), SeparatorIndex))
+		{
+			ClassName.RightChopInline(SeparatorIndex + 1, EAllowShrinking::No);
+		}
+
+		FString WantedName = ParentClass;
+		if (WantedName.StartsWith(TEXT("/")))
+		{
+			// Blueprint asset path: /Game/UI/WBP_Base or /Game/UI/WBP_Base.WBP_Base
+			WantedName = FPackageName::GetShortName(FPackageName::ObjectPathToPackageName(WantedName)) + TEXT("_C");
+		}
+		else if (WantedName.Len() > 1 && WantedName[0] == TEXT('U') && FChar::IsUpper(WantedName[1]))
+		{
+			WantedName.RightChopInline(1, EAllowShrinking::No);
+		}
+
+		return ClassName.Equals(WantedName, ESearchCase::IgnoreCase);
+	}
+}
+
+	bool FOctoMCPModule::ResolveFanOutAssetPaths(
+		const FOctoMCPAssetTargets& AssetTargets,
+		TArray<FString>& OutAssetPaths,
+		FString& OutError) const
+	{
+		OutAssetPaths.Reset();
+
+		// One pass over the in-memory index; the indexed asset data already carries the Blueprint parent tags.
+		FRWScopeLock ReadLock(AssetIndexLock, SLT_ReadOnly);
+		if (!bAssetIndexReady)
+		{
+			OutError = TEXT("The asset registry is still scanning; the index is not populated yet.");
+			return false;
+		}
+
+		TArray<int32> MatchedSlots;
+		CollectMatchingIndexedAssetSlots(
+			AssetTargets.ClassPath,
+			AssetTargets.PathPrefix,
+			FString(),
+			TArray<TPair<FName, FString>>(),
+			MatchedSlots);
+
+		for (const int32 Slot : MatchedSlots)
+		{
+			const FAssetData& AssetData = IndexedAssets[Slot].AssetData;
+			if (!AssetTargets.NamePattern.IsEmpty()
+				&& !AssetData.AssetName.ToString().MatchesWildcard(AssetTargets.NamePattern))
+			{
+				continue;
+			}
+
+			if (!AssetTargets.ParentClass.IsEmpty())
+			{
+				FString ParentClassTag;
+				FString NativeParentClassTag;
+				AssetData.GetTagValue(FBlueprintTags::ParentClassPath, ParentClassTag);
+				AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentClassTag);
+				if (!DoesParentClassTagMatch(ParentClassTag, AssetTargets.ParentClass)
+					&& !DoesParentClassTagMatch(NativeParentClassTag, AssetTargets.ParentClass))
+				{
+					continue;
+				}
+			}
+
+			OutAssetPaths.Add(IndexedAssets[Slot].PackageNameString);
+		}
+
+		return true;
+	}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildFanOutObject(
+		const FOctoMCPAssetTargets& AssetTargets,
+		const bool bSaveAsset,
+		const bool bDeferSave,
+		TFunctionRef<TSharedRef<FJsonObject>(const FString& AssetPath, const bool bSaveAsset)> BuildAssetResult) const
+	{
+		// A plain assetPath keeps the command's own result shape and save handling.
+		if (!AssetTargets.bFanOut)
+		{
+			TSharedRef<FJsonObject> ResultObject = BuildAssetResult(AssetTargets.AssetPath, bSaveAsset && !bDeferSave);
+			if (bSaveAsset && bDeferSave)
+			{
+				QueueDeferredSave(ResultObject);
+			}
+
+			return ResultObject;
+		}
+
+		const FFanOutResult FanOutResult = RunFanOut(AssetTargets, bSaveAsset, bDeferSave, BuildAssetResult);
+
+		TArray<TSharedPtr<FJsonValue>> FailedPackageValues;
+		for (const FString& FailedPackage : FanOutResult.FailedPackages)
+		{
+			FailedPackageValues.Add(MakeShared<FJsonValueString>(FailedPackage));
+		}
+
+		TSharedRef<FJsonObject> QueryObject = MakeShared<FJsonObject>();
+		QueryObject->SetStringField(TEXT("pathPrefix"), AssetTargets.PathPrefix);
+		QueryObject->SetStringField(TEXT("classPath"), AssetTargets.ClassPath);
+		QueryObject->SetStringField(TEXT("namePattern"), AssetTargets.NamePattern);
+		QueryObject->SetStringField(TEXT("parentClass"), AssetTargets.ParentClass);
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetBoolField(TEXT("fanOut"), true);
+		ResultObject->SetBoolField(TEXT("saved"), FanOutResult.bSaved);
+		ResultObject->SetBoolField(TEXT("saveQueued"), FanOutResult.bSaveQueued);
+		ResultObject->SetBoolField(TEXT("success"), FanOutResult.bSuccess);
+		ResultObject->SetNumberField(TEXT("matchedCount"), FanOutResult.MatchedCount);
+		ResultObject->SetNumberField(TEXT("succeededCount"), FanOutResult.SucceededCount);
+		ResultObject->SetNumberField(TEXT("failedCount"), FanOutResult.FailedCount);
+		ResultObject->SetNumberField(TEXT("savedCount"), FanOutResult.SavedCount);
+		ResultObject->SetStringField(TEXT("message"), FanOutResult.Message);
+		ResultObject->SetObjectField(TEXT("assetQuery"), QueryObject);
+		ResultObject->SetArrayField(TEXT("failedPackages"), FailedPackageValues);
+		ResultObject->SetArrayField(TEXT("assets"), FanOutResult.Assets);
+		return ResultObject;
+	}
+
+	FFanOutResult FOctoMCPModule::RunFanOut(
+		const FOctoMCPAssetTargets& AssetTargets,
+		const bool bSaveAsset,
+		const bool bDeferSave,
+		TFunctionRef<TSharedRef<FJsonObject>(const FString& AssetPath, const bool bSaveAsset)> BuildAssetResult) const
+	{
+		FFanOutResult Result;
+
+		TArray<FString> AssetPaths;
+		FString ErrorMessage;
+		if (!ResolveFanOutAssetPaths(AssetTargets, AssetPaths, ErrorMessage))
+		{
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		Result.MatchedCount = AssetPaths.Num();
+		if (AssetPaths.IsEmpty())
+		{
+			Result.bSuccess = true;
+			Result.Message = TEXT("No assets matched assetQuery; nothing was changed.");
+			return Result;
+		}
+
+		// Each asset is edited and compiled by the command itself with saving disabled; the dirty packages
+		// are then written in one batch instead of one save per asset.
+		TArray<UPackage*> PackagesToSave;
+		TMap<UPackage*, TSharedPtr<FJsonObject>> AssetResultsByPackage;
+		Result.Assets.Reserve(AssetPaths.Num());
+		for (const FString& AssetPath : AssetPaths)
+		{
+			const TSharedRef<FJsonObject> AssetResult = BuildAssetResult(AssetPath, false);
+			Result.Assets.Add(MakeShared<FJsonValueObject>(AssetResult));
+
+			bool bAssetSucceeded = false;
+			if (!AssetResult->TryGetBoolField(TEXT("success"), bAssetSucceeded) || !bAssetSucceeded)
+			{
+				++Result.FailedCount;
+				continue;
+			}
+
+			++Result.SucceededCount;
+
+			UPackage* const Package = FindPackage(nullptr, *AssetPath);
+			if (bSaveAsset && Package != nullptr && Package->IsDirty())
+			{
+				PackagesToSave.Add(Package);
+				AssetResultsByPackage.Add(Package, AssetResult);
+			}
+		}
+
+		if (!PackagesToSave.IsEmpty())
+		{
+			if (bDeferSave)
+			{
+				for (UPackage* const Package : PackagesToSave)
+				{
+					if (QueueDeferredPackageSave(Package->GetName()))
+					{
+						AssetResultsByPackage.FindChecked(Package)->SetBoolField(TEXT("saveQueued"), true);
+						Result.bSaveQueued = true;
+					}
+				}
+			}
+			else
+			{
+				TArray<UPackage*> FailedPackages;
+				FEditorFileUtils::PromptForCheckoutAndSave(PackagesToSave, true, false, &FailedPackages);
+
+				for (UPackage* const Package : PackagesToSave)
+				{
+					const bool bPackageSaved = !FailedPackages.Contains(Package);
+					AssetResultsByPackage.FindChecked(Package)->SetBoolField(TEXT("saved"), bPackageSaved);
+					if (bPackageSaved)
+					{
+						++Result.SavedCount;
+					}
+					else
+					{
+						Result.FailedPackages.Add(Package->GetName());
+					}
+				}
+
+				Result.bSaved = Result.SavedCount > 0;
+			}
+		}
+
+		Result.bSuccess = Result.FailedCount == 0 && Result.FailedPackages.IsEmpty();
+		Result.Message = FString::Printf(
+			TEXT("Applied to %d of %d matched asset(s); %d failed, %d saved."),
+			Result.SucceededCount,
+			Result.MatchedCount,
+			Result.FailedCount,
+			Result.SavedCount);
+		if (Result.bSaveQueued)
+		{
+			Result.Message += FString::Printf(TEXT(" Save queued (%d package(s) pending)."), PendingSavePackageNames.Num());
+		}
+		if (!Result.FailedPackages.IsEmpty())
+		{
+			Result.Message += FString::Printf(
+				TEXT(" Failed to save: %s"),
+				*FString::Join(Result.FailedPackages, TEXT(", ")));
+		}
+
+		return Result;
+	}
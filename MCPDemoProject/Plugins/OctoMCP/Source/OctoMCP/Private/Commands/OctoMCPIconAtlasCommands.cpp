@@ -0,0 +1,599 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OctoMCPModule.h"
+
+namespace
+{
+	struct FOctoMCPAtlasIcon
+	{
+		FName IconId;
+		FString SourcePath;
+		FImage Pixels;
+		int32 PageIndex = INDEX_NONE;
+		int32 X = 0;
+		int32 Y = 0;
+	};
+
+	// Shelf packer: icons are placed left to right on the current shelf and a new shelf (or page)
+	// starts when the next icon does not fit. Sorting by height first keeps shelves tight.
+	int32 PackAtlasIcons(TArray<FOctoMCPAtlasIcon>& Icons, const int32 PageSize, const int32 Padding)
+	{
+		Icons.StableSort([](const FOctoMCPAtlasIcon& Left, const FOctoMCPAtlasIcon& Right)
+		{
+			if (Left.Pixels.SizeY != Right.Pixels.SizeY)
+			{
+				return Left.Pixels.SizeY > Right.Pixels.SizeY;
+			}
+
+			return Left.Pixels.SizeX > Right.Pixels.SizeX;
+		});
+
+		int32 PageIndex = 0;
+		int32 CursorX = 0;
+		int32 CursorY = 0;
+		int32 ShelfHeight = 0;
+		for (FOctoMCPAtlasIcon& Icon : Icons)
+		{
+			const int32 CellWidth = Icon.Pixels.SizeX + Padding * 2;
+			const int32 CellHeight = Icon.Pixels.SizeY + Padding * 2;
+
+			if (CursorX + CellWidth > PageSize)
+			{
+				CursorX = 0;
+				CursorY += ShelfHeight;
+				ShelfHeight = 0;
+			}
+
+			if (CursorY + CellHeight > PageSize)
+			{
+				++PageIndex;
+				CursorX = 0;
+				CursorY = 0;
+				ShelfHeight = 0;
+			}
+
+			Icon.PageIndex = PageIndex;
+			Icon.X = CursorX + Padding;
+			Icon.Y = CursorY + Padding;
+			CursorX += CellWidth;
+			ShelfHeight = FMath::Max(ShelfHeight, CellHeight);
+		}
+
+		return Icons.IsEmpty() ? 0 : PageIndex + 1;
+	}
+
+	// Copies the icon into the page and extrudes its edge pixels into the padding so bilinear
+	// sampling at the UV border never picks up a neighbouring icon.
+	void BlitAtlasIcon(const FOctoMCPAtlasIcon& Icon, TArray<FColor>& PagePixels, const int32 PageSize, const int32 Padding)
+	{
+		const TArrayView64<const FColor> SourcePixels = Icon.Pixels.AsBGRA8();
+		const int32 Width = Icon.Pixels.SizeX;
+		const int32 Height = Icon.Pixels.SizeY;
+
+		for (int32 DestY = Icon.Y - Padding; DestY < Icon.Y + Height + Padding; ++DestY)
+		{
+			const int32 SourceY = FMath::Clamp(DestY - Icon.Y, 0, Height - 1);
+			for (int32 DestX = Icon.X - Padding; DestX < Icon.X + Width + Padding; ++DestX)
+			{
+				const int32 SourceX = FMath::Clamp(DestX - Icon.X, 0, Width - 1);
+				PagePixels[DestY * PageSize + DestX] = SourcePixels[static_cast<int64>(SourceY) * Width + SourceX];
+			}
+		}
+	}
+
+	template <typename TPropertyType>
+	TPropertyType* FindAtlasEntryMember(const UScriptStruct* EntryStruct, const TCHAR* MemberName, FString& OutError)
+	{
+		TPropertyType* const Property = CastField<TPropertyType>(EntryStruct->FindPropertyByName(FName(MemberName)));
+		if (Property == nullptr)
+		{
+			OutError = FString::Printf(
+				TEXT("Icon atlas entry struct %s does not have the expected member %s."),
+				*EntryStruct->GetPathName(),
+				MemberName);
+		}
+
+		return Property;
+	}
+}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildPackIconAtlasObject(
+		const FString& AtlasAssetPath,
+		const TArray<FString>& TextureAssetPaths,
+		const FString& PathPrefix,
+		const FString& EntryWidgetAssetPath,
+		const int32 PageSize,
+		const int32 Padding,
+		const bool bSaveAsset,
+		const bool bDeferSave) const
+	{
+		const FPackIconAtlasResult PackResult = PackIconAtlas(
+			AtlasAssetPath,
+			TextureAssetPaths,
+			PathPrefix,
+			EntryWidgetAssetPath,
+			PageSize,
+			Padding,
+			bSaveAsset,
+			bDeferSave);
+
+		TArray<TSharedPtr<FJsonValue>> PageAssetValues;
+		for (const FString& PageAssetPath : PackResult.PageAssetPaths)
+		{
+			PageAssetValues.Add(MakeShared<FJsonValueString>(PageAssetPath));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> SkippedTextureValues;
+		for (const FString& SkippedTexture : PackResult.SkippedTextures)
+		{
+			SkippedTextureValues.Add(MakeShared<FJsonValueString>(SkippedTexture));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> DeletedPageAssetValues;
+		for (const FString& DeletedPageAssetPath : PackResult.DeletedPageAssetPaths)
+		{
+			DeletedPageAssetValues.Add(MakeShared<FJsonValueString>(DeletedPageAssetPath));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> StalePageAssetValues;
+		for (const FString& StalePageAssetPath : PackResult.StalePageAssetPaths)
+		{
+			StalePageAssetValues.Add(MakeShared<FJsonValueString>(StalePageAssetPath));
+		}
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetBoolField(TEXT("created"), PackResult.bCreated);
+		ResultObject->SetBoolField(TEXT("saved"), PackResult.bSaved);
+		ResultObject->SetBoolField(TEXT("success"), PackResult.bSuccess);
+		ResultObject->SetNumberField(TEXT("iconCount"), PackResult.IconCount);
+		ResultObject->SetNumberField(TEXT("pageCount"), PackResult.PageCount);
+		ResultObject->SetNumberField(TEXT("pageSize"), PackResult.PageSize);
+		ResultObject->SetNumberField(TEXT("padding"), PackResult.Padding);
+		ResultObject->SetStringField(TEXT("message"), PackResult.Message);
+		ResultObject->SetStringField(TEXT("assetPath"), PackResult.AssetPath);
+		ResultObject->SetStringField(TEXT("assetObjectPath"), PackResult.AssetObjectPath);
+		ResultObject->SetStringField(TEXT("packagePath"), PackResult.PackagePath);
+		ResultObject->SetStringField(TEXT("assetName"), PackResult.AssetName);
+		ResultObject->SetStringField(TEXT("entryWidgetAssetPath"), PackResult.EntryWidgetAssetPath);
+		ResultObject->SetArrayField(TEXT("pageAssetPaths"), PageAssetValues);
+		ResultObject->SetArrayField(TEXT("skippedTextures"), SkippedTextureValues);
+		ResultObject->SetArrayField(TEXT("deletedPageAssetPaths"), DeletedPageAssetValues);
+		ResultObject->SetArrayField(TEXT("stalePageAssetPaths"), StalePageAssetValues);
+		return ResultObject;
+	}
+
+	FPackIconAtlasResult FOctoMCPModule::PackIconAtlas(
+		const FString& InAtlasAssetPath,
+		const TArray<FString>& InTextureAssetPaths,
+		const FString& InPathPrefix,
+		const FString& InEntryWidgetAssetPath,
+		const int32 InPageSize,
+		const int32 InPadding,
+		const bool bSaveAsset,
+		const bool bDeferSave) const
+	{
+		FPackIconAtlasResult Result;
+		Result.PageSize = FMath::Clamp(
+			static_cast<int32>(FMath::RoundUpToPowerOfTwo(FMath::Max(InPageSize, 1))),
+			OctoMCP::MinIconAtlasPageSize,
+			OctoMCP::MaxIconAtlasPageSize);
+		Result.Padding = FMath::Clamp(InPadding, 0, 16);
+
+		FString AssetPackageName;
+		FString AssetObjectPath;
+		FString ErrorMessage;
+		if (!NormalizeWidgetBlueprintAssetPath(
+				InAtlasAssetPath,
+				AssetPackageName,
+				Result.PackagePath,
+				Result.AssetName,
+				AssetObjectPath,
+				ErrorMessage))
+		{
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		Result.AssetPath = AssetPackageName;
+		Result.AssetObjectPath = AssetObjectPath;
+
+		FString AtlasClassPath;
+		UClass* const AtlasClass =
+			ResolveClassReference(TEXT("UMCPIconAtlasData"), UDataAsset::StaticClass(), AtlasClassPath, ErrorMessage);
+		if (AtlasClass == nullptr)
+		{
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		FArrayProperty* const PagesProperty = CastField<FArrayProperty>(AtlasClass->FindPropertyByName(TEXT("Pages")));
+		FObjectPropertyBase* const PageElementProperty =
+			PagesProperty != nullptr ? CastField<FObjectPropertyBase>(PagesProperty->Inner) : nullptr;
+		FArrayProperty* const EntriesProperty = CastField<FArrayProperty>(AtlasClass->FindPropertyByName(TEXT("Entries")));
+		FStructProperty* const EntryElementProperty =
+			EntriesProperty != nullptr ? CastField<FStructProperty>(EntriesProperty->Inner) : nullptr;
+		if (PageElementProperty == nullptr || EntryElementProperty == nullptr)
+		{
+			Result.Message = FString::Printf(
+				TEXT("%s must expose Pages (texture array) and Entries (struct array) properties."),
+				*AtlasClassPath);
+			return Result;
+		}
+
+		const UScriptStruct* const EntryStruct = EntryElementProperty->Struct;
+		FNameProperty* const IconIdProperty = FindAtlasEntryMember<FNameProperty>(EntryStruct, TEXT("IconId"), ErrorMessage);
+		FIntProperty* const PageIndexProperty = FindAtlasEntryMember<FIntProperty>(EntryStruct, TEXT("PageIndex"), ErrorMessage);
+		FStructProperty* const UVMinProperty = FindAtlasEntryMember<FStructProperty>(EntryStruct, TEXT("UVMin"), ErrorMessage);
+		FStructProperty* const UVMaxProperty = FindAtlasEntryMember<FStructProperty>(EntryStruct, TEXT("UVMax"), ErrorMessage);
+		FStructProperty* const PixelSizeProperty = FindAtlasEntryMember<FStructProperty>(EntryStruct, TEXT("PixelSize"), ErrorMessage);
+		if (IconIdProperty == nullptr
+			|| PageIndexProperty == nullptr
+			|| UVMinProperty == nullptr
+			|| UVMaxProperty == nullptr
+			|| PixelSizeProperty == nullptr)
+		{
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		if (UVMinProperty->Struct != TBaseStructure<FVector2D>::Get()
+			|| UVMaxProperty->Struct != TBaseStructure<FVector2D>::Get()
+			|| PixelSizeProperty->Struct != TBaseStructure<FIntPoint>::Get())
+		{
+			Result.Message = FString::Printf(
+				TEXT("Icon atlas entry struct %s has unexpected UVMin/UVMax/PixelSize types."),
+				*EntryStruct->GetPathName());
+			return Result;
+		}
+
+		const FString PagePrefix = Result.AssetName + TEXT("_Page");
+
+		TArray<FSoftObjectPath> SourcePaths;
+		for (const FString& TextureAssetPath : InTextureAssetPaths)
+		{
+			FString ResolvedTexturePath;
+			if (ResolveTextureAsset(TextureAssetPath, ResolvedTexturePath, ErrorMessage) == nullptr)
+			{
+				Result.SkippedTextures.Add(FString::Printf(TEXT("%s (%s)"), *TextureAssetPath, *ErrorMessage));
+				continue;
+			}
+
+			SourcePaths.Add(FSoftObjectPath(ResolvedTexturePath));
+		}
+
+		const FString PathPrefix = InPathPrefix.TrimStartAndEnd();
+		if (!PathPrefix.IsEmpty())
+		{
+			if (!bAssetIndexReady)
+			{
+				Result.Message = TEXT("The asset registry is still scanning; try again once the asset index is ready.");
+				return Result;
+			}
+
+			// CollectIndexedAssetPaths resets its output, so the prefix matches are merged after the explicit textures.
+			TArray<FSoftObjectPath> PrefixPaths;
+			CollectIndexedAssetPaths(UTexture2D::StaticClass()->GetClassPathName(), PathPrefix, PrefixPaths);
+			SourcePaths.Reserve(SourcePaths.Num() + PrefixPaths.Num());
+			for (const FSoftObjectPath& PrefixPath : PrefixPaths)
+			{
+				SourcePaths.AddUnique(PrefixPath);
+			}
+		}
+
+		TArray<FOctoMCPAtlasIcon> Icons;
+		TSet<FName> SeenIconIds;
+		for (const FSoftObjectPath& SourcePath : SourcePaths)
+		{
+			const FName IconId(*SourcePath.GetAssetName());
+			if (SourcePath.GetAssetName().StartsWith(PagePrefix) || SeenIconIds.Contains(IconId))
+			{
+				continue;
+			}
+
+			UTexture2D* const SourceTexture = Cast<UTexture2D>(SourcePath.TryLoad());
+			if (SourceTexture == nullptr)
+			{
+				Result.SkippedTextures.Add(FString::Printf(TEXT("%s (could not be loaded)"), *SourcePath.ToString()));
+				continue;
+			}
+
+			FImage SourceImage;
+			if (!SourceTexture->Source.IsValid() || !SourceTexture->Source.GetMipImage(SourceImage, 0, 0, 0))
+			{
+				Result.SkippedTextures.Add(FString::Printf(TEXT("%s (no editable source data)"), *SourcePath.ToString()));
+				continue;
+			}
+
+			if (SourceImage.SizeX + Result.Padding * 2 > Result.PageSize
+				|| SourceImage.SizeY + Result.Padding * 2 > Result.PageSize)
+			{
+				Result.SkippedTextures.Add(FString::Printf(
+					TEXT("%s (%dx%d does not fit a %d page)"),
+					*SourcePath.ToString(),
+					SourceImage.SizeX,
+					SourceImage.SizeY,
+					Result.PageSize));
+				continue;
+			}
+
+			FOctoMCPAtlasIcon& Icon = Icons.AddDefaulted_GetRef();
+			Icon.IconId = IconId;
+			Icon.SourcePath = SourcePath.ToString();
+			SourceImage.CopyTo(Icon.Pixels, ERawImageFormat::BGRA8, EGammaSpace::sRGB);
+			SeenIconIds.Add(IconId);
+		}
+
+		if (Icons.IsEmpty())
+		{
+			Result.Message = TEXT("No textures to pack; provide textureAssetPaths and/or a pathPrefix containing textures.");
+			return Result;
+		}
+
+		Result.PageCount = PackAtlasIcons(Icons, Result.PageSize, Result.Padding);
+		Result.IconCount = Icons.Num();
+
+		// Pages numbered past the new page count are left over from an earlier pack into more pages. Nothing
+		// references them once Pages is rewritten; they are deleted after an immediate save and reported otherwise.
+		TArray<FString> StalePagePackageNames;
+		{
+			const FString AtlasPagePrefix = FString::Printf(TEXT("%s/%s"), *Result.PackagePath, *PagePrefix);
+			TArray<FSoftObjectPath> ExistingPagePaths;
+			CollectIndexedAssetPaths(UTexture2D::StaticClass()->GetClassPathName(), AtlasPagePrefix, ExistingPagePaths);
+			for (const FSoftObjectPath& ExistingPagePath : ExistingPagePaths)
+			{
+				const FString PageName = ExistingPagePath.GetAssetName();
+				const int32 PageIndex = FCString::Atoi(*PageName.RightChop(PagePrefix.Len()));
+				if (PageIndex >= Result.PageCount
+					&& PageName == FString::Printf(TEXT("%s%d"), *PagePrefix, PageIndex)
+					&& ExistingPagePath.GetLongPackageName() == FString::Printf(TEXT("%s/%s"), *Result.PackagePath, *PageName))
+				{
+					StalePagePackageNames.Add(ExistingPagePath.GetLongPackageName());
+				}
+			}
+		}
+
+		TArray<TArray<FColor>> PagePixels;
+		PagePixels.SetNum(Result.PageCount);
+		for (TArray<FColor>& Pixels : PagePixels)
+		{
+			Pixels.Init(FColor(0, 0, 0, 0), Result.PageSize * Result.PageSize);
+		}
+
+		for (const FOctoMCPAtlasIcon& Icon : Icons)
+		{
+			BlitAtlasIcon(Icon, PagePixels[Icon.PageIndex], Result.PageSize, Result.Padding);
+		}
+
+		TArray<UObject*> ModifiedAssets;
+		TArray<UTexture2D*> PageTextures;
+		for (int32 PageIndex = 0; PageIndex < Result.PageCount; ++PageIndex)
+		{
+			const FString PageName = FString::Printf(TEXT("%s%d"), *PagePrefix, PageIndex);
+			const FString PagePackageName = FString::Printf(TEXT("%s/%s"), *Result.PackagePath, *PageName);
+			UPackage* const PagePackage = CreatePackage(*PagePackageName);
+			if (PagePackage == nullptr)
+			{
+				Result.Message = FString::Printf(TEXT("Failed to create atlas page package: %s"), *PagePackageName);
+				return Result;
+			}
+
+			PagePackage->FullyLoad();
+
+			UTexture2D* PageTexture = FindObject<UTexture2D>(PagePackage, *PageName);
+			const bool bCreatedPage = PageTexture == nullptr;
+			if (bCreatedPage)
+			{
+				PageTexture = NewObject<UTexture2D>(PagePackage, *PageName, RF_Public | RF_Standalone | RF_Transactional);
+			}
+
+			PageTexture->Modify();
+			PageTexture->PreEditChange(nullptr);
+			PageTexture->Source.Init(
+				Result.PageSize,
+				Result.PageSize,
+				1,
+				1,
+				TSF_BGRA8,
+				reinterpret_cast<const uint8*>(PagePixels[PageIndex].GetData()));
+			PageTexture->SRGB = true;
+			PageTexture->NeverStream = true;
+			PageTexture->LODGroup = TEXTUREGROUP_UI;
+			PageTexture->MipGenSettings = TMGS_NoMipmaps;
+			PageTexture->CompressionSettings = TC_EditorIcon;
+			PageTexture->PostEditChange();
+
+			if (bCreatedPage)
+			{
+				FAssetRegistryModule::AssetCreated(PageTexture);
+			}
+
+			PageTexture->MarkPackageDirty();
+			PageTextures.Add(PageTexture);
+			ModifiedAssets.Add(PageTexture);
+			Result.PageAssetPaths.Add(PagePackageName);
+		}
+
+		UPackage* const AtlasPackage = CreatePackage(*Result.AssetPath);
+		if (AtlasPackage == nullptr)
+		{
+			Result.Message = FString::Printf(TEXT("Failed to create icon atlas package: %s"), *Result.AssetPath);
+			return Result;
+		}
+
+		AtlasPackage->FullyLoad();
+
+		UObject* AtlasObject = StaticFindObject(UObject::StaticClass(), AtlasPackage, *Result.AssetName);
+		if (AtlasObject != nullptr && !AtlasObject->IsA(AtlasClass))
+		{
+			Result.Message = FString::Printf(
+				TEXT("Asset %s already exists and is not a %s."),
+				*Result.AssetObjectPath,
+				*AtlasClassPath);
+			return Result;
+		}
+
+		if (AtlasObject == nullptr)
+		{
+			AtlasObject = NewObject<UObject>(AtlasPackage, AtlasClass, *Result.AssetName, RF_Public | RF_Standalone | RF_Transactional);
+			Result.bCreated = true;
+		}
+
+		AtlasObject->Modify();
+		AtlasObject->PreEditChange(nullptr);
+
+		FScriptArrayHelper_InContainer PagesHelper(PagesProperty, AtlasObject);
+		PagesHelper.Resize(PageTextures.Num());
+		for (int32 PageIndex = 0; PageIndex < PageTextures.Num(); ++PageIndex)
+		{
+			PageElementProperty->SetObjectPropertyValue(PagesHelper.GetRawPtr(PageIndex), PageTextures[PageIndex]);
+		}
+
+		const FVector2D PageExtent(Result.PageSize, Result.PageSize);
+		FScriptArrayHelper_InContainer EntriesHelper(EntriesProperty, AtlasObject);
+		EntriesHelper.Resize(Icons.Num());
+		for (int32 IconIndex = 0; IconIndex < Icons.Num(); ++IconIndex)
+		{
+			const FOctoMCPAtlasIcon& Icon = Icons[IconIndex];
+			uint8* const EntryData = EntriesHelper.GetRawPtr(IconIndex);
+			IconIdProperty->SetPropertyValue_InContainer(EntryData, Icon.IconId);
+			PageIndexProperty->SetPropertyValue_InContainer(EntryData, Icon.PageIndex);
+			*UVMinProperty->ContainerPtrToValuePtr<FVector2D>(EntryData) = FVector2D(Icon.X, Icon.Y) / PageExtent;
+			*UVMaxProperty->ContainerPtrToValuePtr<FVector2D>(EntryData) =
+				FVector2D(Icon.X + Icon.Pixels.SizeX, Icon.Y + Icon.Pixels.SizeY) / PageExtent;
+			*PixelSizeProperty->ContainerPtrToValuePtr<FIntPoint>(EntryData) = FIntPoint(Icon.Pixels.SizeX, Icon.Pixels.SizeY);
+		}
+
+		AtlasObject->PostEditChange();
+
+		if (Result.bCreated)
+		{
+			FAssetRegistryModule::AssetCreated(AtlasObject);
+		}
+
+		AtlasObject->MarkPackageDirty();
+		ModifiedAssets.Add(AtlasObject);
+
+		const FString EntryWidgetAssetPath = InEntryWidgetAssetPath.TrimStartAndEnd();
+		if (!EntryWidgetAssetPath.IsEmpty())
+		{
+			FString EntryWidgetPackageName;
+			FString EntryWidgetPackagePath;
+			FString EntryWidgetAssetName;
+			FString EntryWidgetObjectPath;
+			if (!NormalizeWidgetBlueprintAssetPath(
+					EntryWidgetAssetPath,
+					EntryWidgetPackageName,
+					EntryWidgetPackagePath,
+					EntryWidgetAssetName,
+					EntryWidgetObjectPath,
+					ErrorMessage))
+			{
+				Result.Message = ErrorMessage;
+				return Result;
+			}
+
+			Result.EntryWidgetAssetPath = EntryWidgetPackageName;
+
+			UWidgetBlueprint* const EntryWidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *EntryWidgetObjectPath);
+			if (EntryWidgetBlueprint == nullptr)
+			{
+				Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *EntryWidgetObjectPath);
+				return Result;
+			}
+
+			FKismetEditorUtilities::CompileBlueprint(EntryWidgetBlueprint);
+			UObject* const EntryDefaultObject =
+				EntryWidgetBlueprint->GeneratedClass != nullptr ? EntryWidgetBlueprint->GeneratedClass->GetDefaultObject() : nullptr;
+			if (EntryDefaultObject == nullptr)
+			{
+				Result.Message = FString::Printf(
+					TEXT("Widget Blueprint asset does not have a generated class after compile: %s"),
+					*EntryWidgetObjectPath);
+				return Result;
+			}
+
+			EntryWidgetBlueprint->Modify();
+			EntryDefaultObject->SetFlags(RF_Transactional);
+			EntryDefaultObject->Modify();
+			if (!SetObjectPropertyValue(
+					EntryWidgetBlueprint->GeneratedClass,
+					EntryDefaultObject,
+					TEXT("IconAtlas"),
+					AtlasObject,
+					ErrorMessage))
+			{
+				Result.Message = ErrorMessage;
+				return Result;
+			}
+
+			EntryWidgetBlueprint->MarkPackageDirty();
+			FBlueprintEditorUtils::MarkBlueprintAsModified(EntryWidgetBlueprint);
+			FKismetEditorUtilities::CompileBlueprint(EntryWidgetBlueprint);
+			ModifiedAssets.Add(EntryWidgetBlueprint);
+		}
+
+		if (bSaveAsset)
+		{
+			if (bDeferSave)
+			{
+				for (UObject* const ModifiedAsset : ModifiedAssets)
+				{
+					QueueDeferredPackageSave(ModifiedAsset->GetOutermost()->GetName());
+				}
+			}
+			else
+			{
+				UEditorAssetSubsystem* const EditorAssetSubsystem =
+					GEditor != nullptr ? GEditor->GetEditorSubsystem<UEditorAssetSubsystem>() : nullptr;
+				if (EditorAssetSubsystem == nullptr)
+				{
+					Result.Message = FString::Printf(
+						TEXT("Packed icon atlas but could not access the EditorAssetSubsystem to save it: %s"),
+						*Result.AssetObjectPath);
+					return Result;
+				}
+
+				Result.bSaved = EditorAssetSubsystem->SaveLoadedAssets(ModifiedAssets, false);
+				if (!Result.bSaved)
+				{
+					Result.Message = FString::Printf(
+						TEXT("Packed icon atlas but failed to save it: %s"),
+						*Result.AssetObjectPath);
+					return Result;
+				}
+
+				// The saved atlas no longer points at the stale pages, so they can go without leaving a dangling reference.
+				for (const FString& StalePagePackageName : StalePagePackageNames)
+				{
+					if (EditorAssetSubsystem->DeleteAsset(StalePagePackageName))
+					{
+						Result.DeletedPageAssetPaths.Add(StalePagePackageName);
+					}
+					else
+					{
+						Result.StalePageAssetPaths.Add(StalePagePackageName);
+					}
+				}
+
+				StalePagePackageNames.Reset();
+			}
+		}
+
+		Result.StalePageAssetPaths.Append(StalePagePackageNames);
+
+		Result.bSuccess = true;
+		Result.Message = FString::Printf(
+			TEXT("Packed %d icon(s) into %d %dx%d page(s) for %s (%d skipped, %d stale page(s) deleted)%s%s."),
+			Result.IconCount,
+			Result.PageCount,
+			Result.PageSize,
+			Result.PageSize,
+			*Result.AssetObjectPath,
+			Result.SkippedTextures.Num(),
+			Result.DeletedPageAssetPaths.Num(),
+			bSaveAsset && bDeferSave ? TEXT("; saves queued") : TEXT(""),
+			Result.StalePageAssetPaths.IsEmpty()
+				? TEXT("")
+				: *FString::Printf(TEXT("; %d stale page(s) left in place"), Result.StalePageAssetPaths.Num()));
+		return Result;
+	}
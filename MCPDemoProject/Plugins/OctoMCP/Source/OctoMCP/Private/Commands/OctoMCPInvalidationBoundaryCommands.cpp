@@ -0,0 +1,335 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OctoMCPModule.h"
+
+namespace
+{
+	UClass* GetInvalidationBoundaryClass(const FString& Boundary)
+	{
+		if (Boundary == OctoMCP::InvalidationBoundaryInvalidation)
+		{
+			return UInvalidationBox::StaticClass();
+		}
+
+		if (Boundary == OctoMCP::InvalidationBoundaryRetainer)
+		{
+			return URetainerBox::StaticClass();
+		}
+
+		return nullptr;
+	}
+
+	// RenderOnInvalidation has no setter; without it a retainer redraws its render target every frame.
+	void ConfigureRetainerForStaticContent(URetainerBox* RetainerBox)
+	{
+		check(RetainerBox != nullptr);
+
+		if (FBoolProperty* const RenderOnInvalidationProperty =
+				FindFProperty<FBoolProperty>(URetainerBox::StaticClass(), TEXT("RenderOnInvalidation")))
+		{
+			RenderOnInvalidationProperty->SetPropertyValue_InContainer(RetainerBox, true);
+		}
+
+		if (FBoolProperty* const RenderOnPhaseProperty =
+				FindFProperty<FBoolProperty>(URetainerBox::StaticClass(), TEXT("RenderOnPhase")))
+		{
+			RenderOnPhaseProperty->SetPropertyValue_InContainer(RetainerBox, false);
+		}
+	}
+}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildSetWidgetInvalidationBoundaryObject(
+		const FString& AssetPath,
+		const FString& WidgetName,
+		const FString& Boundary,
+		const bool bSaveAsset) const
+	{
+		const FSetWidgetInvalidationBoundaryResult BoundaryResult =
+			SetWidgetInvalidationBoundary(AssetPath, WidgetName, Boundary, bSaveAsset);
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetBoolField(TEXT("changed"), BoundaryResult.bChanged);
+		ResultObject->SetBoolField(TEXT("saved"), BoundaryResult.bSaved);
+		ResultObject->SetBoolField(TEXT("success"), BoundaryResult.bSuccess);
+		ResultObject->SetStringField(TEXT("message"), BoundaryResult.Message);
+		ResultObject->SetStringField(TEXT("assetPath"), BoundaryResult.AssetPath);
+		ResultObject->SetStringField(TEXT("assetObjectPath"), BoundaryResult.AssetObjectPath);
+		ResultObject->SetStringField(TEXT("packagePath"), BoundaryResult.PackagePath);
+		ResultObject->SetStringField(TEXT("assetName"), BoundaryResult.AssetName);
+		ResultObject->SetStringField(TEXT("widgetName"), BoundaryResult.WidgetName);
+		ResultObject->SetStringField(TEXT("boundary"), BoundaryResult.Boundary);
+		ResultObject->SetStringField(TEXT("boundaryWidgetName"), BoundaryResult.BoundaryWidgetName);
+		return ResultObject;
+	}
+
+	FSetWidgetInvalidationBoundaryResult FOctoMCPModule::SetWidgetInvalidationBoundary(
+		const FString& InAssetPath,
+		const FString& InWidgetName,
+		const FString& InBoundary,
+		const bool bSaveAsset) const
+	{
+		FSetWidgetInvalidationBoundaryResult Result;
+
+		FString AssetPackageName;
+		FString AssetObjectPath;
+		FString ErrorMessage;
+		if (!NormalizeWidgetBlueprintAssetPath(
+				InAssetPath,
+				AssetPackageName,
+				Result.PackagePath,
+				Result.AssetName,
+				AssetObjectPath,
+				ErrorMessage))
+		{
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		Result.AssetPath = AssetPackageName;
+		Result.AssetObjectPath = AssetObjectPath;
+		Result.WidgetName = InWidgetName.TrimStartAndEnd();
+		Result.Boundary = InBoundary.TrimStartAndEnd().ToLower();
+
+		if (Result.WidgetName.IsEmpty())
+		{
+			Result.Message = TEXT("widgetName must not be empty.");
+			return Result;
+		}
+
+		if (!IsInvalidationBoundaryType(Result.Boundary))
+		{
+			Result.Message = FString::Printf(TEXT("Unsupported boundary: %s"), *InBoundary);
+			return Result;
+		}
+
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
+		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
+		{
+			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
+			return Result;
+		}
+
+		UWidget* const TargetWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(*Result.WidgetName));
+		if (TargetWidget == nullptr)
+		{
+			Result.Message = FString::Printf(
+				TEXT("Could not find widget named %s in %s."),
+				*Result.WidgetName,
+				*AssetObjectPath);
+			return Result;
+		}
+
+		WidgetBlueprint->SetFlags(RF_Transactional);
+		WidgetBlueprint->Modify();
+		WidgetBlueprint->WidgetTree->SetFlags(RF_Transactional);
+		WidgetBlueprint->WidgetTree->Modify();
+
+		if (!ApplyInvalidationBoundary(
+				WidgetBlueprint,
+				TargetWidget,
+				Result.Boundary,
+				Result.BoundaryWidgetName,
+				Result.bChanged,
+				ErrorMessage))
+		{
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		if (!Result.bChanged)
+		{
+			Result.bSuccess = true;
+			Result.Message = FString::Printf(
+				TEXT("Widget %s in %s already has boundary %s; nothing changed."),
+				*Result.WidgetName,
+				*AssetObjectPath,
+				*Result.Boundary);
+			return Result;
+		}
+
+		WidgetBlueprint->MarkPackageDirty();
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+		FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+
+		if (bSaveAsset)
+		{
+			UEditorAssetSubsystem* const EditorAssetSubsystem =
+				GEditor != nullptr ? GEditor->GetEditorSubsystem<UEditorAssetSubsystem>() : nullptr;
+			if (EditorAssetSubsystem == nullptr)
+			{
+				Result.Message = FString::Printf(
+					TEXT("Updated invalidation boundary but could not access the EditorAssetSubsystem to save it: %s"),
+					*AssetObjectPath);
+				return Result;
+			}
+
+			Result.bSaved = EditorAssetSubsystem->SaveLoadedAsset(WidgetBlueprint, false);
+			if (!Result.bSaved)
+			{
+				Result.Message = FString::Printf(
+					TEXT("Updated invalidation boundary but failed to save it: %s"),
+					*AssetObjectPath);
+				return Result;
+			}
+		}
+
+		Result.bSuccess = true;
+		Result.Message = Result.BoundaryWidgetName.IsEmpty()
+			? FString::Printf(TEXT("Removed the invalidation boundary around %s in %s."), *Result.WidgetName, *AssetObjectPath)
+			: FString::Printf(
+				TEXT("Wrapped %s in %s (%s) in %s."),
+				*Result.WidgetName,
+				*Result.BoundaryWidgetName,
+				*Result.Boundary,
+				*AssetObjectPath);
+		return Result;
+	}
+
+	bool FOctoMCPModule::IsInvalidationBoundaryType(const FString& Boundary) const
+	{
+		for (const TCHAR* const BoundaryType : OctoMCP::InvalidationBoundaryTypes)
+		{
+			if (Boundary == BoundaryType)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	UContentWidget* FOctoMCPModule::FindInvalidationBoundary(UWidget* Widget) const
+	{
+		UPanelWidget* const ParentWidget = Widget != nullptr ? Widget->GetParent() : nullptr;
+		if (ParentWidget != nullptr && (ParentWidget->IsA<UInvalidationBox>() || ParentWidget->IsA<URetainerBox>()))
+		{
+			return Cast<UContentWidget>(ParentWidget);
+		}
+
+		return nullptr;
+	}
+
+	bool FOctoMCPModule::ApplyInvalidationBoundary(
+		UWidgetBlueprint* WidgetBlueprint,
+		UWidget* Widget,
+		const FString& Boundary,
+		FString& OutBoundaryWidgetName,
+		bool& bOutChanged,
+		FString& OutError) const
+	{
+		check(WidgetBlueprint != nullptr);
+		check(WidgetBlueprint->WidgetTree != nullptr);
+		check(Widget != nullptr);
+
+		bOutChanged = false;
+		OutBoundaryWidgetName.Reset();
+
+		UWidgetTree* const WidgetTree = WidgetBlueprint->WidgetTree;
+		UClass* const BoundaryClass = GetInvalidationBoundaryClass(Boundary);
+
+		UContentWidget* const ExistingBoundary = FindInvalidationBoundary(Widget);
+		if (ExistingBoundary != nullptr && BoundaryClass != nullptr && ExistingBoundary->IsA(BoundaryClass))
+		{
+			OutBoundaryWidgetName = ExistingBoundary->GetName();
+			return true;
+		}
+
+		if (ExistingBoundary != nullptr)
+		{
+			// The widget takes over the boundary's slot so its layout in the outer panel is unchanged.
+			UPanelWidget* const BoundaryParent = ExistingBoundary->GetParent();
+			ExistingBoundary->SetContent(nullptr);
+			if (BoundaryParent != nullptr)
+			{
+				if (!BoundaryParent->ReplaceChild(ExistingBoundary, Widget))
+				{
+					ExistingBoundary->SetContent(Widget);
+					OutError = FString::Printf(
+						TEXT("Could not move %s out of boundary %s."),
+						*Widget->GetName(),
+						*ExistingBoundary->GetName());
+					return false;
+				}
+
+				ExistingBoundary->Slot = nullptr;
+			}
+			else
+			{
+				WidgetTree->RootWidget = Widget;
+			}
+
+			if (ExistingBoundary->bIsVariable)
+			{
+				WidgetBlueprint->OnVariableRemoved(ExistingBoundary->GetFName());
+			}
+
+			// Frees the name so a later wrap, or a rebuilt scaffold, can reuse it.
+			WidgetTree->RemoveWidget(ExistingBoundary);
+			ExistingBoundary->Rename(
+				nullptr,
+				GetTransientPackage(),
+				REN_DontCreateRedirectors | REN_ForceNoResetLoaders | REN_NonTransactional);
+			bOutChanged = true;
+		}
+
+		if (BoundaryClass == nullptr)
+		{
+			return true;
+		}
+
+		UPanelWidget* const ParentWidget = Widget->GetParent();
+		if (ParentWidget == nullptr && WidgetTree->RootWidget != Widget)
+		{
+			OutError = FString::Printf(TEXT("Widget %s is not attached to the widget tree."), *Widget->GetName());
+			return false;
+		}
+
+		const FName BaseBoundaryName(*FString::Printf(
+			TEXT("%s%s"),
+			*Widget->GetName(),
+			BoundaryClass == URetainerBox::StaticClass() ? TEXT("RetainerBox") : TEXT("InvalidationBox")));
+		const FName BoundaryName = StaticFindObjectFast(nullptr, WidgetTree, BaseBoundaryName) == nullptr
+			? BaseBoundaryName
+			: MakeUniqueObjectName(WidgetTree, BoundaryClass, BaseBoundaryName);
+
+		UContentWidget* const NewBoundary = WidgetTree->ConstructWidget<UContentWidget>(BoundaryClass, BoundaryName);
+		if (NewBoundary == nullptr)
+		{
+			OutError = FString::Printf(TEXT("Failed to create %s boundary around %s."), *Boundary, *Widget->GetName());
+			return false;
+		}
+
+		if (UInvalidationBox* const InvalidationBox = Cast<UInvalidationBox>(NewBoundary))
+		{
+			InvalidationBox->SetCanCache(true);
+		}
+		else if (URetainerBox* const RetainerBox = Cast<URetainerBox>(NewBoundary))
+		{
+			ConfigureRetainerForStaticContent(RetainerBox);
+		}
+
+		if (ParentWidget != nullptr)
+		{
+			if (!ParentWidget->ReplaceChild(Widget, NewBoundary))
+			{
+				WidgetTree->RemoveWidget(NewBoundary);
+				OutError = FString::Printf(
+					TEXT("Could not insert a %s boundary above %s."),
+					*Boundary,
+					*Widget->GetName());
+				return false;
+			}
+
+			// ReplaceChild leaves the old slot pointer behind; SetContent would otherwise detach the new boundary.
+			Widget->Slot = nullptr;
+		}
+		else
+		{
+			WidgetTree->RootWidget = NewBoundary;
+		}
+
+		NewBoundary->SetContent(Widget);
+		OutBoundaryWidgetName = NewBoundary->GetName();
+		bOutChanged = true;
+		return true;
+	}
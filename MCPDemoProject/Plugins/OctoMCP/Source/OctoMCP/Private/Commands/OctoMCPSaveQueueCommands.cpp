@@ -0,0 +1,243 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OctoMCPModule.h"
+
+namespace
+{
+	TArray<TSharedPtr<FJsonValue>> MakeJsonStringArray(const TArray<FString>& Values)
+	{
+		TArray<TSharedPtr<FJsonValue>> JsonValues;
+		JsonValues.Reserve(Values.Num());
+		for (const FString& Value : Values)
+		{
+			JsonValues.Add(MakeShared<FJsonValueString>(Value));
+		}
+
+		return JsonValues;
+	}
+}
+
+	void FOctoMCPModule::StartDeferredSaveQueue()
+	{
+		DeferredSaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FOctoMCPModule::TickDeferredSaveQueue),
+			OctoMCP::DeferredSaveTickIntervalSeconds);
+	}
+
+	void FOctoMCPModule::StopDeferredSaveQueue()
+	{
+		if (DeferredSaveTickerHandle.IsValid())
+		{
+			FTSTicker::RemoveTicker(DeferredSaveTickerHandle);
+			DeferredSaveTickerHandle.Reset();
+		}
+
+		if (!PendingSavePackageNames.IsEmpty())
+		{
+			UE_LOG(
+				LogOctoMCP,
+				Warning,
+				TEXT("OctoMCP is shutting down with %d deferred package save(s) still pending; they remain dirty in the editor."),
+				PendingSavePackageNames.Num());
+			PendingSavePackageNames.Reset();
+		}
+	}
+
+	bool FOctoMCPModule::TickDeferredSaveQueue(float DeltaTime)
+	{
+		if (PendingSavePackageNames.IsEmpty())
+		{
+			return true;
+		}
+
+		if (FPlatformTime::Seconds() - LastDeferredSaveQueuedTime < OctoMCP::DeferredSaveQuietPeriodSeconds)
+		{
+			return true;
+		}
+
+		if (UE::IsSavingPackage(nullptr) || IsGarbageCollecting())
+		{
+			return true;
+		}
+
+		FlushDeferredSaves();
+		return true;
+	}
+
+	void FOctoMCPModule::QueueDeferredSave(const TSharedPtr<FJsonObject>& CommandResultObject) const
+	{
+		if (!CommandResultObject.IsValid())
+		{
+			return;
+		}
+
+		bool bCommandSucceeded = false;
+		FString AssetPath;
+		if (!CommandResultObject->TryGetBoolField(TEXT("success"), bCommandSucceeded)
+			|| !bCommandSucceeded
+			|| !CommandResultObject->TryGetStringField(TEXT("assetPath"), AssetPath)
+			|| AssetPath.IsEmpty())
+		{
+			return;
+		}
+
+		if (!QueueDeferredPackageSave(AssetPath))
+		{
+			return;
+		}
+
+		FString Message;
+		CommandResultObject->TryGetStringField(TEXT("message"), Message);
+		CommandResultObject->SetBoolField(TEXT("saveQueued"), true);
+		CommandResultObject->SetStringField(TEXT("saveMode"), OctoMCP::SaveModeDeferred);
+		CommandResultObject->SetStringField(
+			TEXT("message"),
+			FString::Printf(TEXT("%s Save queued (%d package(s) pending)."), *Message, PendingSavePackageNames.Num()));
+	}
+
+	bool FOctoMCPModule::QueueDeferredPackageSave(const FString& PackageName) const
+	{
+		if (FindPackage(nullptr, *PackageName) == nullptr)
+		{
+			UE_LOG(LogOctoMCP, Warning, TEXT("Could not queue a deferred save for unloaded package %s."), *PackageName);
+			return false;
+		}
+
+		PendingSavePackageNames.Add(PackageName);
+		LastDeferredSaveQueuedTime = FPlatformTime::Seconds();
+		return true;
+	}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildFlushSavesObject() const
+	{
+		const FFlushSavesResult FlushResult = FlushDeferredSaves();
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetBoolField(TEXT("success"), FlushResult.bSuccess);
+		ResultObject->SetNumberField(TEXT("savedCount"), FlushResult.SavedCount);
+		ResultObject->SetNumberField(TEXT("failedCount"), FlushResult.FailedCount);
+		ResultObject->SetNumberField(TEXT("skippedCount"), FlushResult.SkippedCount);
+		ResultObject->SetStringField(TEXT("message"), FlushResult.Message);
+		ResultObject->SetArrayField(TEXT("savedPackages"), MakeJsonStringArray(FlushResult.SavedPackages));
+		ResultObject->SetArrayField(TEXT("failedPackages"), MakeJsonStringArray(FlushResult.FailedPackages));
+		ResultObject->SetArrayField(TEXT("skippedPackages"), MakeJsonStringArray(FlushResult.SkippedPackages));
+		return ResultObject;
+	}
+
+	FFlushSavesResult FOctoMCPModule::FlushDeferredSaves() const
+	{
+		FFlushSavesResult Result;
+
+		if (PendingSavePackageNames.IsEmpty())
+		{
+			Result.bSuccess = true;
+			Result.Message = TEXT("No deferred saves are pending.");
+			return Result;
+		}
+
+		TArray<UPackage*> PackagesToSave;
+		PackagesToSave.Reserve(PendingSavePackageNames.Num());
+		for (const FString& PackageName : PendingSavePackageNames)
+		{
+			UPackage* const Package = FindPackage(nullptr, *PackageName);
+			if (Package == nullptr)
+			{
+				Result.FailedPackages.Add(PackageName);
+			}
+			else if (!Package->IsDirty())
+			{
+				// Already saved since it was queued (by the editor or an immediate save); nothing to write.
+				Result.SkippedPackages.Add(PackageName);
+			}
+			else
+			{
+				PackagesToSave.Add(Package);
+			}
+		}
+
+		PendingSavePackageNames.Reset();
+
+		if (!PackagesToSave.IsEmpty())
+		{
+			TArray<UPackage*> FailedPackages;
+			FEditorFileUtils::PromptForCheckoutAndSave(PackagesToSave, true, false, &FailedPackages);
+
+			// A package the save left dirty was not written even if it is missing from FailedPackages.
+			for (UPackage* const Package : PackagesToSave)
+			{
+				if (FailedPackages.Contains(Package) || Package->IsDirty())
+				{
+					Result.FailedPackages.Add(Package->GetName());
+				}
+				else
+				{
+					Result.SavedPackages.Add(Package->GetName());
+				}
+			}
+		}
+
+		Result.SavedCount = Result.SavedPackages.Num();
+		Result.FailedCount = Result.FailedPackages.Num();
+		Result.SkippedCount = Result.SkippedPackages.Num();
+		Result.bSuccess = Result.FailedCount == 0;
+		Result.Message = Result.bSuccess
+			? FString::Printf(
+				TEXT("Saved %d deferred package(s); skipped %d that were no longer dirty."),
+				Result.SavedCount,
+				Result.SkippedCount)
+			: FString::Printf(
+				TEXT("Saved %d deferred package(s), skipped %d that were no longer dirty; %d failed: %s"),
+				Result.SavedCount,
+				Result.SkippedCount,
+				Result.FailedCount,
+				*FString::Join(Result.FailedPackages, TEXT(", ")));
+
+		LastDeferredSaveFlushTime = FPlatformTime::Seconds();
+		++DeferredSaveFlushCount;
+		bLastDeferredSaveFlushSucceeded = Result.bSuccess;
+		LastDeferredSaveFlushMessage = Result.Message;
+		LastDeferredSaveFailedPackages = Result.FailedPackages;
+
+		if (!Result.bSuccess)
+		{
+			UE_LOG(LogOctoMCP, Warning, TEXT("%s"), *Result.Message);
+		}
+
+		return Result;
+	}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildSaveQueueStatusObject() const
+	{
+		const FSaveQueueStatusResult StatusResult = GetSaveQueueStatus();
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetBoolField(TEXT("lastFlushSucceeded"), StatusResult.bLastFlushSucceeded);
+		ResultObject->SetNumberField(TEXT("pendingCount"), StatusResult.PendingCount);
+		ResultObject->SetNumberField(TEXT("totalFlushCount"), StatusResult.TotalFlushCount);
+		ResultObject->SetNumberField(TEXT("secondsSinceLastQueued"), StatusResult.SecondsSinceLastQueued);
+		ResultObject->SetNumberField(TEXT("secondsSinceLastFlush"), StatusResult.SecondsSinceLastFlush);
+		ResultObject->SetNumberField(TEXT("quietPeriodSeconds"), OctoMCP::DeferredSaveQuietPeriodSeconds);
+		ResultObject->SetStringField(TEXT("lastFlushMessage"), StatusResult.LastFlushMessage);
+		ResultObject->SetArrayField(TEXT("pendingPackages"), MakeJsonStringArray(StatusResult.PendingPackages));
+		ResultObject->SetArrayField(
+			TEXT("lastFlushFailedPackages"),
+			MakeJsonStringArray(StatusResult.LastFlushFailedPackages));
+		return ResultObject;
+	}
+
+	FSaveQueueStatusResult FOctoMCPModule::GetSaveQueueStatus() const
+	{
+		FSaveQueueStatusResult Result;
+
+		const double Now = FPlatformTime::Seconds();
+		Result.PendingCount = PendingSavePackageNames.Num();
+		Result.PendingPackages = PendingSavePackageNames.Array();
+		Result.PendingPackages.Sort();
+		Result.SecondsSinceLastQueued = Result.PendingCount > 0 ? Now - LastDeferredSaveQueuedTime : 0.0;
+		Result.TotalFlushCount = DeferredSaveFlushCount;
+		Result.SecondsSinceLastFlush = DeferredSaveFlushCount > 0 ? Now - LastDeferredSaveFlushTime : -1.0;
+		Result.bLastFlushSucceeded = bLastDeferredSaveFlushSucceeded;
+		Result.LastFlushMessage = LastDeferredSaveFlushMessage;
+		Result.LastFlushFailedPackages = LastDeferredSaveFailedPackages;
+		return Result;
+	}
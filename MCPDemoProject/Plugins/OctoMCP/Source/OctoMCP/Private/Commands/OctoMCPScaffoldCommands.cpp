@@ -2,29 +2,138 @@
 
 #include "OctoMCPModule.h"
 
+namespace
+{
+	// Parent class each scaffold template is built on; a clone keeps it unless parentClassPath names another.
+	const TCHAR* GetScaffoldTemplateParentClassPath(const FString& ScaffoldType)
+	{
+		if (ScaffoldType == TEXT("popup"))
+		{
+			return TEXT("UMCPPopupWidget");
+		}
+
+		if (ScaffoldType == TEXT("bottom_button_bar"))
+		{
+			return TEXT("UMCPBottomButtonBarWidget");
+		}
+
+		if (ScaffoldType == TEXT("virtualized_uniform_grid_host"))
+		{
+			return TEXT("UMCPVirtualizedUniformGridWidget");
+		}
+
+		if (ScaffoldType == TEXT("item_tile_popup"))
+		{
+			return TEXT("UMCPItemTilePopupWidget");
+		}
+
+		// A tile view only accepts entry classes that implement IUserObjectListEntry; the item tile entry is the
+		// project's native one, and its bindings are optional so the generic entry tree fits it as well.
+		if (ScaffoldType == TEXT("item_tile_entry") || ScaffoldType == TEXT("tile_view_entry"))
+		{
+			return TEXT("UMCPItemTileEntryWidget");
+		}
+
+		// The plain hosts only lay out panels the caller fills; they need no native behavior.
+		return TEXT("/Script/UMG.UserWidget");
+	}
+
+	bool IsListEntryScaffoldType(const FString& ScaffoldType)
+	{
+		return ScaffoldType == TEXT("tile_view_entry") || ScaffoldType == TEXT("item_tile_entry");
+	}
+
+	// Static chrome worth caching per scaffold. List entries and virtualized views are left alone: they are
+	// recycled or scrolled every frame, so a boundary there would only add invalidation work.
+	TArray<const TCHAR*> GetScaffoldBoundaryTargetWidgetNames(const FString& ScaffoldType)
+	{
+		if (ScaffoldType == TEXT("popup"))
+		{
+			return {TEXT("PopupContent")};
+		}
+
+		if (ScaffoldType == TEXT("bottom_button_bar"))
+		{
+			return {TEXT("BarFrame")};
+		}
+
+		if (ScaffoldType == TEXT("scroll_uniform_grid_host"))
+		{
+			return {TEXT("GridPanel")};
+		}
+
+		if (ScaffoldType == TEXT("item_tile_popup"))
+		{
+			return {TEXT("HeaderRow"), TEXT("ActionRow")};
+		}
+
+		return {};
+	}
+
+	void CollectScaffoldBoundaryWidgetNames(
+		UWidgetBlueprint* WidgetBlueprint,
+		const FString& ScaffoldType,
+		TArray<FString>& OutBoundaryWidgetNames)
+	{
+		for (const TCHAR* const TargetWidgetName : GetScaffoldBoundaryTargetWidgetNames(ScaffoldType))
+		{
+			UWidget* const TargetWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(TargetWidgetName));
+			UPanelWidget* const ParentWidget = TargetWidget != nullptr ? TargetWidget->GetParent() : nullptr;
+			if (ParentWidget != nullptr && (ParentWidget->IsA<UInvalidationBox>() || ParentWidget->IsA<URetainerBox>()))
+			{
+				OutBoundaryWidgetNames.Add(ParentWidget->GetName());
+			}
+		}
+	}
+}
+
 	TSharedRef<FJsonObject> FOctoMCPModule::BuildScaffoldWidgetBlueprintObject(
 		const FString& AssetPath,
 		const FString& ScaffoldType,
+		const bool bUseTemplate,
+		const FString& ParentClassPath,
+		const FString& InvalidationBoundary,
 		const bool bSaveAsset) const
 	{
-		const FScaffoldWidgetBlueprintResult ScaffoldResult =
-			ScaffoldWidgetBlueprintAsset(AssetPath, ScaffoldType, bSaveAsset);
+		const FScaffoldWidgetBlueprintResult ScaffoldResult = ScaffoldWidgetBlueprintAsset(
+			AssetPath,
+			ScaffoldType,
+			bUseTemplate,
+			ParentClassPath,
+			InvalidationBoundary,
+			bSaveAsset);
+
+		TArray<TSharedPtr<FJsonValue>> BoundaryWidgetNameValues;
+		for (const FString& BoundaryWidgetName : ScaffoldResult.BoundaryWidgetNames)
+		{
+			BoundaryWidgetNameValues.Add(MakeShared<FJsonValueString>(BoundaryWidgetName));
+		}
 
 		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
 		ResultObject->SetBoolField(TEXT("saved"), ScaffoldResult.bSaved);
 		ResultObject->SetBoolField(TEXT("success"), ScaffoldResult.bSuccess);
+		ResultObject->SetBoolField(TEXT("fromTemplate"), ScaffoldResult.bFromTemplate);
+		ResultObject->SetBoolField(TEXT("templateCreated"), ScaffoldResult.bTemplateCreated);
+		ResultObject->SetBoolField(TEXT("parentRetargeted"), ScaffoldResult.bParentRetargeted);
 		ResultObject->SetStringField(TEXT("message"), ScaffoldResult.Message);
 		ResultObject->SetStringField(TEXT("assetPath"), ScaffoldResult.AssetPath);
 		ResultObject->SetStringField(TEXT("assetObjectPath"), ScaffoldResult.AssetObjectPath);
 		ResultObject->SetStringField(TEXT("packagePath"), ScaffoldResult.PackagePath);
 		ResultObject->SetStringField(TEXT("assetName"), ScaffoldResult.AssetName);
 		ResultObject->SetStringField(TEXT("scaffoldType"), ScaffoldResult.ScaffoldType);
+		ResultObject->SetStringField(TEXT("templateAssetPath"), ScaffoldResult.TemplateAssetPath);
+		ResultObject->SetStringField(TEXT("parentClassPath"), ScaffoldResult.ParentClassPath);
+		ResultObject->SetStringField(TEXT("invalidationBoundary"), ScaffoldResult.InvalidationBoundary);
+		ResultObject->SetArrayField(TEXT("boundaryWidgetNames"), BoundaryWidgetNameValues);
 		return ResultObject;
 	}
 
 	FScaffoldWidgetBlueprintResult FOctoMCPModule::ScaffoldWidgetBlueprintAsset(
 		const FString& InAssetPath,
 		const FString& InScaffoldType,
+		const bool bUseTemplate,
+		const FString& InParentClassPath,
+		const FString& InInvalidationBoundary,
 		const bool bSaveAsset) const
 	{
 		FScaffoldWidgetBlueprintResult Result;
@@ -48,60 +157,63 @@
 		Result.AssetObjectPath = AssetObjectPath;
 		Result.ScaffoldType = InScaffoldType.TrimStartAndEnd().ToLower();
 
-		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
-		if (WidgetBlueprint == nullptr)
+		if (!IsScaffoldType(Result.ScaffoldType))
 		{
-			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
+			Result.Message = FString::Printf(TEXT("Unsupported scaffoldType: %s"), *InScaffoldType);
 			return Result;
 		}
 
-		if (WidgetBlueprint->WidgetTree == nullptr)
+		// Generated UI caches its static chrome unless the caller opts out.
+		Result.InvalidationBoundary = InInvalidationBoundary.TrimStartAndEnd().ToLower();
+		if (Result.InvalidationBoundary.IsEmpty())
 		{
-			Result.Message = FString::Printf(TEXT("Widget Blueprint is missing a widget tree: %s"), *AssetObjectPath);
-			return Result;
+			Result.InvalidationBoundary = OctoMCP::InvalidationBoundaryInvalidation;
 		}
 
-		WidgetBlueprint->SetFlags(RF_Transactional);
-		WidgetBlueprint->Modify();
-		WidgetBlueprint->WidgetTree->SetFlags(RF_Transactional);
-		WidgetBlueprint->WidgetTree->Modify();
-
-		bool bBuiltScaffold = false;
-		if (Result.ScaffoldType == TEXT("popup"))
-		{
-			bBuiltScaffold = BuildPopupWidgetScaffold(WidgetBlueprint);
-		}
-		else if (Result.ScaffoldType == TEXT("bottom_button_bar"))
-		{
-			bBuiltScaffold = BuildBottomButtonBarWidgetScaffold(WidgetBlueprint);
-		}
-		else if (Result.ScaffoldType == TEXT("scroll_uniform_grid_host"))
-		{
-			bBuiltScaffold = BuildScrollUniformGridHostWidgetScaffold(WidgetBlueprint);
-		}
-		else if (Result.ScaffoldType == TEXT("tile_view_host"))
+		if (!IsInvalidationBoundaryType(Result.InvalidationBoundary))
 		{
-			bBuiltScaffold = BuildTileViewHostWidgetScaffold(WidgetBlueprint);
+			Result.Message = FString::Printf(TEXT("Unsupported invalidationBoundary: %s"), *InInvalidationBoundary);
+			return Result;
 		}
-		else if (Result.ScaffoldType == TEXT("tile_view_entry"))
+
+		// A missing target is created as a copy of the scaffold's template package instead of being built.
+		FAssetData ExistingAssetData;
+		const bool bAssetExists =
+			FindIndexedAsset(AssetObjectPath, ExistingAssetData) || FindObject<UObject>(nullptr, *AssetObjectPath) != nullptr;
+		if (bUseTemplate && !bAssetExists)
 		{
-			bBuiltScaffold = BuildTileViewEntryWidgetScaffold(WidgetBlueprint);
+			CloneScaffoldTemplate(InParentClassPath, bSaveAsset, Result);
+			return Result;
 		}
-		else if (Result.ScaffoldType == TEXT("item_tile_popup"))
+
+		if (!InParentClassPath.IsEmpty())
 		{
-			bBuiltScaffold = BuildItemTilePopupWidgetScaffold(WidgetBlueprint);
+			Result.Message = FString::Printf(
+				TEXT("parentClassPath only applies when useTemplate creates a new asset; %s already exists."),
+				*AssetObjectPath);
+			return Result;
 		}
-		else if (Result.ScaffoldType == TEXT("item_tile_entry"))
+
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
+		if (WidgetBlueprint == nullptr)
 		{
-			bBuiltScaffold = BuildItemTileEntryWidgetScaffold(WidgetBlueprint);
+			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
+			return Result;
 		}
-		else
+
+		if (WidgetBlueprint->WidgetTree == nullptr)
 		{
-			Result.Message = FString::Printf(TEXT("Unsupported scaffoldType: %s"), *InScaffoldType);
+			Result.Message = FString::Printf(TEXT("Widget Blueprint is missing a widget tree: %s"), *AssetObjectPath);
 			return Result;
 		}
 
-		if (!bBuiltScaffold || WidgetBlueprint->WidgetTree->RootWidget == nullptr)
+		WidgetBlueprint->SetFlags(RF_Transactional);
+		WidgetBlueprint->Modify();
+		WidgetBlueprint->WidgetTree->SetFlags(RF_Transactional);
+		WidgetBlueprint->WidgetTree->Modify();
+
+		if (!BuildWidgetScaffold(WidgetBlueprint, Result.ScaffoldType, Result.InvalidationBoundary)
+			|| WidgetBlueprint->WidgetTree->RootWidget == nullptr)
 		{
 			Result.Message = FString::Printf(
 				TEXT("Failed to build scaffold %s for Widget Blueprint %s."),
@@ -136,11 +248,356 @@
 			}
 		}
 
+		Result.ParentClassPath = WidgetBlueprint->ParentClass != nullptr ? WidgetBlueprint->ParentClass->GetPathName() : FString();
+		CollectScaffoldBoundaryWidgetNames(WidgetBlueprint, Result.ScaffoldType, Result.BoundaryWidgetNames);
 		Result.bSuccess = true;
 		Result.Message = FString::Printf(
 			TEXT("Scaffolded Widget Blueprint %s using scaffold type %s."),
 			*AssetObjectPath,
 			*Result.ScaffoldType);
+		if (bUseTemplate)
+		{
+			Result.Message += TEXT(" The asset already existed, so the scaffold was built in place.");
+		}
+
+		return Result;
+	}
+
+	bool FOctoMCPModule::BuildWidgetScaffold(
+		UWidgetBlueprint* WidgetBlueprint,
+		const FString& ScaffoldType,
+		const FString& InvalidationBoundary) const
+	{
+		const TArray<const TCHAR*> BoundaryTargetWidgetNames = GetScaffoldBoundaryTargetWidgetNames(ScaffoldType);
+		FString BoundaryWidgetName;
+		FString ErrorMessage;
+		bool bBoundaryChanged = false;
+
+		// Builders re-parent widgets by name, which would orphan a boundary left by an earlier scaffold run.
+		for (const TCHAR* const TargetWidgetName : BoundaryTargetWidgetNames)
+		{
+			UWidget* const TargetWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(TargetWidgetName));
+			if (TargetWidget != nullptr
+				&& !ApplyInvalidationBoundary(
+					WidgetBlueprint,
+					TargetWidget,
+					OctoMCP::InvalidationBoundaryNone,
+					BoundaryWidgetName,
+					bBoundaryChanged,
+					ErrorMessage))
+			{
+				UE_LOG(LogOctoMCP, Warning, TEXT("OctoMCP scaffold %s: %s"), *ScaffoldType, *ErrorMessage);
+				return false;
+			}
+		}
+
+		bool bBuilt = false;
+		if (ScaffoldType == TEXT("popup"))
+		{
+			bBuilt = BuildPopupWidgetScaffold(WidgetBlueprint);
+		}
+		else if (ScaffoldType == TEXT("bottom_button_bar"))
+		{
+			bBuilt = BuildBottomButtonBarWidgetScaffold(WidgetBlueprint);
+		}
+		else if (ScaffoldType == TEXT("scroll_uniform_grid_host") || ScaffoldType == TEXT("virtualized_uniform_grid_host"))
+		{
+			// Same GridScrollBox/GridPanel tree; the virtualized host's parent class fills the grid at runtime.
+			bBuilt = BuildScrollUniformGridHostWidgetScaffold(WidgetBlueprint);
+		}
+		else if (ScaffoldType == TEXT("tile_view_host"))
+		{
+			bBuilt = BuildTileViewHostWidgetScaffold(WidgetBlueprint);
+		}
+		else if (ScaffoldType == TEXT("tile_view_entry"))
+		{
+			bBuilt = BuildTileViewEntryWidgetScaffold(WidgetBlueprint);
+		}
+		else if (ScaffoldType == TEXT("item_tile_popup"))
+		{
+			bBuilt = BuildItemTilePopupWidgetScaffold(WidgetBlueprint);
+		}
+		else if (ScaffoldType == TEXT("item_tile_entry"))
+		{
+			bBuilt = BuildItemTileEntryWidgetScaffold(WidgetBlueprint);
+		}
+
+		if (!bBuilt)
+		{
+			return false;
+		}
+
+		for (const TCHAR* const TargetWidgetName : BoundaryTargetWidgetNames)
+		{
+			UWidget* const TargetWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(TargetWidgetName));
+			if (TargetWidget != nullptr
+				&& !ApplyInvalidationBoundary(
+					WidgetBlueprint,
+					TargetWidget,
+					InvalidationBoundary,
+					BoundaryWidgetName,
+					bBoundaryChanged,
+					ErrorMessage))
+			{
+				UE_LOG(LogOctoMCP, Warning, TEXT("OctoMCP scaffold %s: %s"), *ScaffoldType, *ErrorMessage);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool FOctoMCPModule::IsScaffoldType(const FString& ScaffoldType) const
+	{
+		for (const TCHAR* const SupportedScaffoldType : OctoMCP::ScaffoldTypes)
+		{
+			if (ScaffoldType == SupportedScaffoldType)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	FString FOctoMCPModule::GetScaffoldTemplateAssetPath(const FString& ScaffoldType, const FString& InvalidationBoundary) const
+	{
+		// The version suffix retires every template at once when the scaffold builders change.
+		return FString::Printf(
+			TEXT("%s/WBP_ScaffoldTemplate_%s_%s_v%d"),
+			OctoMCP::ScaffoldTemplateDirectoryPath,
+			*ScaffoldType,
+			*InvalidationBoundary,
+			OctoMCP::ScaffoldTemplateVersion);
+	}
+
+	UWidgetBlueprint* FOctoMCPModule::FindOrCreateScaffoldTemplate(
+		const FString& ScaffoldType,
+		const FString& InvalidationBoundary,
+		bool& bOutCreated,
+		FString& OutError) const
+	{
+		bOutCreated = false;
+
+		const FString TemplatePackageName = GetScaffoldTemplateAssetPath(ScaffoldType, InvalidationBoundary);
+		const FString TemplateObjectPath =
+			FString::Printf(TEXT("%s.%s"), *TemplatePackageName, *FPackageName::GetLongPackageAssetName(TemplatePackageName));
+
+		FAssetData TemplateAssetData;
+		if (FindIndexedAsset(TemplateObjectPath, TemplateAssetData))
+		{
+			UWidgetBlueprint* const TemplateBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *TemplateObjectPath);
+			if (TemplateBlueprint == nullptr)
+			{
+				OutError = FString::Printf(TEXT("Could not load scaffold template: %s"), *TemplateObjectPath);
+			}
+
+			return TemplateBlueprint;
+		}
+
+		// First use builds, compiles and saves the template once; every later request only copies it.
+		const FCreateWidgetBlueprintResult CreateResult =
+			CreateWidgetBlueprintAsset(TemplatePackageName, GetScaffoldTemplateParentClassPath(ScaffoldType), false);
+		if (!CreateResult.bSuccess)
+		{
+			OutError = CreateResult.Message;
+			return nullptr;
+		}
+
+		UWidgetBlueprint* const TemplateBlueprint = FindObject<UWidgetBlueprint>(nullptr, *CreateResult.AssetObjectPath);
+		if (TemplateBlueprint == nullptr
+			|| TemplateBlueprint->WidgetTree == nullptr
+			|| !BuildWidgetScaffold(TemplateBlueprint, ScaffoldType, InvalidationBoundary)
+			|| TemplateBlueprint->WidgetTree->RootWidget == nullptr)
+		{
+			OutError = FString::Printf(
+				TEXT("Failed to build scaffold %s for template %s."),
+				*ScaffoldType,
+				*CreateResult.AssetObjectPath);
+			return nullptr;
+		}
+
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(TemplateBlueprint);
+		FKismetEditorUtilities::CompileBlueprint(TemplateBlueprint);
+
+		UEditorAssetSubsystem* const EditorAssetSubsystem =
+			GEditor != nullptr ? GEditor->GetEditorSubsystem<UEditorAssetSubsystem>() : nullptr;
+		if (EditorAssetSubsystem == nullptr || !EditorAssetSubsystem->SaveLoadedAsset(TemplateBlueprint, false))
+		{
+			UE_LOG(LogOctoMCP, Warning, TEXT("OctoMCP could not save scaffold template %s; it is kept in memory only."), *CreateResult.AssetObjectPath);
+		}
+
+		bOutCreated = true;
+		return TemplateBlueprint;
+	}
+
+	void FOctoMCPModule::CloneScaffoldTemplate(
+		const FString& InParentClassPath,
+		const bool bSaveAsset,
+		FScaffoldWidgetBlueprintResult& Result) const
+	{
+		FString ErrorMessage;
+		UWidgetBlueprint* const TemplateBlueprint =
+			FindOrCreateScaffoldTemplate(
+				Result.ScaffoldType,
+				Result.InvalidationBoundary,
+				Result.bTemplateCreated,
+				ErrorMessage);
+		if (TemplateBlueprint == nullptr)
+		{
+			Result.Message = ErrorMessage;
+			return;
+		}
+
+		Result.TemplateAssetPath = TemplateBlueprint->GetPathName();
+
+		UClass* ParentClass = TemplateBlueprint->ParentClass.Get();
+		if (!InParentClassPath.IsEmpty())
+		{
+			ParentClass = ResolveWidgetParentClass(InParentClassPath, Result.ParentClassPath, ErrorMessage);
+			if (ParentClass == nullptr)
+			{
+				Result.Message = ErrorMessage;
+				return;
+			}
+
+			if (!ParentClass->IsChildOf(UUserWidget::StaticClass()) || !FKismetEditorUtilities::CanCreateBlueprintOfClass(ParentClass))
+			{
+				Result.Message = FString::Printf(
+					TEXT("Cannot create a Widget Blueprint from parent class: %s"),
+					*Result.ParentClassPath);
+				return;
+			}
+
+			if (IsListEntryScaffoldType(Result.ScaffoldType) && !ParentClass->ImplementsInterface(UUserObjectListEntry::StaticClass()))
+			{
+				Result.Message = FString::Printf(
+					TEXT("A %s copy needs a parent class that implements /Script/UMG.UserObjectListEntry: %s"),
+					*Result.ScaffoldType,
+					*Result.ParentClassPath);
+				return;
+			}
+		}
+
+		IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools")).Get();
+		UWidgetBlueprint* const WidgetBlueprint =
+			Cast<UWidgetBlueprint>(AssetTools.DuplicateAsset(Result.AssetName, Result.PackagePath, TemplateBlueprint));
+		if (WidgetBlueprint == nullptr)
+		{
+			Result.Message = FString::Printf(
+				TEXT("Failed to duplicate scaffold template %s to %s."),
+				*Result.TemplateAssetPath,
+				*Result.AssetObjectPath);
+			return;
+		}
+
+		Result.bFromTemplate = true;
+		Result.AssetObjectPath = WidgetBlueprint->GetPathName();
+
+		// Only a different parent needs a compile; a plain copy keeps the template's compiled tree.
+		if (ParentClass != TemplateBlueprint->ParentClass.Get())
+		{
+			WidgetBlueprint->ParentClass = ParentClass;
+			FBlueprintEditorUtils::RefreshAllNodes(WidgetBlueprint);
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+			FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+			Result.bParentRetargeted = true;
+		}
+
+		Result.ParentClassPath = ParentClass != nullptr ? ParentClass->GetPathName() : FString();
+		CollectScaffoldBoundaryWidgetNames(WidgetBlueprint, Result.ScaffoldType, Result.BoundaryWidgetNames);
+		WidgetBlueprint->MarkPackageDirty();
+
+		if (bSaveAsset)
+		{
+			UEditorAssetSubsystem* const EditorAssetSubsystem =
+				GEditor != nullptr ? GEditor->GetEditorSubsystem<UEditorAssetSubsystem>() : nullptr;
+			if (EditorAssetSubsystem == nullptr)
+			{
+				Result.Message = FString::Printf(
+					TEXT("Cloned scaffold template but could not access the EditorAssetSubsystem to save it: %s"),
+					*Result.AssetObjectPath);
+				return;
+			}
+
+			Result.bSaved = EditorAssetSubsystem->SaveLoadedAsset(WidgetBlueprint, false);
+			if (!Result.bSaved)
+			{
+				Result.Message = FString::Printf(
+					TEXT("Cloned scaffold template but failed to save it: %s"),
+					*Result.AssetObjectPath);
+				return;
+			}
+		}
+
+		Result.bSuccess = true;
+		Result.Message = FString::Printf(
+			TEXT("Created Widget Blueprint %s from %s scaffold template %s."),
+			*Result.AssetObjectPath,
+			*Result.ScaffoldType,
+			*Result.TemplateAssetPath);
+		if (Result.bParentRetargeted)
+		{
+			Result.Message += FString::Printf(TEXT(" Parent class retargeted to %s."), *Result.ParentClassPath);
+		}
+	}
+
+	FCreateWidgetBlueprintResult FOctoMCPModule::CreateWidgetBlueprintFromScaffoldTemplate(
+		const FString& InAssetPath,
+		const FString& InParentClassPath,
+		const FString& InScaffoldType,
+		const FString& InInvalidationBoundary,
+		const bool bSaveAsset) const
+	{
+		FCreateWidgetBlueprintResult Result;
+
+		FString AssetPackageName;
+		FString AssetObjectPath;
+		FString ErrorMessage;
+		if (!NormalizeWidgetBlueprintAssetPath(
+				InAssetPath,
+				AssetPackageName,
+				Result.PackagePath,
+				Result.AssetName,
+				AssetObjectPath,
+				ErrorMessage))
+		{
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		Result.AssetPath = AssetPackageName;
+		Result.AssetObjectPath = AssetObjectPath;
+
+		// Create never touches an existing asset; scaffold_widget_blueprint would rebuild it in place instead.
+		FAssetData ExistingAssetData;
+		if (FindIndexedAsset(AssetObjectPath, ExistingAssetData) || FindObject<UObject>(nullptr, *AssetObjectPath) != nullptr)
+		{
+			Result.Message = FString::Printf(TEXT("Asset already exists: %s"), *AssetObjectPath);
+			return Result;
+		}
+
+		const FScaffoldWidgetBlueprintResult ScaffoldResult = ScaffoldWidgetBlueprintAsset(
+			InAssetPath,
+			InScaffoldType,
+			true,
+			InParentClassPath,
+			InInvalidationBoundary,
+			bSaveAsset);
+
+		Result.bCreated = ScaffoldResult.bFromTemplate;
+		Result.bSaved = ScaffoldResult.bSaved;
+		Result.bSuccess = ScaffoldResult.bSuccess;
+		Result.Message = ScaffoldResult.Message;
+		Result.AssetObjectPath = ScaffoldResult.AssetObjectPath.IsEmpty() ? AssetObjectPath : ScaffoldResult.AssetObjectPath;
+		Result.ParentClassPath = ScaffoldResult.ParentClassPath.IsEmpty() ? InParentClassPath : ScaffoldResult.ParentClassPath;
+		Result.ParentClassName = ScaffoldResult.ParentClassPath.IsEmpty()
+			? FString()
+			: FPackageName::ObjectPathToObjectName(ScaffoldResult.ParentClassPath);
+		Result.bFromTemplate = ScaffoldResult.bFromTemplate;
+		Result.bTemplateCreated = ScaffoldResult.bTemplateCreated;
+		Result.ScaffoldType = ScaffoldResult.ScaffoldType;
+		Result.TemplateAssetPath = ScaffoldResult.TemplateAssetPath;
 		return Result;
 	}
 
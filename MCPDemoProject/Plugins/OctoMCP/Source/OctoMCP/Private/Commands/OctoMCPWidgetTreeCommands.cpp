@@ -0,0 +1,1183 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OctoMCPModule.h"
+
+namespace
+{
+	struct FOctoMCPWidgetSpecNode
+	{
+		FName Name;
+		UClass* WidgetClass = nullptr;
+		int32 ParentIndex = INDEX_NONE;
+		TArray<int32> ChildIndices;
+		TOptional<bool> bIsVariable;
+		TArray<TPair<FString, FString>> Properties;
+		TArray<TPair<FString, FString>> SlotProperties;
+		TArray<TUniquePtr<FOctoMCPParsedPropertyValue>> ParsedProperties;
+		TArray<TUniquePtr<FOctoMCPParsedPropertyValue>> ParsedSlotProperties;
+		UWidget* Widget = nullptr;
+		bool bCreated = false;
+	};
+
+	// Exports editable properties that differ from the class defaults, keyed by property name.
+	// The values are Unreal import text, so they can be fed straight back into apply_widget_tree.
+	TSharedRef<FJsonObject> ExportNonDefaultProperties(const UObject* Object)
+	{
+		TSharedRef<FJsonObject> ValuesObject = MakeShared<FJsonObject>();
+		const UObject* const DefaultObject = Object->GetClass()->GetDefaultObject();
+
+		for (TFieldIterator<FProperty> PropertyIt(Object->GetClass()); PropertyIt; ++PropertyIt)
+		{
+			const FProperty* const Property = *PropertyIt;
+			if (!Property->HasAnyPropertyFlags(CPF_Edit)
+				|| Property->HasAnyPropertyFlags(
+					CPF_Transient | CPF_Deprecated | CPF_InstancedReference | CPF_ContainsInstancedReference))
+			{
+				continue;
+			}
+
+			const void* const Value = Property->ContainerPtrToValuePtr<void>(Object);
+			const void* const DefaultValue = Property->ContainerPtrToValuePtr<void>(DefaultObject);
+			if (Property->Identical(Value, DefaultValue, PPF_None))
+			{
+				continue;
+			}
+
+			FString ValueText;
+			Property->ExportTextItem_Direct(ValueText, Value, DefaultValue, const_cast<UObject*>(Object), PPF_None);
+			ValuesObject->SetStringField(Property->GetName(), ValueText);
+		}
+
+		return ValuesObject;
+	}
+
+	bool ParseWidgetSpecValueMap(
+		const TSharedPtr<FJsonObject>& NodeObject,
+		const TCHAR* FieldName,
+		const FString& WidgetName,
+		TArray<TPair<FString, FString>>& OutValues,
+		FString& OutError)
+	{
+		if (!NodeObject->HasField(FieldName))
+		{
+			return true;
+		}
+
+		const TSharedPtr<FJsonObject>* ValuesObject = nullptr;
+		if (!NodeObject->TryGetObjectField(FieldName, ValuesObject) || ValuesObject == nullptr || !ValuesObject->IsValid())
+		{
+			OutError = FString::Printf(TEXT("%s.%s must be an object."), *WidgetName, FieldName);
+			return false;
+		}
+
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*ValuesObject)->Values)
+		{
+			FString ValueText;
+			if (!OctoMCP::JsonValueToImportText(Entry.Value, ValueText))
+			{
+				OutError = FString::Printf(
+					TEXT("%s.%s.%s must be a string (Unreal import text), number or boolean."),
+					*WidgetName,
+					FieldName,
+					*Entry.Key);
+				return false;
+			}
+
+			OutValues.Emplace(Entry.Key, ValueText);
+		}
+
+		return true;
+	}
+
+	bool ParseWidgetSpecNode(
+		const TSharedPtr<FJsonObject>& NodeObject,
+		const int32 ParentIndex,
+		TFunctionRef<UClass*(const FString&, FString&)> ResolveWidgetClass,
+		TArray<FOctoMCPWidgetSpecNode>& OutNodes,
+		TMap<FName, int32>& OutNodeIndexByName,
+		FString& OutError)
+	{
+		FString WidgetName;
+		if (!NodeObject->TryGetStringField(TEXT("name"), WidgetName) || WidgetName.TrimStartAndEnd().IsEmpty())
+		{
+			OutError = TEXT("Every widget in tree must have a non-empty name.");
+			return false;
+		}
+
+		WidgetName = WidgetName.TrimStartAndEnd();
+		const FName WidgetFName(*WidgetName);
+		if (OutNodeIndexByName.Contains(WidgetFName))
+		{
+			OutError = FString::Printf(TEXT("Widget name %s appears more than once in tree."), *WidgetName);
+			return false;
+		}
+
+		FString ClassReference;
+		if (!NodeObject->TryGetStringField(TEXT("class"), ClassReference) || ClassReference.TrimStartAndEnd().IsEmpty())
+		{
+			OutError = FString::Printf(TEXT("%s.class must be a non-empty string."), *WidgetName);
+			return false;
+		}
+
+		UClass* const WidgetClass = ResolveWidgetClass(ClassReference.TrimStartAndEnd(), OutError);
+		if (WidgetClass == nullptr)
+		{
+			return false;
+		}
+
+		const int32 NodeIndex = OutNodes.AddDefaulted();
+		OutNodeIndexByName.Add(WidgetFName, NodeIndex);
+		{
+			FOctoMCPWidgetSpecNode& Node = OutNodes[NodeIndex];
+			Node.Name = WidgetFName;
+			Node.WidgetClass = WidgetClass;
+			Node.ParentIndex = ParentIndex;
+
+			bool bIsVariable = false;
+			if (NodeObject->HasField(TEXT("isVariable")))
+			{
+				if (!NodeObject->TryGetBoolField(TEXT("isVariable"), bIsVariable))
+				{
+					OutError = FString::Printf(TEXT("%s.isVariable must be a boolean."), *WidgetName);
+					return false;
+				}
+
+				Node.bIsVariable = bIsVariable;
+			}
+
+			if (!ParseWidgetSpecValueMap(NodeObject, TEXT("properties"), WidgetName, Node.Properties, OutError)
+				|| !ParseWidgetSpecValueMap(NodeObject, TEXT("slot"), WidgetName, Node.SlotProperties, OutError))
+			{
+				return false;
+			}
+		}
+
+		if (!NodeObject->HasField(TEXT("children")))
+		{
+			return true;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* ChildValues = nullptr;
+		if (!NodeObject->TryGetArrayField(TEXT("children"), ChildValues) || ChildValues == nullptr)
+		{
+			OutError = FString::Printf(TEXT("%s.children must be an array."), *WidgetName);
+			return false;
+		}
+
+		if (!ChildValues->IsEmpty())
+		{
+			const UPanelWidget* const PanelDefaults = Cast<UPanelWidget>(WidgetClass->GetDefaultObject());
+			if (PanelDefaults == nullptr)
+			{
+				OutError = FString::Printf(
+					TEXT("%s is a %s, which cannot have children."),
+					*WidgetName,
+					*WidgetClass->GetName());
+				return false;
+			}
+
+			if (!PanelDefaults->CanHaveMultipleChildren() && ChildValues->Num() > 1)
+			{
+				OutError = FString::Printf(
+					TEXT("%s is a %s, which holds a single child; %d were given."),
+					*WidgetName,
+					*WidgetClass->GetName(),
+					ChildValues->Num());
+				return false;
+			}
+		}
+
+		for (const TSharedPtr<FJsonValue>& ChildValue : *ChildValues)
+		{
+			const TSharedPtr<FJsonObject>* ChildObject = nullptr;
+			if (!ChildValue.IsValid() || !ChildValue->TryGetObject(ChildObject) || ChildObject == nullptr || !ChildObject->IsValid())
+			{
+				OutError = FString::Printf(TEXT("%s.children entries must be objects."), *WidgetName);
+				return false;
+			}
+
+			const int32 ChildIndex = OutNodes.Num();
+			if (!ParseWidgetSpecNode(*ChildObject, NodeIndex, ResolveWidgetClass, OutNodes, OutNodeIndexByName, OutError))
+			{
+				return false;
+			}
+
+			OutNodes[NodeIndex].ChildIndices.Add(ChildIndex);
+		}
+
+		return true;
+	}
+}
+
+	bool OctoMCP::JsonValueToImportText(const TSharedPtr<FJsonValue>& Value, FString& OutText)
+	{
+		if (!Value.IsValid())
+		{
+			return false;
+		}
+
+		switch (Value->Type)
+		{
+		case EJson::String:
+			OutText = Value->AsString();
+			return true;
+		case EJson::Boolean:
+			OutText = Value->AsBool() ? TEXT("True") : TEXT("False");
+			return true;
+		case EJson::Number:
+		{
+			const double NumberValue = Value->AsNumber();
+			OutText = FMath::IsNearlyEqual(NumberValue, FMath::RoundToDouble(NumberValue))
+				? FString::Printf(TEXT("%lld"), static_cast<int64>(FMath::RoundToDouble(NumberValue)))
+				: FString::SanitizeFloat(NumberValue);
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildApplyWidgetTreeObject(
+		const FString& AssetPath,
+		const TSharedPtr<FJsonObject>& TreeObject,
+		const bool bSaveAsset) const
+	{
+		const FApplyWidgetTreeResult ApplyResult = ApplyWidgetTree(AssetPath, TreeObject, bSaveAsset);
+
+		TArray<TSharedPtr<FJsonValue>> ChangeValues;
+		for (const FString& Change : ApplyResult.Changes)
+		{
+			ChangeValues.Add(MakeShared<FJsonValueString>(Change));
+		}
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetBoolField(TEXT("changed"), ApplyResult.bChanged);
+		ResultObject->SetBoolField(TEXT("saved"), ApplyResult.bSaved);
+		ResultObject->SetBoolField(TEXT("success"), ApplyResult.bSuccess);
+		ResultObject->SetNumberField(TEXT("widgetCount"), ApplyResult.WidgetCount);
+		ResultObject->SetNumberField(TEXT("createdCount"), ApplyResult.CreatedCount);
+		ResultObject->SetNumberField(TEXT("replacedCount"), ApplyResult.ReplacedCount);
+		ResultObject->SetNumberField(TEXT("removedCount"), ApplyResult.RemovedCount);
+		ResultObject->SetNumberField(TEXT("movedCount"), ApplyResult.MovedCount);
+		ResultObject->SetNumberField(TEXT("propertyChangeCount"), ApplyResult.PropertyChangeCount);
+		ResultObject->SetStringField(TEXT("message"), ApplyResult.Message);
+		ResultObject->SetStringField(TEXT("assetPath"), ApplyResult.AssetPath);
+		ResultObject->SetStringField(TEXT("assetObjectPath"), ApplyResult.AssetObjectPath);
+		ResultObject->SetStringField(TEXT("packagePath"), ApplyResult.PackagePath);
+		ResultObject->SetStringField(TEXT("assetName"), ApplyResult.AssetName);
+		ResultObject->SetArrayField(TEXT("changes"), ChangeValues);
+		return ResultObject;
+	}
+
+	FApplyWidgetTreeResult FOctoMCPModule::ApplyWidgetTree(
+		const FString& InAssetPath,
+		const TSharedPtr<FJsonObject>& InTreeObject,
+		const bool bSaveAsset) const
+	{
+		FApplyWidgetTreeResult Result;
+
+		FString AssetPackageName;
+		FString AssetObjectPath;
+		FString ErrorMessage;
+		if (!NormalizeWidgetBlueprintAssetPath(
+				InAssetPath,
+				AssetPackageName,
+				Result.PackagePath,
+				Result.AssetName,
+				AssetObjectPath,
+				ErrorMessage))
+		{
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		Result.AssetPath = AssetPackageName;
+		Result.AssetObjectPath = AssetObjectPath;
+
+		if (!InTreeObject.IsValid())
+		{
+			Result.Message = TEXT("tree must be an object describing the root widget.");
+			return Result;
+		}
+
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
+		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
+		{
+			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
+			return Result;
+		}
+
+		UWidgetTree* const WidgetTree = WidgetBlueprint->WidgetTree;
+
+		TMap<FString, UClass*> ResolvedWidgetClasses;
+		auto ResolveWidgetClass = [this, WidgetBlueprint, &ResolvedWidgetClasses](const FString& ClassReference, FString& OutError) -> UClass*
+		{
+			if (UClass* const* const CachedClass = ResolvedWidgetClasses.Find(ClassReference))
+			{
+				return *CachedClass;
+			}
+
+			UClass* WidgetClass = nullptr;
+			if (!ClassReference.Contains(TEXT("/")) && !ClassReference.Contains(TEXT(".")))
+			{
+				FString NativeClassName = ClassReference;
+				if (NativeClassName.Len() > 1 && NativeClassName[0] == TEXT('U') && FChar::IsUpper(NativeClassName[1]))
+				{
+					NativeClassName.RightChopInline(1, EAllowShrinking::No);
+				}
+
+				WidgetClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/UMG.%s"), *NativeClassName));
+			}
+
+			if (WidgetClass == nullptr)
+			{
+				FString ResolvedClassPath;
+				WidgetClass = ResolveClassReference(ClassReference, UWidget::StaticClass(), ResolvedClassPath, OutError);
+				if (WidgetClass == nullptr)
+				{
+					return nullptr;
+				}
+			}
+
+			if (!WidgetClass->IsChildOf(UWidget::StaticClass())
+				|| WidgetClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+			{
+				OutError = FString::Printf(TEXT("%s is not a concrete widget class."), *WidgetClass->GetPathName());
+				return nullptr;
+			}
+
+			if (WidgetBlueprint->GeneratedClass != nullptr && WidgetClass->IsChildOf(WidgetBlueprint->GeneratedClass))
+			{
+				OutError = FString::Printf(
+					TEXT("%s cannot contain an instance of itself (%s)."),
+					*WidgetBlueprint->GetName(),
+					*WidgetClass->GetPathName());
+				return nullptr;
+			}
+
+			ResolvedWidgetClasses.Add(ClassReference, WidgetClass);
+			return WidgetClass;
+		};
+
+		TArray<FOctoMCPWidgetSpecNode> Nodes;
+		TMap<FName, int32> NodeIndexByName;
+		if (!ParseWidgetSpecNode(InTreeObject, INDEX_NONE, ResolveWidgetClass, Nodes, NodeIndexByName, ErrorMessage))
+		{
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		Result.WidgetCount = Nodes.Num();
+
+		// Validate every destructive step before touching the tree so a rejected spec leaves the asset untouched.
+		TArray<UWidget*> ExistingWidgets;
+		WidgetTree->GetAllWidgets(ExistingWidgets);
+
+		TSet<UWidget*> WidgetsToDelete;
+		TSet<UWidget*> ReusedWidgets;
+		for (UWidget* const ExistingWidget : ExistingWidgets)
+		{
+			if (ExistingWidget == nullptr)
+			{
+				continue;
+			}
+
+			const int32* const NodeIndex = NodeIndexByName.Find(ExistingWidget->GetFName());
+			const bool bReplaced = NodeIndex != nullptr && ExistingWidget->GetClass() != Nodes[*NodeIndex].WidgetClass;
+			if (NodeIndex != nullptr && !bReplaced)
+			{
+				Nodes[*NodeIndex].Widget = ExistingWidget;
+				ReusedWidgets.Add(ExistingWidget);
+				continue;
+			}
+
+			if (ExistingWidget->bIsVariable && FBlueprintEditorUtils::IsVariableUsed(WidgetBlueprint, ExistingWidget->GetFName()))
+			{
+				Result.Message = FString::Printf(
+					TEXT("Widget %s is referenced in the graph and cannot be %s automatically."),
+					*ExistingWidget->GetName(),
+					bReplaced ? TEXT("replaced") : TEXT("removed"));
+				return Result;
+			}
+
+			WidgetsToDelete.Add(ExistingWidget);
+			if (bReplaced)
+			{
+				++Result.ReplacedCount;
+				Result.Changes.Add(FString::Printf(
+					TEXT("replace %s (%s -> %s)"),
+					*ExistingWidget->GetName(),
+					*ExistingWidget->GetClass()->GetName(),
+					*Nodes[*NodeIndex].WidgetClass->GetName()));
+			}
+			else
+			{
+				++Result.RemovedCount;
+				Result.Changes.Add(FString::Printf(TEXT("remove %s"), *ExistingWidget->GetName()));
+			}
+		}
+
+		// Values are parsed against the widget and slot classes before the first delete or construct, so a bad
+		// path or value is rejected while the asset is still untouched.
+		for (FOctoMCPWidgetSpecNode& Node : Nodes)
+		{
+			UObject* const WidgetDefaults = Node.WidgetClass->GetDefaultObject();
+			for (const TPair<FString, FString>& Property : Node.Properties)
+			{
+				TUniquePtr<FOctoMCPParsedPropertyValue>& ParsedValue =
+					Node.ParsedProperties.Add_GetRef(MakeUnique<FOctoMCPParsedPropertyValue>());
+				if (!ParsePropertyValueText(Node.WidgetClass, WidgetDefaults, Property.Key, Property.Value, *ParsedValue, ErrorMessage))
+				{
+					Result.Message = FString::Printf(TEXT("%s: %s"), *Node.Name.ToString(), *ErrorMessage);
+					return Result;
+				}
+			}
+
+			if (Node.SlotProperties.IsEmpty())
+			{
+				continue;
+			}
+
+			const UPanelWidget* const ParentDefaults = Node.ParentIndex != INDEX_NONE
+				? Cast<UPanelWidget>(Nodes[Node.ParentIndex].WidgetClass->GetDefaultObject())
+				: nullptr;
+			UClass* const SlotClass = ParentDefaults != nullptr ? ParentDefaults->GetSlotClass() : nullptr;
+			if (SlotClass == nullptr)
+			{
+				Result.Message = FString::Printf(
+					TEXT("%s has slot properties but no parent panel slot."),
+					*Node.Name.ToString());
+				return Result;
+			}
+
+			for (const TPair<FString, FString>& SlotProperty : Node.SlotProperties)
+			{
+				TUniquePtr<FOctoMCPParsedPropertyValue>& ParsedValue =
+					Node.ParsedSlotProperties.Add_GetRef(MakeUnique<FOctoMCPParsedPropertyValue>());
+				if (!ParsePropertyValueText(
+						SlotClass,
+						SlotClass->GetDefaultObject(),
+						SlotProperty.Key,
+						SlotProperty.Value,
+						*ParsedValue,
+						ErrorMessage))
+				{
+					Result.Message = FString::Printf(TEXT("%s slot: %s"), *Node.Name.ToString(), *ErrorMessage);
+					return Result;
+				}
+			}
+		}
+
+		bool bStructureChanged = !WidgetsToDelete.IsEmpty();
+		bool bTreeModified = false;
+		auto EnsureTreeModified = [WidgetBlueprint, WidgetTree, &bTreeModified]()
+		{
+			if (!bTreeModified)
+			{
+				WidgetBlueprint->SetFlags(RF_Transactional);
+				WidgetBlueprint->Modify();
+				WidgetTree->SetFlags(RF_Transactional);
+				WidgetTree->Modify();
+				bTreeModified = true;
+			}
+		};
+
+		// Everything the spec can get wrong was rejected above. Only an engine-side failure reaches this once the
+		// tree is touched, and the blueprint is still recompiled so it is never left dirty with a stale class.
+		auto FailAfterTreeModified = [WidgetBlueprint, &Result](const FString& Message)
+		{
+			WidgetBlueprint->MarkPackageDirty();
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+			FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+			Result.bChanged = true;
+			Result.Message = Message;
+			return Result;
+		};
+
+		if (!WidgetsToDelete.IsEmpty())
+		{
+			EnsureTreeModified();
+
+			// Kept widgets parented under a doomed widget are detached first so they survive the delete.
+			for (UWidget* const ReusedWidget : ReusedWidgets)
+			{
+				UPanelWidget* const ParentWidget = ReusedWidget->GetParent();
+				if (ParentWidget != nullptr && WidgetsToDelete.Contains(ParentWidget))
+				{
+					ReusedWidget->RemoveFromParent();
+				}
+			}
+
+			FWidgetBlueprintEditorUtils::DeleteWidgets(
+				WidgetBlueprint,
+				WidgetsToDelete,
+				FWidgetBlueprintEditorUtils::EDeleteWidgetWarningType::DeleteSilently);
+		}
+
+		for (FOctoMCPWidgetSpecNode& Node : Nodes)
+		{
+			if (Node.Widget != nullptr)
+			{
+				continue;
+			}
+
+			EnsureTreeModified();
+			Node.Widget = WidgetTree->ConstructWidget<UWidget>(Node.WidgetClass, Node.Name);
+			if (Node.Widget == nullptr)
+			{
+				return FailAfterTreeModified(FString::Printf(
+					TEXT("Failed to create widget %s of class %s."),
+					*Node.Name.ToString(),
+					*Node.WidgetClass->GetPathName()));
+			}
+
+			Node.bCreated = true;
+			bStructureChanged = true;
+			++Result.CreatedCount;
+			Result.Changes.Add(FString::Printf(TEXT("create %s (%s)"), *Node.Name.ToString(), *Node.WidgetClass->GetName()));
+		}
+
+		UWidget* const RootWidget = Nodes[0].Widget;
+		if (WidgetTree->RootWidget != RootWidget)
+		{
+			EnsureTreeModified();
+			if (RootWidget->GetParent() != nullptr)
+			{
+				RootWidget->RemoveFromParent();
+			}
+
+			WidgetTree->RootWidget = RootWidget;
+			bStructureChanged = true;
+			Result.Changes.Add(FString::Printf(TEXT("set root %s"), *RootWidget->GetName()));
+		}
+
+		// Nodes are stored in pre-order, so every parent is already in place when its children are arranged.
+		for (const FOctoMCPWidgetSpecNode& Node : Nodes)
+		{
+			UPanelWidget* const PanelWidget = Cast<UPanelWidget>(Node.Widget);
+			if (PanelWidget == nullptr || Node.ChildIndices.IsEmpty())
+			{
+				continue;
+			}
+
+			for (int32 DesiredIndex = 0; DesiredIndex < Node.ChildIndices.Num(); ++DesiredIndex)
+			{
+				const FOctoMCPWidgetSpecNode& ChildNode = Nodes[Node.ChildIndices[DesiredIndex]];
+				UWidget* const ChildWidget = ChildNode.Widget;
+				if (ChildWidget->GetParent() == PanelWidget && PanelWidget->GetChildIndex(ChildWidget) == DesiredIndex)
+				{
+					continue;
+				}
+
+				EnsureTreeModified();
+
+				// A single-child panel may still hold a widget that the spec places elsewhere later on.
+				if (!PanelWidget->CanHaveMultipleChildren() && PanelWidget->GetChildrenCount() > 0)
+				{
+					PanelWidget->RemoveChildAt(0);
+				}
+
+				if (EnsurePanelChildAt(PanelWidget, ChildWidget, DesiredIndex) == nullptr)
+				{
+					return FailAfterTreeModified(FString::Printf(
+						TEXT("Failed to place %s under %s at index %d."),
+						*ChildWidget->GetName(),
+						*PanelWidget->GetName(),
+						DesiredIndex));
+				}
+
+				bStructureChanged = true;
+				if (!ChildNode.bCreated)
+				{
+					++Result.MovedCount;
+					Result.Changes.Add(FString::Printf(
+						TEXT("move %s to %s[%d]"),
+						*ChildWidget->GetName(),
+						*PanelWidget->GetName(),
+						DesiredIndex));
+				}
+			}
+		}
+
+		for (const FOctoMCPWidgetSpecNode& Node : Nodes)
+		{
+			UWidget* const Widget = Node.Widget;
+
+			if (Node.bIsVariable.IsSet() && Widget->bIsVariable != Node.bIsVariable.GetValue())
+			{
+				EnsureTreeModified();
+				Widget->SetFlags(RF_Transactional);
+				Widget->Modify();
+				if (Node.bIsVariable.GetValue())
+				{
+					RegisterBindableWidget(WidgetBlueprint, Widget);
+				}
+				else
+				{
+					Widget->bIsVariable = false;
+					WidgetBlueprint->OnVariableRemoved(Widget->GetFName());
+				}
+
+				bStructureChanged = true;
+				++Result.PropertyChangeCount;
+				Result.Changes.Add(FString::Printf(
+					TEXT("set %s.isVariable=%s"),
+					*Widget->GetName(),
+					Node.bIsVariable.GetValue() ? TEXT("true") : TEXT("false")));
+			}
+
+			for (const TUniquePtr<FOctoMCPParsedPropertyValue>& ParsedValue : Node.ParsedProperties)
+			{
+				if (ApplyParsedPropertyValue(Widget, *ParsedValue))
+				{
+					++Result.PropertyChangeCount;
+					Result.Changes.Add(FString::Printf(TEXT("set %s.%s"), *Widget->GetName(), *ParsedValue->PropertyPath));
+				}
+			}
+
+			// Every node with slot values has a panel parent, so it was given a slot of that panel's class above.
+			check(Node.ParsedSlotProperties.IsEmpty() || Widget->Slot != nullptr);
+			for (const TUniquePtr<FOctoMCPParsedPropertyValue>& ParsedValue : Node.ParsedSlotProperties)
+			{
+				if (ApplyParsedPropertyValue(Widget->Slot, *ParsedValue))
+				{
+					++Result.PropertyChangeCount;
+					Result.Changes.Add(FString::Printf(
+						TEXT("set %s.slot.%s"),
+						*Widget->GetName(),
+						*ParsedValue->PropertyPath));
+				}
+			}
+		}
+
+		Result.bChanged = bStructureChanged || Result.PropertyChangeCount > 0;
+		if (!Result.bChanged)
+		{
+			Result.bSuccess = true;
+			Result.Message = FString::Printf(
+				TEXT("Widget tree of %s already matches the spec (%d widgets); nothing to compile."),
+				*AssetObjectPath,
+				Result.WidgetCount);
+			return Result;
+		}
+
+		WidgetBlueprint->MarkPackageDirty();
+		if (bStructureChanged)
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+		}
+		else
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBlueprint);
+		}
+		FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+
+		if (bSaveAsset)
+		{
+			UEditorAssetSubsystem* const EditorAssetSubsystem =
+				GEditor != nullptr ? GEditor->GetEditorSubsystem<UEditorAssetSubsystem>() : nullptr;
+			if (EditorAssetSubsystem == nullptr)
+			{
+				Result.Message = FString::Printf(
+					TEXT("Applied widget tree but could not access the EditorAssetSubsystem to save it: %s"),
+					*AssetObjectPath);
+				return Result;
+			}
+
+			Result.bSaved = EditorAssetSubsystem->SaveLoadedAsset(WidgetBlueprint, false);
+			if (!Result.bSaved)
+			{
+				Result.Message = FString::Printf(
+					TEXT("Applied widget tree but failed to save it: %s"),
+					*AssetObjectPath);
+				return Result;
+			}
+		}
+
+		Result.bSuccess = true;
+		Result.Message = FString::Printf(
+			TEXT("Applied widget tree to %s: %d created, %d replaced, %d removed, %d moved, %d property change(s)."),
+			*AssetObjectPath,
+			Result.CreatedCount,
+			Result.ReplacedCount,
+			Result.RemovedCount,
+			Result.MovedCount,
+			Result.PropertyChangeCount);
+		return Result;
+	}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildGetWidgetTreeObject(
+		const FString& AssetPath,
+		const FString& LastHash,
+		const bool bIncludeProperties) const
+	{
+		const FGetWidgetTreeResult TreeResult = GetWidgetTree(AssetPath, LastHash, bIncludeProperties);
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetBoolField(TEXT("notModified"), TreeResult.bNotModified);
+		ResultObject->SetBoolField(TEXT("success"), TreeResult.bSuccess);
+		ResultObject->SetNumberField(TEXT("widgetCount"), TreeResult.WidgetCount);
+		ResultObject->SetStringField(TEXT("message"), TreeResult.Message);
+		ResultObject->SetStringField(TEXT("assetPath"), TreeResult.AssetPath);
+		ResultObject->SetStringField(TEXT("assetObjectPath"), TreeResult.AssetObjectPath);
+		ResultObject->SetStringField(TEXT("packagePath"), TreeResult.PackagePath);
+		ResultObject->SetStringField(TEXT("assetName"), TreeResult.AssetName);
+		ResultObject->SetStringField(TEXT("rootWidgetName"), TreeResult.RootWidgetName);
+		ResultObject->SetStringField(TEXT("contentHash"), TreeResult.ContentHash);
+		ResultObject->SetArrayField(TEXT("widgets"), TreeResult.Widgets);
+		return ResultObject;
+	}
+
+	FGetWidgetTreeResult FOctoMCPModule::GetWidgetTree(
+		const FString& InAssetPath,
+		const FString& InLastHash,
+		const bool bIncludeProperties) const
+	{
+		FGetWidgetTreeResult Result;
+
+		FString AssetPackageName;
+		FString AssetObjectPath;
+		FString ErrorMessage;
+		if (!NormalizeWidgetBlueprintAssetPath(
+				InAssetPath,
+				AssetPackageName,
+				Result.PackagePath,
+				Result.AssetName,
+				AssetObjectPath,
+				ErrorMessage))
+		{
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		Result.AssetPath = AssetPackageName;
+		Result.AssetObjectPath = AssetObjectPath;
+
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
+		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
+		{
+			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
+			return Result;
+		}
+
+		UWidget* const RootWidget = WidgetBlueprint->WidgetTree->RootWidget;
+		Result.RootWidgetName = RootWidget != nullptr ? RootWidget->GetName() : FString();
+
+		// Depth-first pre-order keeps the listing (and therefore the hash) stable for an unchanged tree.
+		TArray<UWidget*> PendingWidgets;
+		if (RootWidget != nullptr)
+		{
+			PendingWidgets.Add(RootWidget);
+		}
+
+		TArray<TSharedPtr<FJsonValue>> WidgetValues;
+		while (!PendingWidgets.IsEmpty())
+		{
+			UWidget* const Widget = PendingWidgets.Pop(EAllowShrinking::No);
+			UPanelWidget* const ParentWidget = Widget->GetParent();
+
+			TSharedRef<FJsonObject> WidgetObject = MakeShared<FJsonObject>();
+			WidgetObject->SetStringField(TEXT("name"), Widget->GetName());
+			WidgetObject->SetStringField(TEXT("class"), Widget->GetClass()->GetPathName());
+			WidgetObject->SetStringField(TEXT("parent"), ParentWidget != nullptr ? ParentWidget->GetName() : FString());
+			WidgetObject->SetNumberField(TEXT("index"), ParentWidget != nullptr ? ParentWidget->GetChildIndex(Widget) : 0);
+			WidgetObject->SetBoolField(TEXT("isVariable"), Widget->bIsVariable);
+			if (Widget->Slot != nullptr)
+			{
+				WidgetObject->SetStringField(TEXT("slotClass"), Widget->Slot->GetClass()->GetName());
+				WidgetObject->SetObjectField(TEXT("slot"), ExportNonDefaultProperties(Widget->Slot));
+			}
+			WidgetObject->SetObjectField(TEXT("properties"), ExportNonDefaultProperties(Widget));
+			WidgetValues.Add(MakeShared<FJsonValueObject>(WidgetObject));
+
+			if (const UPanelWidget* const PanelWidget = Cast<UPanelWidget>(Widget))
+			{
+				for (int32 ChildIndex = PanelWidget->GetChildrenCount() - 1; ChildIndex >= 0; --ChildIndex)
+				{
+					if (UWidget* const ChildWidget = PanelWidget->GetChildAt(ChildIndex))
+					{
+						PendingWidgets.Add(ChildWidget);
+					}
+				}
+			}
+		}
+
+		FString CanonicalText;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> CanonicalWriter =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&CanonicalText);
+		FJsonSerializer::Serialize(WidgetValues, CanonicalWriter);
+
+		const FTCHARToUTF8 CanonicalUtf8(*CanonicalText);
+		FMD5 ContentMD5;
+		ContentMD5.Update(reinterpret_cast<const uint8*>(CanonicalUtf8.Get()), CanonicalUtf8.Length());
+		FMD5Hash ContentHash;
+		ContentHash.Set(ContentMD5);
+
+		Result.ContentHash = LexToString(ContentHash);
+		Result.WidgetCount = WidgetValues.Num();
+		Result.bSuccess = true;
+
+		// The hash always covers properties so a property-only edit changes it whatever includeProperties says;
+		// the flag only trims the response.
+		if (!bIncludeProperties)
+		{
+			for (const TSharedPtr<FJsonValue>& WidgetValue : WidgetValues)
+			{
+				WidgetValue->AsObject()->RemoveField(TEXT("properties"));
+			}
+		}
+
+		if (!InLastHash.IsEmpty() && InLastHash.Equals(Result.ContentHash, ESearchCase::IgnoreCase))
+		{
+			Result.bNotModified = true;
+			Result.Message = FString::Printf(TEXT("Widget tree of %s is not modified."), *AssetObjectPath);
+			return Result;
+		}
+
+		Result.Widgets = MoveTemp(WidgetValues);
+		Result.Message = FString::Printf(
+			TEXT("Listed %d widget(s) in %s."),
+			Result.WidgetCount,
+			*AssetObjectPath);
+		return Result;
+	}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildSetWidgetPropertiesObject(
+		const FString& AssetPath,
+		const TArray<TSharedPtr<FJsonObject>>& EntryObjects,
+		const bool bSaveAsset) const
+	{
+		const FSetWidgetPropertiesResult SetResult = SetWidgetProperties(AssetPath, EntryObjects, bSaveAsset);
+
+		TArray<TSharedPtr<FJsonValue>> ChangeValues;
+		for (const FString& Change : SetResult.Changes)
+		{
+			ChangeValues.Add(MakeShared<FJsonValueString>(Change));
+		}
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetBoolField(TEXT("changed"), SetResult.bChanged);
+		ResultObject->SetBoolField(TEXT("saved"), SetResult.bSaved);
+		ResultObject->SetBoolField(TEXT("success"), SetResult.bSuccess);
+		ResultObject->SetNumberField(TEXT("entryCount"), SetResult.EntryCount);
+		ResultObject->SetNumberField(TEXT("changedCount"), SetResult.ChangedCount);
+		ResultObject->SetNumberField(TEXT("unchangedCount"), SetResult.UnchangedCount);
+		ResultObject->SetStringField(TEXT("message"), SetResult.Message);
+		ResultObject->SetStringField(TEXT("assetPath"), SetResult.AssetPath);
+		ResultObject->SetStringField(TEXT("assetObjectPath"), SetResult.AssetObjectPath);
+		ResultObject->SetStringField(TEXT("packagePath"), SetResult.PackagePath);
+		ResultObject->SetStringField(TEXT("assetName"), SetResult.AssetName);
+		ResultObject->SetArrayField(TEXT("changes"), ChangeValues);
+		return ResultObject;
+	}
+
+	FSetWidgetPropertiesResult FOctoMCPModule::SetWidgetProperties(
+		const FString& InAssetPath,
+		const TArray<TSharedPtr<FJsonObject>>& InEntryObjects,
+		const bool bSaveAsset) const
+	{
+		FSetWidgetPropertiesResult Result;
+		Result.EntryCount = InEntryObjects.Num();
+
+		FString AssetPackageName;
+		FString AssetObjectPath;
+		FString ErrorMessage;
+		if (!NormalizeWidgetBlueprintAssetPath(
+				InAssetPath,
+				AssetPackageName,
+				Result.PackagePath,
+				Result.AssetName,
+				AssetObjectPath,
+				ErrorMessage))
+		{
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		Result.AssetPath = AssetPackageName;
+		Result.AssetObjectPath = AssetObjectPath;
+
+		if (InEntryObjects.IsEmpty())
+		{
+			Result.Message = TEXT("entries must contain at least one {widget, propertyPath, value} object.");
+			return Result;
+		}
+
+		UWidgetBlueprint* const WidgetBlueprint = LoadWorkingSetWidgetBlueprint(AssetObjectPath);
+		if (WidgetBlueprint == nullptr || WidgetBlueprint->WidgetTree == nullptr)
+		{
+			Result.Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
+			return Result;
+		}
+
+		struct FPropertyAssignment
+		{
+			UObject* Target = nullptr;
+			FString Label;
+			TUniquePtr<FOctoMCPParsedPropertyValue> ParsedValue;
+		};
+
+		// Resolve and parse every entry before touching anything so a bad widget name, path or value leaves the
+		// asset untouched. Property paths go through the (class, path) cache, so repeated calls skip the reflection walk.
+		TArray<FPropertyAssignment> Assignments;
+		Assignments.Reserve(InEntryObjects.Num());
+		for (int32 EntryIndex = 0; EntryIndex < InEntryObjects.Num(); ++EntryIndex)
+		{
+			const TSharedPtr<FJsonObject>& EntryObject = InEntryObjects[EntryIndex];
+
+			FString WidgetName;
+			FString PropertyPath;
+			FString ValueText;
+			if (!EntryObject->TryGetStringField(TEXT("widget"), WidgetName) || WidgetName.TrimStartAndEnd().IsEmpty())
+			{
+				Result.Message = FString::Printf(TEXT("entries[%d].widget must be a non-empty string."), EntryIndex);
+				return Result;
+			}
+
+			if (!EntryObject->TryGetStringField(TEXT("propertyPath"), PropertyPath) || PropertyPath.TrimStartAndEnd().IsEmpty())
+			{
+				Result.Message = FString::Printf(TEXT("entries[%d].propertyPath must be a non-empty string."), EntryIndex);
+				return Result;
+			}
+
+			if (!OctoMCP::JsonValueToImportText(EntryObject->TryGetField(TEXT("value")), ValueText))
+			{
+				Result.Message = FString::Printf(
+					TEXT("entries[%d].value must be a string (Unreal import text), number or boolean."),
+					EntryIndex);
+				return Result;
+			}
+
+			WidgetName.TrimStartAndEndInline();
+			PropertyPath.TrimStartAndEndInline();
+
+			UWidget* const Widget = WidgetBlueprint->WidgetTree->FindWidget(FName(*WidgetName));
+			if (Widget == nullptr)
+			{
+				Result.Message = FString::Printf(
+					TEXT("entries[%d]: could not find widget %s in %s."),
+					EntryIndex,
+					*WidgetName,
+					*AssetObjectPath);
+				return Result;
+			}
+
+			FPropertyAssignment& Assignment = Assignments.AddDefaulted_GetRef();
+			Assignment.Target = Widget;
+			Assignment.Label = WidgetName;
+			FString TargetPropertyPath = PropertyPath;
+
+			// "Slot.<path>" addresses the widget's panel slot instead of the widget itself.
+			if (PropertyPath.StartsWith(TEXT("Slot."), ESearchCase::IgnoreCase))
+			{
+				if (Widget->Slot == nullptr)
+				{
+					Result.Message = FString::Printf(
+						TEXT("entries[%d]: %s has no parent panel slot."),
+						EntryIndex,
+						*WidgetName);
+					return Result;
+				}
+
+				Assignment.Target = Widget->Slot;
+				Assignment.Label = FString::Printf(TEXT("%s.Slot"), *WidgetName);
+				TargetPropertyPath = PropertyPath.RightChop(5);
+			}
+
+			Assignment.ParsedValue = MakeUnique<FOctoMCPParsedPropertyValue>();
+			if (!ParsePropertyValueText(
+					Assignment.Target->GetClass(),
+					Assignment.Target,
+					TargetPropertyPath,
+					ValueText,
+					*Assignment.ParsedValue,
+					ErrorMessage))
+			{
+				Result.Message = FString::Printf(TEXT("entries[%d]: %s"), EntryIndex, *ErrorMessage);
+				return Result;
+			}
+		}
+
+		for (const FPropertyAssignment& Assignment : Assignments)
+		{
+			if (ApplyParsedPropertyValue(Assignment.Target, *Assignment.ParsedValue))
+			{
+				++Result.ChangedCount;
+				Result.Changes.Add(FString::Printf(TEXT("set %s.%s"), *Assignment.Label, *Assignment.ParsedValue->PropertyPath));
+			}
+			else
+			{
+				++Result.UnchangedCount;
+			}
+		}
+
+		Result.bChanged = Result.ChangedCount > 0;
+		if (!Result.bChanged)
+		{
+			Result.bSuccess = true;
+			Result.Message = FString::Printf(
+				TEXT("All %d property value(s) on %s already match; nothing to compile."),
+				Result.EntryCount,
+				*AssetObjectPath);
+			return Result;
+		}
+
+		WidgetBlueprint->MarkPackageDirty();
+		FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBlueprint);
+		FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+
+		if (bSaveAsset)
+		{
+			UEditorAssetSubsystem* const EditorAssetSubsystem =
+				GEditor != nullptr ? GEditor->GetEditorSubsystem<UEditorAssetSubsystem>() : nullptr;
+			if (EditorAssetSubsystem == nullptr)
+			{
+				Result.Message = FString::Printf(
+					TEXT("Set widget properties but could not access the EditorAssetSubsystem to save it: %s"),
+					*AssetObjectPath);
+				return Result;
+			}
+
+			Result.bSaved = EditorAssetSubsystem->SaveLoadedAsset(WidgetBlueprint, false);
+			if (!Result.bSaved)
+			{
+				Result.Message = FString::Printf(
+					TEXT("Set widget properties but failed to save it: %s"),
+					*AssetObjectPath);
+				return Result;
+			}
+		}
+
+		Result.bSuccess = true;
+		Result.Message = FString::Printf(
+			TEXT("Changed %d of %d property value(s) on %s under a single compile."),
+			Result.ChangedCount,
+			Result.EntryCount,
+			*AssetObjectPath);
+		return Result;
+	}
+
+	void FOctoMCPModule::DryRunApplyWidgetTree(
+		const TSharedPtr<FJsonObject>& TreeObject,
+		const FOctoMCPWidgetTreeMetadata* const TreeMetadata,
+		FDryRunResult& Result) const
+	{
+		// Same parser as apply_widget_tree, but classes are only looked up, never loaded. A Widget Blueprint
+		// class that is not in memory stands in as UUserWidget, which still rejects children placed under it.
+		auto FindWidgetClass = [this, &Result](const FString& ClassReference, FString& OutError) -> UClass*
+		{
+			UClass* WidgetClass = nullptr;
+			if (!ClassReference.Contains(TEXT("/")) && !ClassReference.Contains(TEXT(".")))
+			{
+				FString NativeClassName = ClassReference;
+				if (NativeClassName.Len() > 1 && NativeClassName[0] == TEXT('U') && FChar::IsUpper(NativeClassName[1]))
+				{
+					NativeClassName.RightChopInline(1, EAllowShrinking::No);
+				}
+
+				WidgetClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/UMG.%s"), *NativeClassName));
+			}
+
+			if (WidgetClass == nullptr)
+			{
+				bool bFoundUnloadedBlueprint = false;
+				WidgetClass = FindClassWithoutLoading(ClassReference, UWidget::StaticClass(), bFoundUnloadedBlueprint, OutError);
+				if (bFoundUnloadedBlueprint)
+				{
+					Result.Warnings.AddUnique(FString::Printf(
+						TEXT("Widget class %s is not loaded; only its asset registry entry was checked."),
+						*ClassReference));
+					return UUserWidget::StaticClass();
+				}
+
+				if (WidgetClass == nullptr)
+				{
+					return nullptr;
+				}
+			}
+
+			if (!WidgetClass->IsChildOf(UWidget::StaticClass())
+				|| WidgetClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+			{
+				OutError = FString::Printf(TEXT("%s is not a concrete widget class."), *WidgetClass->GetPathName());
+				return nullptr;
+			}
+
+			return WidgetClass;
+		};
+
+		TArray<FOctoMCPWidgetSpecNode> Nodes;
+		TMap<FName, int32> NodeIndexByName;
+		FString ErrorMessage;
+		if (!ParseWidgetSpecNode(TreeObject, INDEX_NONE, FindWidgetClass, Nodes, NodeIndexByName, ErrorMessage))
+		{
+			Result.Problems.Add(ErrorMessage);
+			return;
+		}
+
+		if (TreeMetadata == nullptr)
+		{
+			Result.PlannedChanges.Add(FString::Printf(
+				TEXT("apply a tree of %d widget(s) rooted at %s"),
+				Nodes.Num(),
+				*Nodes[0].Name.ToString()));
+			return;
+		}
+
+		for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+		{
+			const FOctoMCPWidgetSpecNode& Node = Nodes[NodeIndex];
+			const FName ParentName = Node.ParentIndex != INDEX_NONE ? Nodes[Node.ParentIndex].Name : NAME_None;
+			const int32 DesiredChildIndex = Node.ParentIndex != INDEX_NONE
+				? Nodes[Node.ParentIndex].ChildIndices.IndexOfByKey(NodeIndex)
+				: INDEX_NONE;
+
+			const FOctoMCPWidgetMetadata* const ExistingWidget = TreeMetadata->Widgets.Find(Node.Name);
+			const UClass* const ExistingClass = ExistingWidget != nullptr ? ExistingWidget->WidgetClass.Get() : nullptr;
+			const bool bSameClass = ExistingClass == Node.WidgetClass
+				|| (Node.WidgetClass == UUserWidget::StaticClass() && ExistingClass != nullptr && ExistingClass->IsChildOf(UUserWidget::StaticClass()));
+
+			if (ExistingWidget == nullptr)
+			{
+				Result.PlannedChanges.Add(FString::Printf(
+					TEXT("create %s (%s)%s"),
+					*Node.Name.ToString(),
+					*Node.WidgetClass->GetName(),
+					ParentName.IsNone() ? TEXT(" as root") : *FString::Printf(TEXT(" under %s"), *ParentName.ToString())));
+				continue;
+			}
+
+			if (!bSameClass)
+			{
+				Result.PlannedChanges.Add(FString::Printf(
+					TEXT("replace %s (%s -> %s)"),
+					*Node.Name.ToString(),
+					ExistingClass != nullptr ? *ExistingClass->GetName() : TEXT("unknown"),
+					*Node.WidgetClass->GetName()));
+			}
+			else if (ExistingWidget->ParentName != ParentName || ExistingWidget->ChildIndex != DesiredChildIndex)
+			{
+				Result.PlannedChanges.Add(FString::Printf(
+					TEXT("move %s%s"),
+					*Node.Name.ToString(),
+					ParentName.IsNone() ? TEXT(" to root") : *FString::Printf(TEXT(" under %s at %d"), *ParentName.ToString(), DesiredChildIndex)));
+			}
+
+			const int32 ValueCount = Node.Properties.Num() + Node.SlotProperties.Num();
+			if (ValueCount > 0)
+			{
+				Result.PlannedChanges.Add(FString::Printf(
+					TEXT("apply %d property value(s) to %s"),
+					ValueCount,
+					*Node.Name.ToString()));
+			}
+		}
+
+		for (const TPair<FName, FOctoMCPWidgetMetadata>& ExistingWidget : TreeMetadata->Widgets)
+		{
+			if (!NodeIndexByName.Contains(ExistingWidget.Key))
+			{
+				Result.PlannedChanges.Add(FString::Printf(TEXT("remove %s"), *ExistingWidget.Key.ToString()));
+			}
+		}
+	}
@@ -0,0 +1,271 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OctoMCPModule.h"
+
+	void FOctoMCPModule::StartWidgetBlueprintWorkingSet()
+	{
+		WorkingSetMemoryTrimHandle =
+			FCoreDelegates::GetMemoryTrimDelegate().AddRaw(this, &FOctoMCPModule::HandleMemoryTrimForWorkingSet);
+		WorkingSetAssetsPreDeleteHandle =
+			FEditorDelegates::OnAssetsPreDelete.AddRaw(this, &FOctoMCPModule::HandleAssetsPreDeleteForWorkingSet);
+	}
+
+	void FOctoMCPModule::StopWidgetBlueprintWorkingSet()
+	{
+		FCoreDelegates::GetMemoryTrimDelegate().Remove(WorkingSetMemoryTrimHandle);
+		WorkingSetMemoryTrimHandle.Reset();
+		FEditorDelegates::OnAssetsPreDelete.Remove(WorkingSetAssetsPreDeleteHandle);
+		WorkingSetAssetsPreDeleteHandle.Reset();
+		WorkingSetEntries.Empty();
+	}
+
+	UWidgetBlueprint* FOctoMCPModule::LoadWorkingSetWidgetBlueprint(const FString& AssetObjectPath) const
+	{
+		// LoadObject returns the resident object without touching disk; the working set only keeps it resident.
+		UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath);
+		if (WidgetBlueprint != nullptr)
+		{
+			TouchWorkingSetEntry(WidgetBlueprint, AssetObjectPath, false);
+		}
+
+		return WidgetBlueprint;
+	}
+
+	void FOctoMCPModule::TouchWorkingSetEntry(
+		UWidgetBlueprint* WidgetBlueprint,
+		const FString& AssetObjectPath,
+		const bool bPin) const
+	{
+		check(WidgetBlueprint != nullptr);
+
+		const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+		if (MemoryStats.AvailablePhysical < OctoMCP::WorkingSetMinAvailablePhysicalMB * 1024 * 1024)
+		{
+			ReleaseWorkingSet(FString::Printf(
+				TEXT("Available physical memory dropped to %llu MB."),
+				MemoryStats.AvailablePhysical / (1024 * 1024)));
+		}
+
+		FOctoMCPWorkingSetEntry Entry;
+		const int32 ExistingIndex = WorkingSetEntries.IndexOfByPredicate([&AssetObjectPath](const FOctoMCPWorkingSetEntry& Candidate)
+		{
+			return Candidate.AssetObjectPath.Equals(AssetObjectPath, ESearchCase::IgnoreCase);
+		});
+		if (ExistingIndex != INDEX_NONE)
+		{
+			Entry = MoveTemp(WorkingSetEntries[ExistingIndex]);
+			WorkingSetEntries.RemoveAt(ExistingIndex, EAllowShrinking::No);
+		}
+		else
+		{
+			Entry.AssetObjectPath = AssetObjectPath;
+		}
+
+		// A reload after a force-delete or rename can hand back a different object for the same path.
+		Entry.WidgetBlueprint.Reset(WidgetBlueprint);
+		Entry.bPinned |= bPin;
+		++Entry.UseCount;
+		Entry.LastUsedTime = FPlatformTime::Seconds();
+		WorkingSetEntries.Add(MoveTemp(Entry));
+
+		TrimWorkingSet();
+	}
+
+	void FOctoMCPModule::TrimWorkingSet() const
+	{
+		// Entries are kept oldest first, so the first unpinned entry is always the least recently used one.
+		int32 Index = 0;
+		while (WorkingSetEntries.Num() > OctoMCP::WorkingSetCapacity && Index < WorkingSetEntries.Num())
+		{
+			if (WorkingSetEntries[Index].bPinned)
+			{
+				++Index;
+				continue;
+			}
+
+			WorkingSetEntries.RemoveAt(Index, EAllowShrinking::No);
+		}
+	}
+
+	void FOctoMCPModule::ReleaseWorkingSet(const FString& Reason) const
+	{
+		const int32 ReleasedCount = WorkingSetEntries.RemoveAll([](const FOctoMCPWorkingSetEntry& Entry)
+		{
+			return !Entry.bPinned;
+		});
+		if (ReleasedCount == 0)
+		{
+			return;
+		}
+
+		++WorkingSetMemoryPressureReleaseCount;
+		WorkingSetLastReleaseReason = Reason;
+		UE_LOG(
+			LogOctoMCP,
+			Log,
+			TEXT("Released %d unpinned Widget Blueprint(s) from the OctoMCP working set. %s"),
+			ReleasedCount,
+			*Reason);
+	}
+
+	void FOctoMCPModule::HandleMemoryTrimForWorkingSet()
+	{
+		ReleaseWorkingSet(TEXT("The platform requested a memory trim."));
+	}
+
+	void FOctoMCPModule::HandleAssetsPreDeleteForWorkingSet(const TArray<UObject*>& Objects)
+	{
+		// Pinned or not, a strong reference here would make the editor report the asset as still in use.
+		WorkingSetEntries.RemoveAll([&Objects](const FOctoMCPWorkingSetEntry& Entry)
+		{
+			return Objects.Contains(Entry.WidgetBlueprint.Get());
+		});
+	}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildWorkingSetObject(const FWorkingSetResult& WorkingSetResult) const
+	{
+		TArray<TSharedPtr<FJsonValue>> EntryValues;
+		EntryValues.Reserve(WorkingSetResult.Entries.Num());
+		for (const FWorkingSetEntryStatus& Entry : WorkingSetResult.Entries)
+		{
+			TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+			EntryObject->SetBoolField(TEXT("pinned"), Entry.bPinned);
+			EntryObject->SetNumberField(TEXT("useCount"), Entry.UseCount);
+			EntryObject->SetNumberField(TEXT("secondsSinceLastUse"), Entry.SecondsSinceLastUse);
+			EntryObject->SetStringField(TEXT("assetObjectPath"), Entry.AssetObjectPath);
+			EntryValues.Add(MakeShared<FJsonValueObject>(EntryObject));
+		}
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetBoolField(TEXT("success"), WorkingSetResult.bSuccess);
+		ResultObject->SetNumberField(TEXT("capacity"), WorkingSetResult.Capacity);
+		ResultObject->SetNumberField(TEXT("count"), WorkingSetResult.Entries.Num());
+		ResultObject->SetNumberField(TEXT("pinnedCount"), WorkingSetResult.PinnedCount);
+		ResultObject->SetNumberField(TEXT("memoryPressureReleaseCount"), WorkingSetResult.MemoryPressureReleaseCount);
+		ResultObject->SetStringField(TEXT("message"), WorkingSetResult.Message);
+		ResultObject->SetStringField(TEXT("assetObjectPath"), WorkingSetResult.AssetObjectPath);
+		ResultObject->SetStringField(TEXT("lastReleaseReason"), WorkingSetResult.LastReleaseReason);
+		ResultObject->SetArrayField(TEXT("entries"), EntryValues);
+		return ResultObject;
+	}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildGetWorkingSetObject() const
+	{
+		return BuildWorkingSetObject(GetWorkingSet());
+	}
+
+	TSharedRef<FJsonObject> FOctoMCPModule::BuildPinWorkingSetAssetObject(const FString& AssetPath, const bool bPinned) const
+	{
+		return BuildWorkingSetObject(PinWorkingSetAsset(AssetPath, bPinned));
+	}
+
+	FWorkingSetResult FOctoMCPModule::GetWorkingSet() const
+	{
+		FWorkingSetResult Result;
+		Result.bSuccess = true;
+		Result.Capacity = OctoMCP::WorkingSetCapacity;
+		Result.MemoryPressureReleaseCount = WorkingSetMemoryPressureReleaseCount;
+		Result.LastReleaseReason = WorkingSetLastReleaseReason;
+
+		// Most recently used first.
+		const double Now = FPlatformTime::Seconds();
+		Result.Entries.Reserve(WorkingSetEntries.Num());
+		for (int32 Index = WorkingSetEntries.Num() - 1; Index >= 0; --Index)
+		{
+			const FOctoMCPWorkingSetEntry& Entry = WorkingSetEntries[Index];
+
+			FWorkingSetEntryStatus& Status = Result.Entries.AddDefaulted_GetRef();
+			Status.bPinned = Entry.bPinned;
+			Status.UseCount = Entry.UseCount;
+			Status.SecondsSinceLastUse = Now - Entry.LastUsedTime;
+			Status.AssetObjectPath = Entry.AssetObjectPath;
+			if (Entry.bPinned)
+			{
+				++Result.PinnedCount;
+			}
+		}
+
+		Result.Message = FString::Printf(
+			TEXT("%d of %d working set slot(s) in use, %d pinned."),
+			Result.Entries.Num(),
+			Result.Capacity,
+			Result.PinnedCount);
+		return Result;
+	}
+
+	FWorkingSetResult FOctoMCPModule::PinWorkingSetAsset(const FString& InAssetPath, const bool bPinned) const
+	{
+		FString AssetPackageName;
+		FString PackagePath;
+		FString AssetName;
+		FString AssetObjectPath;
+		FString ErrorMessage;
+		if (!NormalizeWidgetBlueprintAssetPath(
+				InAssetPath,
+				AssetPackageName,
+				PackagePath,
+				AssetName,
+				AssetObjectPath,
+				ErrorMessage))
+		{
+			FWorkingSetResult Result = GetWorkingSet();
+			Result.bSuccess = false;
+			Result.Message = ErrorMessage;
+			return Result;
+		}
+
+		FOctoMCPWorkingSetEntry* const ExistingEntry = WorkingSetEntries.FindByPredicate([&AssetObjectPath](const FOctoMCPWorkingSetEntry& Entry)
+		{
+			return Entry.AssetObjectPath.Equals(AssetObjectPath, ESearchCase::IgnoreCase);
+		});
+
+		FString Message;
+		bool bSuccess = true;
+		if (!bPinned)
+		{
+			// Unpinning keeps the entry; it simply becomes eligible for eviction again.
+			if (ExistingEntry == nullptr)
+			{
+				Message = FString::Printf(TEXT("%s is not in the working set; nothing to unpin."), *AssetObjectPath);
+			}
+			else
+			{
+				ExistingEntry->bPinned = false;
+				TrimWorkingSet();
+				Message = FString::Printf(TEXT("Unpinned %s."), *AssetObjectPath);
+			}
+		}
+		else
+		{
+			int32 PinnedCount = 0;
+			for (const FOctoMCPWorkingSetEntry& Entry : WorkingSetEntries)
+			{
+				PinnedCount += Entry.bPinned ? 1 : 0;
+			}
+
+			if ((ExistingEntry == nullptr || !ExistingEntry->bPinned) && PinnedCount >= OctoMCP::WorkingSetCapacity)
+			{
+				bSuccess = false;
+				Message = FString::Printf(
+					TEXT("All %d working set slots are pinned; unpin an asset before pinning %s."),
+					OctoMCP::WorkingSetCapacity,
+					*AssetObjectPath);
+			}
+			else if (UWidgetBlueprint* const WidgetBlueprint = LoadObject<UWidgetBlueprint>(nullptr, *AssetObjectPath))
+			{
+				TouchWorkingSetEntry(WidgetBlueprint, AssetObjectPath, true);
+				Message = FString::Printf(TEXT("Pinned %s."), *AssetObjectPath);
+			}
+			else
+			{
+				bSuccess = false;
+				Message = FString::Printf(TEXT("Could not load Widget Blueprint asset: %s"), *AssetObjectPath);
+			}
+		}
+
+		FWorkingSetResult Result = GetWorkingSet();
+		Result.bSuccess = bSuccess;
+		Result.AssetObjectPath = AssetObjectPath;
+		Result.Message = FString::Printf(TEXT("%s %s"), *Message, *Result.Message);
+		return Result;
+	}
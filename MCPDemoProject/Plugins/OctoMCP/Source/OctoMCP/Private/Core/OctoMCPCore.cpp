@@ -119,6 +119,91 @@ namespace
 		return true;
 	}
 
+	void FOctoMCPModule::RunAfterPreloadingAssets(const TArray<FString>& AssetPaths, TFunction<void()> GameThreadWork) const
+	{
+		if (!IsInGameThread())
+		{
+			AsyncTask(ENamedThreads::GameThread, [this, AssetPaths, GameThreadWork = MoveTemp(GameThreadWork)]() mutable
+			{
+				RunAfterPreloadingAssets(AssetPaths, MoveTemp(GameThreadWork));
+			});
+			return;
+		}
+
+		// Only packages the asset index knows about and that are not resident yet are requested. Anything else,
+		// including a failed load, is left to the command's own synchronous load and its error message.
+		TSet<FString> PackageNames;
+		for (const FString& AssetPath : AssetPaths)
+		{
+			if (AssetPath.IsEmpty())
+			{
+				continue;
+			}
+
+			const FString PackageName =
+				FPackageName::ObjectPathToPackageName(FPackageName::ExportTextPathToObjectPath(AssetPath));
+			if (PackageName.IsEmpty() || FPackageName::IsScriptPackage(PackageName))
+			{
+				continue;
+			}
+
+			const UPackage* const Package = FindPackage(nullptr, *PackageName);
+			if (Package != nullptr && Package->IsFullyLoaded())
+			{
+				continue;
+			}
+
+			FAssetData AssetData;
+			const FString AssetObjectPath =
+				FString::Printf(TEXT("%s.%s"), *PackageName, *FPackageName::GetShortName(PackageName));
+			if (FindIndexedAsset(AssetObjectPath, AssetData))
+			{
+				PackageNames.Add(PackageName);
+			}
+		}
+
+		// Every command joins one FIFO queue, including those with nothing to load, so a command never overtakes an
+		// earlier one that is still waiting on its preload. Loads for later commands still start right away.
+		TSharedRef<FOctoMCPQueuedCommand> QueuedCommand = MakeShared<FOctoMCPQueuedCommand>();
+		QueuedCommand->GameThreadWork = MoveTemp(GameThreadWork);
+		QueuedCommand->PendingLoadCount = PackageNames.Num();
+		GameThreadCommandQueue.Add(QueuedCommand);
+
+		// Completion callbacks fire on the game thread.
+		for (const FString& PackageName : PackageNames)
+		{
+			LoadPackageAsync(
+				PackageName,
+				FLoadPackageAsyncDelegate::CreateLambda(
+					[this, QueuedCommand](const FName&, UPackage*, EAsyncLoadingResult::Type)
+					{
+						if (--QueuedCommand->PendingLoadCount == 0)
+						{
+							PumpGameThreadCommandQueue();
+						}
+					}));
+		}
+
+		PumpGameThreadCommandQueue();
+	}
+
+	void FOctoMCPModule::PumpGameThreadCommandQueue() const
+	{
+		check(IsInGameThread());
+
+		// Ready commands are posted rather than run inline: inline they could run nested inside another command's
+		// FlushAsyncLoading. The game-thread task queue is FIFO, so posting keeps the order.
+		while (!GameThreadCommandQueue.IsEmpty() && GameThreadCommandQueue[0]->PendingLoadCount == 0)
+		{
+			TSharedRef<FOctoMCPQueuedCommand> QueuedCommand = GameThreadCommandQueue[0];
+			GameThreadCommandQueue.RemoveAt(0, EAllowShrinking::No);
+			AsyncTask(ENamedThreads::GameThread, [QueuedCommand]()
+			{
+				QueuedCommand->GameThreadWork();
+			});
+		}
+	}
+
 	bool FOctoMCPModule::HandleCommandRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) const
 	{
 		TSharedPtr<FJsonObject> RequestObject;
@@ -150,6 +235,11 @@ namespace
 			return true;
 		}
 
+		if (HandleDryRunRequest(Command, RequestObject.ToSharedRef(), RequestId, OnComplete))
+		{
+			return true;
+		}
+
 		if (Command == OctoMCP::CommandGetVersionInfo)
 		{
 			TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
@@ -190,7 +280,7 @@ namespace
 
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(ENamedThreads::GameThread, [this, CompletionCallback, CapturedRequestId, bWaitForCompletion]()
+			RunAfterPreloadingAssets({}, [this, CompletionCallback, CapturedRequestId, bWaitForCompletion]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -219,7 +309,7 @@ namespace
 			}
 
 			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -251,9 +341,20 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(ENamedThreads::GameThread, [this, CompletionCallback, CapturedRequestId, AssetPath, ParentClassPath, bSaveAsset]()
+			RunAfterPreloadingAssets({}, [this, CompletionCallback, CapturedRequestId, AssetPath, ParentClassPath, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -261,7 +362,12 @@ namespace
 				{
 					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
 				}
-				ResponseObject->SetObjectField(TEXT("result"), BuildCreateBlueprintAssetObject(AssetPath, ParentClassPath, bSaveAsset));
+				ResponseObject->SetObjectField(TEXT("result"), BuildCreateBlueprintAssetObject(AssetPath, ParentClassPath, bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -282,7 +388,7 @@ namespace
 			}
 
 			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -303,6 +409,51 @@ namespace
 				return true;
 			}
 
+			// A scaffoldType creates the asset as a copy of that type's prebuilt template, retargeted to parentClassPath.
+			FString ScaffoldType;
+			if (!TryGetOptionalStringArgument(ArgumentsObject, TEXT("scaffoldType"), ScaffoldType, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			ScaffoldType = ScaffoldType.TrimStartAndEnd().ToLower();
+			if (!ScaffoldType.IsEmpty() && !IsScaffoldType(ScaffoldType))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					FString::Printf(TEXT("Unsupported scaffoldType: %s"), *ScaffoldType),
+					RequestId));
+				return true;
+			}
+
+			FString InvalidationBoundary;
+			if (!TryGetOptionalStringArgument(ArgumentsObject, TEXT("invalidationBoundary"), InvalidationBoundary, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			InvalidationBoundary = InvalidationBoundary.TrimStartAndEnd().ToLower();
+			if (!InvalidationBoundary.IsEmpty() && !IsInvalidationBoundaryType(InvalidationBoundary))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					FString::Printf(TEXT("Unsupported invalidationBoundary: %s"), *InvalidationBoundary),
+					RequestId));
+				return true;
+			}
+
 			bool bSaveAsset = true;
 			if (!TryGetOptionalBoolArgument(ArgumentsObject, TEXT("saveAsset"), bSaveAsset, BodyError))
 			{
@@ -314,9 +465,20 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(ENamedThreads::GameThread, [this, CompletionCallback, CapturedRequestId, AssetPath, ParentClassPath, bSaveAsset]()
+			RunAfterPreloadingAssets({}, [this, CompletionCallback, CapturedRequestId, AssetPath, ParentClassPath, ScaffoldType, InvalidationBoundary, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -324,7 +486,12 @@ namespace
 				{
 					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
 				}
-				ResponseObject->SetObjectField(TEXT("result"), BuildCreateWidgetBlueprintObject(AssetPath, ParentClassPath, bSaveAsset));
+				ResponseObject->SetObjectField(TEXT("result"), BuildCreateWidgetBlueprintObject(AssetPath, ParentClassPath, ScaffoldType, InvalidationBoundary, bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -356,7 +523,7 @@ namespace
 			}
 
 			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -377,6 +544,38 @@ namespace
 				return true;
 			}
 
+			FString ImportProfile;
+			if (!TryGetOptionalStringArgument(ArgumentsObject, TEXT("importProfile"), ImportProfile, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FOctoMCPTextureImportProfile ResolvedImportProfile;
+			if (!ImportProfile.IsEmpty() && !ResolveTextureImportProfile(ImportProfile, ResolvedImportProfile, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			if (!FPaths::FileExists(FPaths::ConvertRelativePathToFull(SourceFilePath)))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					FString::Printf(TEXT("Source file does not exist: %s"), *SourceFilePath),
+					RequestId));
+				return true;
+			}
+
 			bool bSaveAsset = true;
 			if (!TryGetOptionalBoolArgument(ArgumentsObject, TEXT("saveAsset"), bSaveAsset, BodyError))
 			{
@@ -388,9 +587,20 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(ENamedThreads::GameThread, [this, CompletionCallback, CapturedRequestId, SourceFilePath, AssetPath, bReplaceExisting, bSaveAsset]()
+			RunAfterPreloadingAssets({AssetPath}, [this, CompletionCallback, CapturedRequestId, SourceFilePath, AssetPath, ImportProfile, bReplaceExisting, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -400,7 +610,12 @@ namespace
 				}
 				ResponseObject->SetObjectField(
 					TEXT("result"),
-					BuildImportTextureAssetObject(SourceFilePath, AssetPath, bReplaceExisting, bSaveAsset));
+					BuildImportTextureAssetObject(SourceFilePath, AssetPath, ImportProfile, bReplaceExisting, bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -421,7 +636,7 @@ namespace
 			}
 
 			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -443,7 +658,7 @@ namespace
 			}
 
 			FString ChildWidgetAssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("childWidgetAssetPath"), ChildWidgetAssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("childWidgetAssetPath"), ChildWidgetAssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -465,12 +680,12 @@ namespace
 			}
 
 			int32 DesiredIndex = INDEX_NONE;
-			if (!TryGetRequiredIntArgument(ArgumentsObject, TEXT("desiredIndex"), DesiredIndex, BodyError))
+			if (!TryGetRequiredIntArgument(ArgumentsObject, TEXT("desiredIndex"), DesiredIndex, BodyError) || DesiredIndex < 0)
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
 					TEXT("invalid_arguments"),
-					BodyError,
+					BodyError.IsEmpty() ? TEXT("desiredIndex must be zero or greater.") : BodyError,
 					RequestId));
 				return true;
 			}
@@ -486,11 +701,22 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(
-				ENamedThreads::GameThread,
-				[this, CompletionCallback, CapturedRequestId, AssetPath, ParentWidgetName, ChildWidgetAssetPath, ChildWidgetName, DesiredIndex, bSaveAsset]()
+			RunAfterPreloadingAssets(
+				{AssetPath, ChildWidgetAssetPath},
+				[this, CompletionCallback, CapturedRequestId, AssetPath, ParentWidgetName, ChildWidgetAssetPath, ChildWidgetName, DesiredIndex, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -506,7 +732,12 @@ namespace
 						ChildWidgetAssetPath,
 						ChildWidgetName,
 						DesiredIndex,
-						bSaveAsset));
+						bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -527,7 +758,7 @@ namespace
 			}
 
 			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -581,9 +812,20 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(ENamedThreads::GameThread, [this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, Row, Column, bSaveAsset]()
+			RunAfterPreloadingAssets({AssetPath}, [this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, Row, Column, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -593,7 +835,12 @@ namespace
 				}
 				ResponseObject->SetObjectField(
 					TEXT("result"),
-					BuildSetUniformGridSlotObject(AssetPath, WidgetName, Row, Column, bSaveAsset));
+					BuildSetUniformGridSlotObject(AssetPath, WidgetName, Row, Column, bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -614,7 +861,7 @@ namespace
 			}
 
 			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -636,7 +883,7 @@ namespace
 			}
 
 			FString EntryWidgetAssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("entryWidgetAssetPath"), EntryWidgetAssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("entryWidgetAssetPath"), EntryWidgetAssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -701,11 +948,22 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(
-				ENamedThreads::GameThread,
-				[this, CompletionCallback, CapturedRequestId, AssetPath, GridWidgetName, EntryWidgetAssetPath, Count, ColumnCount, InstanceNamePrefix, bTrimManagedChildren, bSaveAsset]()
+			RunAfterPreloadingAssets(
+				{AssetPath, EntryWidgetAssetPath},
+				[this, CompletionCallback, CapturedRequestId, AssetPath, GridWidgetName, EntryWidgetAssetPath, Count, ColumnCount, InstanceNamePrefix, bTrimManagedChildren, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -723,7 +981,12 @@ namespace
 						ColumnCount,
 						InstanceNamePrefix,
 						bTrimManagedChildren,
-						bSaveAsset));
+						bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -744,7 +1007,7 @@ namespace
 			}
 
 			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -776,9 +1039,20 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(ENamedThreads::GameThread, [this, CompletionCallback, CapturedRequestId, AssetPath, InterfaceClassPath, bSaveAsset]()
+			RunAfterPreloadingAssets({AssetPath, InterfaceClassPath}, [this, CompletionCallback, CapturedRequestId, AssetPath, InterfaceClassPath, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -788,7 +1062,12 @@ namespace
 				}
 				ResponseObject->SetObjectField(
 					TEXT("result"),
-					BuildAddBlueprintInterfaceObject(AssetPath, InterfaceClassPath, bSaveAsset));
+					BuildAddBlueprintInterfaceObject(AssetPath, InterfaceClassPath, bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -809,7 +1088,7 @@ namespace
 			}
 
 			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -831,7 +1110,7 @@ namespace
 			}
 
 			FString EntryWidgetAssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("entryWidgetAssetPath"), EntryWidgetAssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("entryWidgetAssetPath"), EntryWidgetAssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -899,11 +1178,22 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(
-				ENamedThreads::GameThread,
-				[this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, EntryWidgetAssetPath, EntryWidth, EntryHeight, Orientation, bSaveAsset]()
+			RunAfterPreloadingAssets(
+				{AssetPath, EntryWidgetAssetPath},
+				[this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, EntryWidgetAssetPath, EntryWidth, EntryHeight, Orientation, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -920,7 +1210,12 @@ namespace
 						EntryWidth,
 						EntryHeight,
 						Orientation,
-						bSaveAsset));
+						bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -940,8 +1235,8 @@ namespace
 				return true;
 			}
 
-			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			FOctoMCPAssetTargets AssetTargets;
+			if (!TryGetAssetTargetsArgument(ArgumentsObject, AssetTargets, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1007,11 +1302,22 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(
-				ENamedThreads::GameThread,
-				[this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, BlurStrength, BlurRadius, bHasBlurRadius, bApplyAlphaToBlur, bSaveAsset]()
+			RunAfterPreloadingAssets(
+				{AssetTargets.AssetPath},
+				[this, CompletionCallback, CapturedRequestId, AssetTargets, WidgetName, BlurStrength, BlurRadius, bHasBlurRadius, bApplyAlphaToBlur, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -1021,13 +1327,20 @@ namespace
 				}
 				ResponseObject->SetObjectField(
 					TEXT("result"),
-					BuildSetWidgetBackgroundBlurObject(
-						AssetPath,
-						WidgetName,
-						BlurStrength,
-						bHasBlurRadius ? TOptional<int32>(BlurRadius) : TOptional<int32>(),
-						bApplyAlphaToBlur,
-						bSaveAsset));
+					BuildFanOutObject(
+						AssetTargets,
+						bSaveAsset,
+						bDeferSave,
+						[&](const FString& AssetPath, const bool bSaveEachAsset)
+						{
+							return BuildSetWidgetBackgroundBlurObject(
+								AssetPath,
+								WidgetName,
+								BlurStrength,
+								bHasBlurRadius ? TOptional<int32>(BlurRadius) : TOptional<int32>(),
+								bApplyAlphaToBlur,
+								bSaveEachAsset);
+						}));
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -1047,8 +1360,8 @@ namespace
 				return true;
 			}
 
-			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			FOctoMCPAssetTargets AssetTargets;
+			if (!TryGetAssetTargetsArgument(ArgumentsObject, AssetTargets, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1091,9 +1404,20 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(ENamedThreads::GameThread, [this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, Radius, bSaveAsset]()
+			RunAfterPreloadingAssets({AssetTargets.AssetPath}, [this, CompletionCallback, CapturedRequestId, AssetTargets, WidgetName, Radius, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -1103,7 +1427,14 @@ namespace
 				}
 				ResponseObject->SetObjectField(
 					TEXT("result"),
-					BuildSetWidgetCornerRadiusObject(AssetPath, WidgetName, Radius, bSaveAsset));
+					BuildFanOutObject(
+						AssetTargets,
+						bSaveAsset,
+						bDeferSave,
+						[&](const FString& AssetPath, const bool bSaveEachAsset)
+						{
+							return BuildSetWidgetCornerRadiusObject(AssetPath, WidgetName, Radius, bSaveEachAsset);
+						}));
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -1124,7 +1455,7 @@ namespace
 			}
 
 			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1145,38 +1476,19 @@ namespace
 				return true;
 			}
 
-			bool bSaveAsset = true;
-			if (!TryGetOptionalBoolArgument(ArgumentsObject, TEXT("saveAsset"), bSaveAsset, BodyError))
+			ScaffoldType = ScaffoldType.TrimStartAndEnd().ToLower();
+			if (!IsScaffoldType(ScaffoldType))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
 					TEXT("invalid_arguments"),
-					BodyError,
+					FString::Printf(TEXT("Unsupported scaffoldType: %s"), *ScaffoldType),
 					RequestId));
 				return true;
 			}
 
-			const FHttpResultCallback CompletionCallback = OnComplete;
-			const FString CapturedRequestId = RequestId;
-			AsyncTask(ENamedThreads::GameThread, [this, CompletionCallback, CapturedRequestId, AssetPath, ScaffoldType, bSaveAsset]()
-			{
-				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
-				ResponseObject->SetBoolField(TEXT("ok"), true);
-				if (!CapturedRequestId.IsEmpty())
-				{
-					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
-				}
-				ResponseObject->SetObjectField(TEXT("result"), BuildScaffoldWidgetBlueprintObject(AssetPath, ScaffoldType, bSaveAsset));
-
-				CompletionCallback(CreateJsonResponse(ResponseObject));
-			});
-			return true;
-		}
-
-		if (Command == OctoMCP::CommandReorderWidgetChild)
-		{
-			TSharedPtr<FJsonObject> ArgumentsObject;
-			if (!TryGetArgumentsObject(RequestObject.ToSharedRef(), ArgumentsObject, BodyError))
+			bool bUseTemplate = false;
+			if (!TryGetOptionalBoolArgument(ArgumentsObject, TEXT("useTemplate"), bUseTemplate, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1186,8 +1498,8 @@ namespace
 				return true;
 			}
 
-			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			FString ParentClassPath;
+			if (!TryGetOptionalStringArgument(ArgumentsObject, TEXT("parentClassPath"), ParentClassPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1197,8 +1509,8 @@ namespace
 				return true;
 			}
 
-			FString WidgetName;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("widgetName"), WidgetName, BodyError))
+			FString InvalidationBoundary;
+			if (!TryGetOptionalStringArgument(ArgumentsObject, TEXT("invalidationBoundary"), InvalidationBoundary, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1208,13 +1520,13 @@ namespace
 				return true;
 			}
 
-			int32 DesiredIndex = INDEX_NONE;
-			if (!TryGetRequiredIntArgument(ArgumentsObject, TEXT("desiredIndex"), DesiredIndex, BodyError))
+			InvalidationBoundary = InvalidationBoundary.TrimStartAndEnd().ToLower();
+			if (!InvalidationBoundary.IsEmpty() && !IsInvalidationBoundaryType(InvalidationBoundary))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
 					TEXT("invalid_arguments"),
-					BodyError,
+					FString::Printf(TEXT("Unsupported invalidationBoundary: %s"), *InvalidationBoundary),
 					RequestId));
 				return true;
 			}
@@ -1230,11 +1542,112 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(
-				ENamedThreads::GameThread,
-				[this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, DesiredIndex, bSaveAsset]()
+			RunAfterPreloadingAssets({AssetPath}, [this, CompletionCallback, CapturedRequestId, AssetPath, ScaffoldType, bUseTemplate, ParentClassPath, InvalidationBoundary, bSaveAsset, bDeferSave]()
+			{
+				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+				ResponseObject->SetBoolField(TEXT("ok"), true);
+				if (!CapturedRequestId.IsEmpty())
+				{
+					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
+				}
+				ResponseObject->SetObjectField(TEXT("result"), BuildScaffoldWidgetBlueprintObject(AssetPath, ScaffoldType, bUseTemplate, ParentClassPath, InvalidationBoundary, bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
+
+				CompletionCallback(CreateJsonResponse(ResponseObject));
+			});
+			return true;
+		}
+
+		if (Command == OctoMCP::CommandReorderWidgetChild)
+		{
+			TSharedPtr<FJsonObject> ArgumentsObject;
+			if (!TryGetArgumentsObject(RequestObject.ToSharedRef(), ArgumentsObject, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString AssetPath;
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString WidgetName;
+			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("widgetName"), WidgetName, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			int32 DesiredIndex = INDEX_NONE;
+			if (!TryGetRequiredIntArgument(ArgumentsObject, TEXT("desiredIndex"), DesiredIndex, BodyError) || DesiredIndex < 0)
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError.IsEmpty() ? TEXT("desiredIndex must be zero or greater.") : BodyError,
+					RequestId));
+				return true;
+			}
+
+			bool bSaveAsset = true;
+			if (!TryGetOptionalBoolArgument(ArgumentsObject, TEXT("saveAsset"), bSaveAsset, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			const FHttpResultCallback CompletionCallback = OnComplete;
+			const FString CapturedRequestId = RequestId;
+			RunAfterPreloadingAssets(
+				{AssetPath},
+				[this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, DesiredIndex, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -1244,7 +1657,12 @@ namespace
 				}
 				ResponseObject->SetObjectField(
 					TEXT("result"),
-					BuildReorderWidgetChildObject(AssetPath, WidgetName, DesiredIndex, bSaveAsset));
+					BuildReorderWidgetChildObject(AssetPath, WidgetName, DesiredIndex, bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -1265,7 +1683,7 @@ namespace
 			}
 
 			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1297,9 +1715,20 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(ENamedThreads::GameThread, [this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, bSaveAsset]()
+			RunAfterPreloadingAssets({AssetPath}, [this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -1309,14 +1738,19 @@ namespace
 				}
 				ResponseObject->SetObjectField(
 					TEXT("result"),
-					BuildRemoveWidgetObject(AssetPath, WidgetName, bSaveAsset));
+					BuildRemoveWidgetObject(AssetPath, WidgetName, bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
 			return true;
 		}
 
-		if (Command == OctoMCP::CommandSetWidgetPanelColor)
+		if (Command == OctoMCP::CommandSetWidgetInvalidationBoundary)
 		{
 			TSharedPtr<FJsonObject> ArgumentsObject;
 			if (!TryGetArgumentsObject(RequestObject.ToSharedRef(), ArgumentsObject, BodyError))
@@ -1330,7 +1764,110 @@ namespace
 			}
 
 			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString WidgetName;
+			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("widgetName"), WidgetName, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString Boundary;
+			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("boundary"), Boundary, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			Boundary = Boundary.TrimStartAndEnd().ToLower();
+			if (!IsInvalidationBoundaryType(Boundary))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					FString::Printf(TEXT("Unsupported boundary: %s"), *Boundary),
+					RequestId));
+				return true;
+			}
+
+			bool bSaveAsset = true;
+			if (!TryGetOptionalBoolArgument(ArgumentsObject, TEXT("saveAsset"), bSaveAsset, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			const FHttpResultCallback CompletionCallback = OnComplete;
+			const FString CapturedRequestId = RequestId;
+			RunAfterPreloadingAssets({AssetPath}, [this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, Boundary, bSaveAsset, bDeferSave]()
+			{
+				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+				ResponseObject->SetBoolField(TEXT("ok"), true);
+				if (!CapturedRequestId.IsEmpty())
+				{
+					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
+				}
+				ResponseObject->SetObjectField(
+					TEXT("result"),
+					BuildSetWidgetInvalidationBoundaryObject(AssetPath, WidgetName, Boundary, bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
+
+				CompletionCallback(CreateJsonResponse(ResponseObject));
+			});
+			return true;
+		}
+
+		if (Command == OctoMCP::CommandSetWidgetPanelColor)
+		{
+			TSharedPtr<FJsonObject> ArgumentsObject;
+			if (!TryGetArgumentsObject(RequestObject.ToSharedRef(), ArgumentsObject, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FOctoMCPAssetTargets AssetTargets;
+			if (!TryGetAssetTargetsArgument(ArgumentsObject, AssetTargets, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1406,11 +1943,22 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(
-				ENamedThreads::GameThread,
-				[this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, Red, Green, Blue, Alpha, bSaveAsset]()
+			RunAfterPreloadingAssets(
+				{AssetTargets.AssetPath},
+				[this, CompletionCallback, CapturedRequestId, AssetTargets, WidgetName, Red, Green, Blue, Alpha, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -1420,7 +1968,14 @@ namespace
 				}
 				ResponseObject->SetObjectField(
 					TEXT("result"),
-					BuildSetWidgetPanelColorObject(AssetPath, WidgetName, Red, Green, Blue, Alpha, bSaveAsset));
+					BuildFanOutObject(
+						AssetTargets,
+						bSaveAsset,
+						bDeferSave,
+						[&](const FString& AssetPath, const bool bSaveEachAsset)
+						{
+							return BuildSetWidgetPanelColorObject(AssetPath, WidgetName, Red, Green, Blue, Alpha, bSaveEachAsset);
+						}));
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -1440,8 +1995,8 @@ namespace
 				return true;
 			}
 
-			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			FOctoMCPAssetTargets AssetTargets;
+			if (!TryGetAssetTargetsArgument(ArgumentsObject, AssetTargets, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1484,11 +2039,22 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(
-				ENamedThreads::GameThread,
-				[this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, HeightOverride, bSaveAsset]()
+			RunAfterPreloadingAssets(
+				{AssetTargets.AssetPath},
+				[this, CompletionCallback, CapturedRequestId, AssetTargets, WidgetName, HeightOverride, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -1498,7 +2064,14 @@ namespace
 				}
 				ResponseObject->SetObjectField(
 					TEXT("result"),
-					BuildSetSizeBoxHeightOverrideObject(AssetPath, WidgetName, HeightOverride, bSaveAsset));
+					BuildFanOutObject(
+						AssetTargets,
+						bSaveAsset,
+						bDeferSave,
+						[&](const FString& AssetPath, const bool bSaveEachAsset)
+						{
+							return BuildSetSizeBoxHeightOverrideObject(AssetPath, WidgetName, HeightOverride, bSaveEachAsset);
+						}));
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -1518,8 +2091,8 @@ namespace
 				return true;
 			}
 
-			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			FOctoMCPAssetTargets AssetTargets;
+			if (!TryGetAssetTargetsArgument(ArgumentsObject, AssetTargets, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1631,11 +2204,22 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(
-				ENamedThreads::GameThread,
-				[this, CompletionCallback, CapturedRequestId, AssetPath, bEnabled, WidgetName, Duration, StartScale, OscillationCount, PivotX, PivotY, bSaveAsset]()
+			RunAfterPreloadingAssets(
+				{AssetTargets.AssetPath},
+				[this, CompletionCallback, CapturedRequestId, AssetTargets, bEnabled, WidgetName, Duration, StartScale, OscillationCount, PivotX, PivotY, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -1645,16 +2229,23 @@ namespace
 				}
 				ResponseObject->SetObjectField(
 					TEXT("result"),
-					BuildSetPopupOpenElasticScaleObject(
-						AssetPath,
-						bEnabled,
-						WidgetName,
-						Duration,
-						StartScale,
-						OscillationCount,
-						PivotX,
-						PivotY,
-						bSaveAsset));
+					BuildFanOutObject(
+						AssetTargets,
+						bSaveAsset,
+						bDeferSave,
+						[&](const FString& AssetPath, const bool bSaveEachAsset)
+						{
+							return BuildSetPopupOpenElasticScaleObject(
+								AssetPath,
+								bEnabled,
+								WidgetName,
+								Duration,
+								StartScale,
+								OscillationCount,
+								PivotX,
+								PivotY,
+								bSaveEachAsset);
+						}));
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -1674,8 +2265,8 @@ namespace
 				return true;
 			}
 
-			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			FOctoMCPAssetTargets AssetTargets;
+			if (!TryGetAssetTargetsArgument(ArgumentsObject, AssetTargets, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1697,7 +2288,7 @@ namespace
 			}
 
 			FString TextureAssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("textureAssetPath"), TextureAssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("textureAssetPath"), TextureAssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1729,11 +2320,22 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(
-				ENamedThreads::GameThread,
-				[this, CompletionCallback, CapturedRequestId, AssetPath, WidgetName, TextureAssetPath, bMatchTextureSize, bSaveAsset]()
+			RunAfterPreloadingAssets(
+				{AssetTargets.AssetPath, TextureAssetPath},
+				[this, CompletionCallback, CapturedRequestId, AssetTargets, WidgetName, TextureAssetPath, bMatchTextureSize, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -1743,7 +2345,14 @@ namespace
 				}
 				ResponseObject->SetObjectField(
 					TEXT("result"),
-					BuildSetWidgetImageTextureObject(AssetPath, WidgetName, TextureAssetPath, bMatchTextureSize, bSaveAsset));
+					BuildFanOutObject(
+						AssetTargets,
+						bSaveAsset,
+						bDeferSave,
+						[&](const FString& AssetPath, const bool bSaveEachAsset)
+						{
+							return BuildSetWidgetImageTextureObject(AssetPath, WidgetName, TextureAssetPath, bMatchTextureSize, bSaveEachAsset);
+						}));
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -1764,7 +2373,7 @@ namespace
 			}
 
 			FString AssetPath;
-			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
 			{
 				OnComplete(CreateErrorResponse(
 					EHttpServerResponseCodes::BadRequest,
@@ -1807,9 +2416,20 @@ namespace
 				return true;
 			}
 
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(ENamedThreads::GameThread, [this, CompletionCallback, CapturedRequestId, AssetPath, PropertyName, ValueClassPath, bSaveAsset]()
+			RunAfterPreloadingAssets({AssetPath, ValueClassPath}, [this, CompletionCallback, CapturedRequestId, AssetPath, PropertyName, ValueClassPath, bSaveAsset, bDeferSave]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -1819,7 +2439,12 @@ namespace
 				}
 				ResponseObject->SetObjectField(
 					TEXT("result"),
-					BuildSetBlueprintClassPropertyObject(AssetPath, PropertyName, ValueClassPath, bSaveAsset));
+					BuildSetBlueprintClassPropertyObject(AssetPath, PropertyName, ValueClassPath, bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
 
 				CompletionCallback(CreateJsonResponse(ResponseObject));
 			});
@@ -1863,7 +2488,7 @@ namespace
 
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(ENamedThreads::GameThread, [this, CompletionCallback, CapturedRequestId, GameModeClassPath, bSaveConfig]()
+			RunAfterPreloadingAssets({}, [this, CompletionCallback, CapturedRequestId, GameModeClassPath, bSaveConfig]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -1928,7 +2553,7 @@ namespace
 
 			const FHttpResultCallback CompletionCallback = OnComplete;
 			const FString CapturedRequestId = RequestId;
-			AsyncTask(ENamedThreads::GameThread, [this, CompletionCallback, CapturedRequestId, LevelFileName, DirectoryPath, bForceCreate]()
+			RunAfterPreloadingAssets({}, [this, CompletionCallback, CapturedRequestId, LevelFileName, DirectoryPath, bForceCreate]()
 			{
 				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
 				ResponseObject->SetBoolField(TEXT("ok"), true);
@@ -1945,6 +2570,668 @@ namespace
 			return true;
 		}
 
+		if (Command == OctoMCP::CommandApplyTextureProfile)
+		{
+			TSharedPtr<FJsonObject> ArgumentsObject;
+			if (!TryGetArgumentsObject(RequestObject.ToSharedRef(), ArgumentsObject, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString PathPrefix;
+			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("pathPrefix"), PathPrefix, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString ImportProfile;
+			if (!TryGetRequiredStringArgument(ArgumentsObject, TEXT("importProfile"), ImportProfile, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FOctoMCPTextureImportProfile ResolvedImportProfile;
+			if (!ResolveTextureImportProfile(ImportProfile, ResolvedImportProfile, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			bool bSaveAsset = true;
+			if (!TryGetOptionalBoolArgument(ArgumentsObject, TEXT("saveAsset"), bSaveAsset, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			const FHttpResultCallback CompletionCallback = OnComplete;
+			const FString CapturedRequestId = RequestId;
+			RunAfterPreloadingAssets({}, [this, CompletionCallback, CapturedRequestId, PathPrefix, ImportProfile, bSaveAsset, bDeferSave]()
+			{
+				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+				ResponseObject->SetBoolField(TEXT("ok"), true);
+				if (!CapturedRequestId.IsEmpty())
+				{
+					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
+				}
+				ResponseObject->SetObjectField(
+					TEXT("result"),
+					BuildApplyTextureProfileObject(PathPrefix, ImportProfile, bSaveAsset, bDeferSave));
+
+				CompletionCallback(CreateJsonResponse(ResponseObject));
+			});
+			return true;
+		}
+
+		if (Command == OctoMCP::CommandPackIconAtlas)
+		{
+			TSharedPtr<FJsonObject> ArgumentsObject;
+			if (!TryGetArgumentsObject(RequestObject.ToSharedRef(), ArgumentsObject, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString AtlasAssetPath;
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("atlasAssetPath"), AtlasAssetPath, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			TArray<FString> TextureAssetPaths;
+			if (!TryGetOptionalStringArrayArgument(ArgumentsObject, TEXT("textureAssetPaths"), TextureAssetPaths, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString PathPrefix;
+			if (!TryGetOptionalStringArgument(ArgumentsObject, TEXT("pathPrefix"), PathPrefix, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			if (TextureAssetPaths.IsEmpty() && PathPrefix.IsEmpty())
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					TEXT("Provide textureAssetPaths and/or pathPrefix."),
+					RequestId));
+				return true;
+			}
+
+			FString EntryWidgetAssetPath;
+			if (!TryGetOptionalAssetPathArgument(ArgumentsObject, TEXT("entryWidgetAssetPath"), EntryWidgetAssetPath, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			int32 PageSize = OctoMCP::DefaultIconAtlasPageSize;
+			bool bHasPageSize = false;
+			if (!TryGetOptionalIntArgument(ArgumentsObject, TEXT("pageSize"), PageSize, bHasPageSize, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			int32 Padding = OctoMCP::DefaultIconAtlasPadding;
+			bool bHasPadding = false;
+			if (!TryGetOptionalIntArgument(ArgumentsObject, TEXT("padding"), Padding, bHasPadding, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			bool bSaveAsset = true;
+			if (!TryGetOptionalBoolArgument(ArgumentsObject, TEXT("saveAsset"), bSaveAsset, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			TArray<FString> PreloadAssetPaths = TextureAssetPaths;
+			PreloadAssetPaths.Add(EntryWidgetAssetPath);
+
+			const FHttpResultCallback CompletionCallback = OnComplete;
+			const FString CapturedRequestId = RequestId;
+			RunAfterPreloadingAssets(
+				PreloadAssetPaths,
+				[this, CompletionCallback, CapturedRequestId, AtlasAssetPath, TextureAssetPaths, PathPrefix, EntryWidgetAssetPath, PageSize, Padding, bSaveAsset, bDeferSave]()
+			{
+				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+				ResponseObject->SetBoolField(TEXT("ok"), true);
+				if (!CapturedRequestId.IsEmpty())
+				{
+					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
+				}
+				ResponseObject->SetObjectField(
+					TEXT("result"),
+					BuildPackIconAtlasObject(
+						AtlasAssetPath,
+						TextureAssetPaths,
+						PathPrefix,
+						EntryWidgetAssetPath,
+						PageSize,
+						Padding,
+						bSaveAsset,
+						bDeferSave));
+
+				CompletionCallback(CreateJsonResponse(ResponseObject));
+			});
+			return true;
+		}
+
+		if (Command == OctoMCP::CommandApplyWidgetTree)
+		{
+			TSharedPtr<FJsonObject> ArgumentsObject;
+			if (!TryGetArgumentsObject(RequestObject.ToSharedRef(), ArgumentsObject, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString AssetPath;
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			TSharedPtr<FJsonObject> TreeObject;
+			if (!TryGetRequiredObjectArgument(ArgumentsObject, TEXT("tree"), TreeObject, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			bool bSaveAsset = true;
+			if (!TryGetOptionalBoolArgument(ArgumentsObject, TEXT("saveAsset"), bSaveAsset, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			const FHttpResultCallback CompletionCallback = OnComplete;
+			const FString CapturedRequestId = RequestId;
+			RunAfterPreloadingAssets({AssetPath}, [this, CompletionCallback, CapturedRequestId, AssetPath, TreeObject, bSaveAsset, bDeferSave]()
+			{
+				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+				ResponseObject->SetBoolField(TEXT("ok"), true);
+				if (!CapturedRequestId.IsEmpty())
+				{
+					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
+				}
+				ResponseObject->SetObjectField(
+					TEXT("result"),
+					BuildApplyWidgetTreeObject(AssetPath, TreeObject, bSaveAsset && !bDeferSave));
+
+				if (bSaveAsset && bDeferSave)
+				{
+					QueueDeferredSave(ResponseObject->GetObjectField(TEXT("result")));
+				}
+
+				CompletionCallback(CreateJsonResponse(ResponseObject));
+			});
+			return true;
+		}
+
+		if (Command == OctoMCP::CommandGetWidgetTree)
+		{
+			TSharedPtr<FJsonObject> ArgumentsObject;
+			if (!TryGetArgumentsObject(RequestObject.ToSharedRef(), ArgumentsObject, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString AssetPath;
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString LastHash;
+			if (!TryGetOptionalStringArgument(ArgumentsObject, TEXT("lastHash"), LastHash, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			bool bIncludeProperties = true;
+			if (!TryGetOptionalBoolArgument(ArgumentsObject, TEXT("includeProperties"), bIncludeProperties, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			const FHttpResultCallback CompletionCallback = OnComplete;
+			const FString CapturedRequestId = RequestId;
+			RunAfterPreloadingAssets({AssetPath}, [this, CompletionCallback, CapturedRequestId, AssetPath, LastHash, bIncludeProperties]()
+			{
+				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+				ResponseObject->SetBoolField(TEXT("ok"), true);
+				if (!CapturedRequestId.IsEmpty())
+				{
+					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
+				}
+				ResponseObject->SetObjectField(
+					TEXT("result"),
+					BuildGetWidgetTreeObject(AssetPath, LastHash, bIncludeProperties));
+
+				CompletionCallback(CreateJsonResponse(ResponseObject));
+			});
+			return true;
+		}
+
+		if (Command == OctoMCP::CommandSetWidgetProperties)
+		{
+			TSharedPtr<FJsonObject> ArgumentsObject;
+			if (!TryGetArgumentsObject(RequestObject.ToSharedRef(), ArgumentsObject, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FOctoMCPAssetTargets AssetTargets;
+			if (!TryGetAssetTargetsArgument(ArgumentsObject, AssetTargets, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			TArray<TSharedPtr<FJsonObject>> EntryObjects;
+			if (!TryGetRequiredObjectArrayArgument(ArgumentsObject, TEXT("entries"), EntryObjects, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			bool bSaveAsset = true;
+			if (!TryGetOptionalBoolArgument(ArgumentsObject, TEXT("saveAsset"), bSaveAsset, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			bool bDeferSave = false;
+			if (!TryGetOptionalSaveModeArgument(ArgumentsObject, bDeferSave, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			const FHttpResultCallback CompletionCallback = OnComplete;
+			const FString CapturedRequestId = RequestId;
+			RunAfterPreloadingAssets({AssetTargets.AssetPath}, [this, CompletionCallback, CapturedRequestId, AssetTargets, EntryObjects, bSaveAsset, bDeferSave]()
+			{
+				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+				ResponseObject->SetBoolField(TEXT("ok"), true);
+				if (!CapturedRequestId.IsEmpty())
+				{
+					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
+				}
+				ResponseObject->SetObjectField(
+					TEXT("result"),
+					BuildFanOutObject(
+						AssetTargets,
+						bSaveAsset,
+						bDeferSave,
+						[&](const FString& AssetPath, const bool bSaveEachAsset)
+						{
+							return BuildSetWidgetPropertiesObject(AssetPath, EntryObjects, bSaveEachAsset);
+						}));
+
+				CompletionCallback(CreateJsonResponse(ResponseObject));
+			});
+			return true;
+		}
+
+		if (Command == OctoMCP::CommandQueryAssets)
+		{
+			TSharedPtr<FJsonObject> ArgumentsObject;
+			if (!TryGetArgumentsObject(RequestObject.ToSharedRef(), ArgumentsObject, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString ClassPath;
+			if (!TryGetOptionalStringArgument(ArgumentsObject, TEXT("classPath"), ClassPath, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString PathPrefix;
+			if (!TryGetOptionalStringArgument(ArgumentsObject, TEXT("pathPrefix"), PathPrefix, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString NameContains;
+			if (!TryGetOptionalStringArgument(ArgumentsObject, TEXT("nameContains"), NameContains, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			TArray<TPair<FName, FString>> TagFilters;
+			if (!TryGetOptionalStringMapArgument(ArgumentsObject, TEXT("tags"), TagFilters, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			int32 Offset = 0;
+			bool bHasOffset = false;
+			if (!TryGetOptionalIntArgument(ArgumentsObject, TEXT("offset"), Offset, bHasOffset, BodyError) || Offset < 0)
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError.IsEmpty() ? TEXT("offset must be zero or greater.") : BodyError,
+					RequestId));
+				return true;
+			}
+
+			int32 Limit = OctoMCP::DefaultQueryAssetsLimit;
+			bool bHasLimit = false;
+			if (!TryGetOptionalIntArgument(ArgumentsObject, TEXT("limit"), Limit, bHasLimit, BodyError)
+				|| Limit < 1
+				|| Limit > OctoMCP::MaxQueryAssetsLimit)
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError.IsEmpty()
+						? FString::Printf(TEXT("limit must be between 1 and %d."), OctoMCP::MaxQueryAssetsLimit)
+						: BodyError,
+					RequestId));
+				return true;
+			}
+
+			// The index is lock-guarded and never loads anything, so answer without a game-thread hop.
+			TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+			ResponseObject->SetBoolField(TEXT("ok"), true);
+			if (!RequestId.IsEmpty())
+			{
+				ResponseObject->SetStringField(TEXT("requestId"), RequestId);
+			}
+			ResponseObject->SetObjectField(
+				TEXT("result"),
+				BuildQueryAssetsObject(ClassPath, PathPrefix, NameContains, TagFilters, Offset, Limit));
+
+			OnComplete(CreateJsonResponse(ResponseObject));
+			return true;
+		}
+
+		if (Command == OctoMCP::CommandFlushSaves)
+		{
+			const FHttpResultCallback CompletionCallback = OnComplete;
+			const FString CapturedRequestId = RequestId;
+			RunAfterPreloadingAssets({}, [this, CompletionCallback, CapturedRequestId]()
+			{
+				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+				ResponseObject->SetBoolField(TEXT("ok"), true);
+				if (!CapturedRequestId.IsEmpty())
+				{
+					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
+				}
+				ResponseObject->SetObjectField(TEXT("result"), BuildFlushSavesObject());
+
+				CompletionCallback(CreateJsonResponse(ResponseObject));
+			});
+			return true;
+		}
+
+		if (Command == OctoMCP::CommandGetSaveQueueStatus)
+		{
+			const FHttpResultCallback CompletionCallback = OnComplete;
+			const FString CapturedRequestId = RequestId;
+			RunAfterPreloadingAssets({}, [this, CompletionCallback, CapturedRequestId]()
+			{
+				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+				ResponseObject->SetBoolField(TEXT("ok"), true);
+				if (!CapturedRequestId.IsEmpty())
+				{
+					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
+				}
+				ResponseObject->SetObjectField(TEXT("result"), BuildSaveQueueStatusObject());
+
+				CompletionCallback(CreateJsonResponse(ResponseObject));
+			});
+			return true;
+		}
+
+		if (Command == OctoMCP::CommandGetWorkingSet)
+		{
+			const FHttpResultCallback CompletionCallback = OnComplete;
+			const FString CapturedRequestId = RequestId;
+			RunAfterPreloadingAssets({}, [this, CompletionCallback, CapturedRequestId]()
+			{
+				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+				ResponseObject->SetBoolField(TEXT("ok"), true);
+				if (!CapturedRequestId.IsEmpty())
+				{
+					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
+				}
+				ResponseObject->SetObjectField(TEXT("result"), BuildGetWorkingSetObject());
+
+				CompletionCallback(CreateJsonResponse(ResponseObject));
+			});
+			return true;
+		}
+
+		if (Command == OctoMCP::CommandPinWorkingSetAsset || Command == OctoMCP::CommandUnpinWorkingSetAsset)
+		{
+			TSharedPtr<FJsonObject> ArgumentsObject;
+			if (!TryGetArgumentsObject(RequestObject.ToSharedRef(), ArgumentsObject, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			FString AssetPath;
+			if (!TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), AssetPath, BodyError))
+			{
+				OnComplete(CreateErrorResponse(
+					EHttpServerResponseCodes::BadRequest,
+					TEXT("invalid_arguments"),
+					BodyError,
+					RequestId));
+				return true;
+			}
+
+			const bool bPinned = Command == OctoMCP::CommandPinWorkingSetAsset;
+			const FHttpResultCallback CompletionCallback = OnComplete;
+			const FString CapturedRequestId = RequestId;
+			RunAfterPreloadingAssets(
+				bPinned ? TArray<FString>{AssetPath} : TArray<FString>(),
+				[this, CompletionCallback, CapturedRequestId, AssetPath, bPinned]()
+			{
+				TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
+				ResponseObject->SetBoolField(TEXT("ok"), true);
+				if (!CapturedRequestId.IsEmpty())
+				{
+					ResponseObject->SetStringField(TEXT("requestId"), CapturedRequestId);
+				}
+				ResponseObject->SetObjectField(TEXT("result"), BuildPinWorkingSetAssetObject(AssetPath, bPinned));
+
+				CompletionCallback(CreateJsonResponse(ResponseObject));
+			});
+			return true;
+		}
+
 		OnComplete(CreateErrorResponse(
 			EHttpServerResponseCodes::BadRequest,
 			TEXT("unknown_command"),
@@ -114,6 +114,214 @@
 		return true;
 	}
 
+	bool FOctoMCPModule::TryGetOptionalSaveModeArgument(
+		const TSharedPtr<FJsonObject>& ArgumentsObject,
+		bool& bOutDeferSave,
+		FString& OutError) const
+	{
+		bOutDeferSave = false;
+
+		FString SaveMode = OctoMCP::SaveModeImmediate;
+		if (!TryGetOptionalStringArgument(ArgumentsObject, TEXT("saveMode"), SaveMode, OutError))
+		{
+			return false;
+		}
+
+		if (SaveMode.Equals(OctoMCP::SaveModeDeferred, ESearchCase::IgnoreCase))
+		{
+			bOutDeferSave = true;
+			return true;
+		}
+
+		if (!SaveMode.Equals(OctoMCP::SaveModeImmediate, ESearchCase::IgnoreCase))
+		{
+			OutError = FString::Printf(
+				TEXT("Unsupported saveMode %s. Expected immediate or deferred."),
+				*SaveMode);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool FOctoMCPModule::TryGetOptionalStringMapArgument(
+		const TSharedPtr<FJsonObject>& ArgumentsObject,
+		const FString& FieldName,
+		TArray<TPair<FName, FString>>& OutValues,
+		FString& OutError) const
+	{
+		OutValues.Reset();
+		if (!ArgumentsObject.IsValid() || !ArgumentsObject->HasField(FieldName))
+		{
+			return true;
+		}
+
+		const TSharedPtr<FJsonObject>* MapObject = nullptr;
+		if (!ArgumentsObject->TryGetObjectField(FieldName, MapObject) || MapObject == nullptr || !MapObject->IsValid())
+		{
+			OutError = FString::Printf(TEXT("%s must be an object when provided."), *FieldName);
+			return false;
+		}
+
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*MapObject)->Values)
+		{
+			FString Value;
+			if (!Entry.Value.IsValid() || !Entry.Value->TryGetString(Value))
+			{
+				OutError = FString::Printf(TEXT("%s.%s must be a string."), *FieldName, *Entry.Key);
+				return false;
+			}
+
+			OutValues.Emplace(FName(*Entry.Key), Value.TrimStartAndEnd());
+		}
+
+		return true;
+	}
+
+	bool FOctoMCPModule::TryGetOptionalStringArrayArgument(
+		const TSharedPtr<FJsonObject>& ArgumentsObject,
+		const FString& FieldName,
+		TArray<FString>& OutValues,
+		FString& OutError) const
+	{
+		OutValues.Reset();
+		if (!ArgumentsObject.IsValid() || !ArgumentsObject->HasField(FieldName))
+		{
+			return true;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* ArrayValues = nullptr;
+		if (!ArgumentsObject->TryGetArrayField(FieldName, ArrayValues) || ArrayValues == nullptr)
+		{
+			OutError = FString::Printf(TEXT("%s must be an array of strings when provided."), *FieldName);
+			return false;
+		}
+
+		OutValues.Reserve(ArrayValues->Num());
+		for (int32 ValueIndex = 0; ValueIndex < ArrayValues->Num(); ++ValueIndex)
+		{
+			FString Value;
+			const TSharedPtr<FJsonValue>& ArrayValue = (*ArrayValues)[ValueIndex];
+			if (!ArrayValue.IsValid() || !ArrayValue->TryGetString(Value) || Value.TrimStartAndEnd().IsEmpty())
+			{
+				OutError = FString::Printf(TEXT("%s[%d] must be a non-empty string."), *FieldName, ValueIndex);
+				return false;
+			}
+
+			OutValues.Add(Value.TrimStartAndEnd());
+		}
+
+		return true;
+	}
+
+	bool FOctoMCPModule::TryGetRequiredObjectArgument(
+		const TSharedPtr<FJsonObject>& ArgumentsObject,
+		const FString& FieldName,
+		TSharedPtr<FJsonObject>& OutValue,
+		FString& OutError) const
+	{
+		if (!ArgumentsObject.IsValid() || !ArgumentsObject->HasField(FieldName))
+		{
+			OutError = FString::Printf(TEXT("%s is required."), *FieldName);
+			return false;
+		}
+
+		const TSharedPtr<FJsonObject>* ObjectValue = nullptr;
+		if (!ArgumentsObject->TryGetObjectField(FieldName, ObjectValue) || ObjectValue == nullptr || !ObjectValue->IsValid())
+		{
+			OutError = FString::Printf(TEXT("%s must be an object."), *FieldName);
+			return false;
+		}
+
+		OutValue = *ObjectValue;
+		return true;
+	}
+
+	bool FOctoMCPModule::TryGetAssetTargetsArgument(
+		const TSharedPtr<FJsonObject>& ArgumentsObject,
+		FOctoMCPAssetTargets& OutTargets,
+		FString& OutError) const
+	{
+		OutTargets = FOctoMCPAssetTargets();
+		if (!ArgumentsObject.IsValid() || !ArgumentsObject->HasField(TEXT("assetQuery")))
+		{
+			return TryGetRequiredAssetPathArgument(ArgumentsObject, TEXT("assetPath"), OutTargets.AssetPath, OutError);
+		}
+
+		if (ArgumentsObject->HasField(TEXT("assetPath")))
+		{
+			OutError = TEXT("Provide either assetPath or assetQuery, not both.");
+			return false;
+		}
+
+		TSharedPtr<FJsonObject> QueryObject;
+		if (!TryGetRequiredObjectArgument(ArgumentsObject, TEXT("assetQuery"), QueryObject, OutError))
+		{
+			return false;
+		}
+
+		if (!TryGetOptionalStringArgument(QueryObject, TEXT("pathPrefix"), OutTargets.PathPrefix, OutError)
+			|| !TryGetOptionalStringArgument(QueryObject, TEXT("classPath"), OutTargets.ClassPath, OutError)
+			|| !TryGetOptionalStringArgument(QueryObject, TEXT("namePattern"), OutTargets.NamePattern, OutError)
+			|| !TryGetOptionalStringArgument(QueryObject, TEXT("parentClass"), OutTargets.ParentClass, OutError))
+		{
+			OutError = FString::Printf(TEXT("assetQuery.%s"), *OutError);
+			return false;
+		}
+
+		// A bare class filter would touch every Widget Blueprint in the project; require something narrower.
+		if (OutTargets.PathPrefix.IsEmpty() && OutTargets.NamePattern.IsEmpty() && OutTargets.ParentClass.IsEmpty())
+		{
+			OutError = TEXT("assetQuery must include at least one of pathPrefix, namePattern or parentClass.");
+			return false;
+		}
+
+		if (OutTargets.ClassPath.IsEmpty())
+		{
+			OutTargets.ClassPath = OctoMCP::DefaultFanOutAssetClass;
+		}
+
+		OutTargets.bFanOut = true;
+		return true;
+	}
+
+	bool FOctoMCPModule::TryGetRequiredObjectArrayArgument(
+		const TSharedPtr<FJsonObject>& ArgumentsObject,
+		const FString& FieldName,
+		TArray<TSharedPtr<FJsonObject>>& OutValues,
+		FString& OutError) const
+	{
+		OutValues.Reset();
+		if (!ArgumentsObject.IsValid() || !ArgumentsObject->HasField(FieldName))
+		{
+			OutError = FString::Printf(TEXT("%s is required."), *FieldName);
+			return false;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* ArrayValues = nullptr;
+		if (!ArgumentsObject->TryGetArrayField(FieldName, ArrayValues) || ArrayValues == nullptr)
+		{
+			OutError = FString::Printf(TEXT("%s must be an array of objects."), *FieldName);
+			return false;
+		}
+
+		OutValues.Reserve(ArrayValues->Num());
+		for (int32 ValueIndex = 0; ValueIndex < ArrayValues->Num(); ++ValueIndex)
+		{
+			const TSharedPtr<FJsonObject>* ObjectValue = nullptr;
+			const TSharedPtr<FJsonValue>& ArrayValue = (*ArrayValues)[ValueIndex];
+			if (!ArrayValue.IsValid() || !ArrayValue->TryGetObject(ObjectValue) || ObjectValue == nullptr || !ObjectValue->IsValid())
+			{
+				OutError = FString::Printf(TEXT("%s[%d] must be an object."), *FieldName, ValueIndex);
+				return false;
+			}
+
+			OutValues.Add(*ObjectValue);
+		}
+
+		return true;
+	}
+
 	bool FOctoMCPModule::TryGetRequiredIntArgument(
 		const TSharedPtr<FJsonObject>& ArgumentsObject,
 		const FString& FieldName,
@@ -184,6 +392,60 @@
 		return true;
 	}
 
+	bool FOctoMCPModule::TryGetRequiredAssetPathArgument(
+		const TSharedPtr<FJsonObject>& ArgumentsObject,
+		const FString& FieldName,
+		FString& OutAssetObjectPath,
+		FString& OutError) const
+	{
+		FString AssetPath;
+		if (!TryGetRequiredStringArgument(ArgumentsObject, FieldName, AssetPath, OutError))
+		{
+			return false;
+		}
+
+		// Pure FPackageName string checks with no UObject access, so a malformed path is rejected before any
+		// game-thread task is queued. The canonical object path that comes back takes the cheap branch when the
+		// command normalizes it again.
+		FString AssetPackageName;
+		FString PackagePath;
+		FString AssetName;
+		if (!NormalizeWidgetBlueprintAssetPath(
+				AssetPath,
+				AssetPackageName,
+				PackagePath,
+				AssetName,
+				OutAssetObjectPath,
+				OutError))
+		{
+			OutError = FString::Printf(TEXT("%s is not a valid asset path: %s"), *FieldName, *OutError);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool FOctoMCPModule::TryGetOptionalAssetPathArgument(
+		const TSharedPtr<FJsonObject>& ArgumentsObject,
+		const FString& FieldName,
+		FString& OutAssetObjectPath,
+		FString& OutError) const
+	{
+		FString AssetPath;
+		if (!TryGetOptionalStringArgument(ArgumentsObject, FieldName, AssetPath, OutError))
+		{
+			return false;
+		}
+
+		if (AssetPath.TrimStartAndEnd().IsEmpty())
+		{
+			OutAssetObjectPath.Reset();
+			return true;
+		}
+
+		return TryGetRequiredAssetPathArgument(ArgumentsObject, FieldName, OutAssetObjectPath, OutError);
+	}
+
 	bool FOctoMCPModule::TryParseJsonBody(const TArray<uint8>& Body, TSharedPtr<FJsonObject>& OutObject, FString& OutError) const
 	{
 		if (Body.IsEmpty())
@@ -7,12 +7,20 @@ DEFINE_LOG_CATEGORY(LogOctoMCP);
 void FOctoMCPModule::StartupModule()
 {
     CachePluginVersion();
+    StartDeferredSaveQueue();
+    StartAssetIndex();
+    StartWidgetTreeMetadataCache();
+    StartWidgetBlueprintWorkingSet();
     StartHttpBridge();
 }
 
 void FOctoMCPModule::ShutdownModule()
 {
     StopHttpBridge();
+    StopDeferredSaveQueue();
+    StopAssetIndex();
+    StopWidgetTreeMetadataCache();
+    StopWidgetBlueprintWorkingSet();
 }
 
 IMPLEMENT_MODULE(FOctoMCPModule, OctoMCP)
@@ -22,7 +22,9 @@
 #include "Components/HorizontalBox.h"
 #include "Components/HorizontalBoxSlot.h"
 #include "Components/Image.h"
+#include "Components/InvalidationBox.h"
 #include "Components/PanelWidget.h"
+#include "Components/RetainerBox.h"
 #include "Components/ScrollBox.h"
 #include "Components/ScrollBoxSlot.h"
 #include "Components/SizeBox.h"
@@ -35,6 +37,7 @@
 #include "Blueprint/IUserObjectListEntry.h"
 #include "Editor.h"
 #include "Engine/Blueprint.h"
+#include "Engine/DataAsset.h"
 #include "Engine/Texture2D.h"
 #include "Engine/World.h"
 #include "Factories/BlueprintFactory.h"
@@ -42,10 +45,13 @@
 #include "GameMapsSettings.h"
 #include "GameFramework/GameModeBase.h"
 #include "HAL/FileManager.h"
+#include "ImageCore.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "Modules/ModuleManager.h"
 #include "Subsystems/EditorAssetSubsystem.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/StrongObjectPtr.h"
 #include "UObject/UnrealType.h"
 #include "UObject/TopLevelAssetPath.h"
 #include "WidgetBlueprint.h"
@@ -53,6 +59,7 @@
 #include "WidgetBlueprintFactory.h"
 
 #include "Containers/StringConv.h"
+#include "Containers/Ticker.h"
 #include "HttpPath.h"
 #include "HttpRouteHandle.h"
 #include "HttpServerModule.h"
@@ -61,10 +68,12 @@
 #include "IHttpRouter.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/EngineVersion.h"
 #include "Misc/FileHelper.h"
 #include "Misc/PackageName.h"
 #include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
 #include "PluginDescriptor.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
@@ -107,9 +116,55 @@ namespace OctoMCP
 	inline const TCHAR* const CommandSetSizeBoxHeightOverride = TEXT("set_size_box_height_override");
 	inline const TCHAR* const CommandSetPopupOpenElasticScale = TEXT("set_popup_open_elastic_scale");
 	inline const TCHAR* const CommandSetWidgetImageTexture = TEXT("set_widget_image_texture");
+	inline const TCHAR* const CommandFlushSaves = TEXT("flush_saves");
+	inline const TCHAR* const CommandGetSaveQueueStatus = TEXT("get_save_queue_status");
+	inline const TCHAR* const SaveModeImmediate = TEXT("immediate");
+	inline const TCHAR* const SaveModeDeferred = TEXT("deferred");
+	inline constexpr double DeferredSaveQuietPeriodSeconds = 2.0;
+	inline constexpr float DeferredSaveTickIntervalSeconds = 0.25f;
+	inline const TCHAR* const CommandQueryAssets = TEXT("query_assets");
+	inline const TCHAR* const CommandApplyTextureProfile = TEXT("apply_texture_profile");
+	inline constexpr int32 DefaultQueryAssetsLimit = 100;
+	inline constexpr int32 MaxQueryAssetsLimit = 1000;
+	inline const TCHAR* const CommandPackIconAtlas = TEXT("pack_icon_atlas");
+	inline constexpr int32 DefaultIconAtlasPageSize = 1024;
+	inline constexpr int32 MinIconAtlasPageSize = 64;
+	inline constexpr int32 MaxIconAtlasPageSize = 4096;
+	inline constexpr int32 DefaultIconAtlasPadding = 2;
+	inline const TCHAR* const CommandApplyWidgetTree = TEXT("apply_widget_tree");
+	inline const TCHAR* const CommandGetWidgetTree = TEXT("get_widget_tree");
+	inline const TCHAR* const CommandSetWidgetProperties = TEXT("set_widget_properties");
+	inline const TCHAR* const CommandGetWorkingSet = TEXT("get_working_set");
+	inline const TCHAR* const CommandPinWorkingSetAsset = TEXT("pin_working_set_asset");
+	inline const TCHAR* const CommandUnpinWorkingSetAsset = TEXT("unpin_working_set_asset");
+	inline constexpr int32 WorkingSetCapacity = 16;
+	inline constexpr uint64 WorkingSetMinAvailablePhysicalMB = 1024;
+	inline const TCHAR* const DefaultFanOutAssetClass = TEXT("WidgetBlueprint");
+	inline const TCHAR* const ScaffoldTypes[] = {
+		TEXT("popup"),
+		TEXT("bottom_button_bar"),
+		TEXT("scroll_uniform_grid_host"),
+		TEXT("virtualized_uniform_grid_host"),
+		TEXT("tile_view_host"),
+		TEXT("tile_view_entry"),
+		TEXT("item_tile_popup"),
+		TEXT("item_tile_entry")};
+	inline const TCHAR* const ScaffoldTemplateDirectoryPath = TEXT("/Game/OctoMCP/ScaffoldTemplates");
+	inline constexpr int32 ScaffoldTemplateVersion = 3;
+	inline const TCHAR* const CommandSetWidgetInvalidationBoundary = TEXT("set_widget_invalidation_boundary");
+	inline const TCHAR* const InvalidationBoundaryNone = TEXT("none");
+	inline const TCHAR* const InvalidationBoundaryInvalidation = TEXT("invalidation");
+	inline const TCHAR* const InvalidationBoundaryRetainer = TEXT("retainer");
+	inline const TCHAR* const InvalidationBoundaryTypes[] = {
+		InvalidationBoundaryNone,
+		InvalidationBoundaryInvalidation,
+		InvalidationBoundaryRetainer};
 	inline const TCHAR* const BootstrapTemplateMapPath = TEXT("/Engine/Maps/Templates/Template_Default");
 	inline const TCHAR* const DefaultBootstrapLevelFileName = TEXT("BasicMap");
 	inline const TCHAR* const DefaultBootstrapDirectoryPath = TEXT("/Game/Maps");
+
+	// Turns a JSON string, number or boolean into Unreal import text; false for any other JSON type.
+	bool JsonValueToImportText(const TSharedPtr<FJsonValue>& Value, FString& OutText);
 }
 
 	struct FCreateWidgetBlueprintResult
@@ -124,6 +179,10 @@ namespace OctoMCP
 		FString AssetName;
 		FString ParentClassPath;
 		FString ParentClassName;
+		bool bFromTemplate = false;
+		bool bTemplateCreated = false;
+		FString ScaffoldType;
+		FString TemplateAssetPath;
 	};
 
 	struct FCreateBlueprintAssetResult
@@ -145,17 +204,52 @@ namespace OctoMCP
 	{
 		bool bSaved = false;
 		bool bSuccess = false;
+		bool bFromTemplate = false;
+		bool bTemplateCreated = false;
+		bool bParentRetargeted = false;
 		FString Message;
 		FString AssetPath;
 		FString AssetObjectPath;
 		FString PackagePath;
 		FString AssetName;
 		FString ScaffoldType;
+		FString TemplateAssetPath;
+		FString ParentClassPath;
+		FString InvalidationBoundary;
+		TArray<FString> BoundaryWidgetNames;
+	};
+
+	struct FSetWidgetInvalidationBoundaryResult
+	{
+		bool bChanged = false;
+		bool bSaved = false;
+		bool bSuccess = false;
+		FString Message;
+		FString AssetPath;
+		FString AssetObjectPath;
+		FString PackagePath;
+		FString AssetName;
+		FString WidgetName;
+		FString Boundary;
+		FString BoundaryWidgetName;
+	};
+
+	struct FOctoMCPTextureImportProfile
+	{
+		bool bNeverStream = true;
+		bool bSRGB = true;
+		int32 MaxTextureSize = 0;
+		TEnumAsByte<TextureGroup> LODGroup = TEXTUREGROUP_UI;
+		TEnumAsByte<TextureMipGenSettings> MipGenSettings = TMGS_NoMipmaps;
+		TEnumAsByte<TextureCompressionSettings> CompressionSettings = TC_EditorIcon;
+		FString Name;
 	};
 
 	struct FImportTextureAssetResult
 	{
 		bool bImported = false;
+		bool bSkippedUnchanged = false;
+		bool bProfileApplied = false;
 		bool bSaved = false;
 		bool bSuccess = false;
 		FString Message;
@@ -164,6 +258,179 @@ namespace OctoMCP
 		FString AssetObjectPath;
 		FString PackagePath;
 		FString AssetName;
+		FString ImportProfile;
+	};
+
+	struct FApplyTextureProfileResult
+	{
+		bool bSaved = false;
+		bool bSuccess = false;
+		int32 MatchedCount = 0;
+		int32 UpdatedCount = 0;
+		int32 UnchangedCount = 0;
+		int32 FailedCount = 0;
+		FString Message;
+		FString PathPrefix;
+		FString ImportProfile;
+		TArray<FString> UpdatedAssets;
+		TArray<FString> FailedAssets;
+	};
+
+	struct FPackIconAtlasResult
+	{
+		bool bCreated = false;
+		bool bSaved = false;
+		bool bSuccess = false;
+		int32 IconCount = 0;
+		int32 PageCount = 0;
+		int32 PageSize = 0;
+		int32 Padding = 0;
+		FString Message;
+		FString AssetPath;
+		FString AssetObjectPath;
+		FString PackagePath;
+		FString AssetName;
+		FString EntryWidgetAssetPath;
+		TArray<FString> PageAssetPaths;
+		TArray<FString> SkippedTextures;
+		TArray<FString> DeletedPageAssetPaths;
+		TArray<FString> StalePageAssetPaths;
+	};
+
+	struct FApplyWidgetTreeResult
+	{
+		bool bChanged = false;
+		bool bSaved = false;
+		bool bSuccess = false;
+		int32 WidgetCount = 0;
+		int32 CreatedCount = 0;
+		int32 ReplacedCount = 0;
+		int32 RemovedCount = 0;
+		int32 MovedCount = 0;
+		int32 PropertyChangeCount = 0;
+		FString Message;
+		FString AssetPath;
+		FString AssetObjectPath;
+		FString PackagePath;
+		FString AssetName;
+		TArray<FString> Changes;
+	};
+
+	struct FGetWidgetTreeResult
+	{
+		bool bNotModified = false;
+		bool bSuccess = false;
+		int32 WidgetCount = 0;
+		FString Message;
+		FString AssetPath;
+		FString AssetObjectPath;
+		FString PackagePath;
+		FString AssetName;
+		FString RootWidgetName;
+		FString ContentHash;
+		TArray<TSharedPtr<FJsonValue>> Widgets;
+	};
+
+	struct FOctoMCPAssetTargets
+	{
+		bool bFanOut = false;
+		FString AssetPath;
+		FString PathPrefix;
+		FString ClassPath;
+		FString NamePattern;
+		FString ParentClass;
+	};
+
+	struct FFanOutResult
+	{
+		bool bSaved = false;
+		bool bSaveQueued = false;
+		bool bSuccess = false;
+		int32 MatchedCount = 0;
+		int32 SucceededCount = 0;
+		int32 FailedCount = 0;
+		int32 SavedCount = 0;
+		FString Message;
+		TArray<FString> FailedPackages;
+		TArray<TSharedPtr<FJsonValue>> Assets;
+	};
+
+	struct FOctoMCPWidgetMetadata
+	{
+		bool bIsVariable = false;
+		int32 ChildIndex = INDEX_NONE;
+		FName ParentName;
+		TWeakObjectPtr<UClass> WidgetClass;
+		TWeakObjectPtr<UClass> SlotClass;
+	};
+
+	struct FOctoMCPWidgetTreeMetadata
+	{
+		FName RootWidgetName;
+		TWeakObjectPtr<UClass> ParentClass;
+		TMap<FName, FOctoMCPWidgetMetadata> Widgets;
+	};
+
+	struct FDryRunResult
+	{
+		bool bSuccess = false;
+		bool bWidgetTreeChecked = false;
+		FString Message;
+		FString Command;
+		FString AssetPath;
+		FString AssetObjectPath;
+		TArray<FString> PlannedChanges;
+		TArray<FString> Problems;
+		TArray<FString> Warnings;
+	};
+
+	struct FOctoMCPQueuedCommand
+	{
+		TFunction<void()> GameThreadWork;
+		int32 PendingLoadCount = 0;
+	};
+
+	struct FOctoMCPResolvedPropertyPath
+	{
+		// Outermost property first; every entry but the last is an FStructProperty.
+		TArray<FProperty*, TInlineAllocator<4>> PropertyChain;
+	};
+
+	// An import-text value parsed against a class before any object is modified; owns its scratch storage.
+	struct FOctoMCPParsedPropertyValue
+	{
+		FOctoMCPParsedPropertyValue() = default;
+		FOctoMCPParsedPropertyValue(const FOctoMCPParsedPropertyValue&) = delete;
+		FOctoMCPParsedPropertyValue& operator=(const FOctoMCPParsedPropertyValue&) = delete;
+
+		~FOctoMCPParsedPropertyValue()
+		{
+			if (Value != nullptr)
+			{
+				ResolvedPath.PropertyChain.Last()->DestroyValue(Value);
+				FMemory::Free(Value);
+			}
+		}
+
+		FString PropertyPath;
+		FOctoMCPResolvedPropertyPath ResolvedPath;
+		void* Value = nullptr;
+	};
+
+	struct FSetWidgetPropertiesResult
+	{
+		bool bChanged = false;
+		bool bSaved = false;
+		bool bSuccess = false;
+		int32 EntryCount = 0;
+		int32 ChangedCount = 0;
+		int32 UnchangedCount = 0;
+		FString Message;
+		FString AssetPath;
+		FString AssetObjectPath;
+		FString PackagePath;
+		FString AssetName;
+		TArray<FString> Changes;
 	};
 
 	struct FSetBlueprintClassPropertyResult
@@ -400,6 +667,90 @@ namespace OctoMCP
 		FString GameModeClassPath;
 	};
 
+	struct FFlushSavesResult
+	{
+		bool bSuccess = false;
+		int32 SavedCount = 0;
+		int32 FailedCount = 0;
+		int32 SkippedCount = 0;
+		FString Message;
+		TArray<FString> SavedPackages;
+		TArray<FString> FailedPackages;
+		TArray<FString> SkippedPackages;
+	};
+
+	struct FSaveQueueStatusResult
+	{
+		bool bLastFlushSucceeded = true;
+		int32 PendingCount = 0;
+		int32 TotalFlushCount = 0;
+		double SecondsSinceLastQueued = 0.0;
+		double SecondsSinceLastFlush = -1.0;
+		FString LastFlushMessage;
+		TArray<FString> PendingPackages;
+		TArray<FString> LastFlushFailedPackages;
+	};
+
+	struct FOctoMCPWorkingSetEntry
+	{
+		bool bPinned = false;
+		int32 UseCount = 0;
+		double LastUsedTime = 0.0;
+		FString AssetObjectPath;
+		TStrongObjectPtr<UWidgetBlueprint> WidgetBlueprint;
+	};
+
+	struct FWorkingSetEntryStatus
+	{
+		bool bPinned = false;
+		int32 UseCount = 0;
+		double SecondsSinceLastUse = 0.0;
+		FString AssetObjectPath;
+	};
+
+	struct FWorkingSetResult
+	{
+		bool bSuccess = false;
+		int32 Capacity = 0;
+		int32 PinnedCount = 0;
+		int32 MemoryPressureReleaseCount = 0;
+		FString Message;
+		FString AssetObjectPath;
+		FString LastReleaseReason;
+		TArray<FWorkingSetEntryStatus> Entries;
+	};
+
+	struct FOctoMCPIndexedAsset
+	{
+		bool bValid = false;
+		FAssetData AssetData;
+		FString PackageNameString;
+		FString AssetNameLower;
+	};
+
+	struct FQueryAssetsEntry
+	{
+		FString AssetObjectPath;
+		FString AssetPath;
+		FString PackagePath;
+		FString AssetName;
+		FString ClassPath;
+		FString ClassName;
+	};
+
+	struct FQueryAssetsResult
+	{
+		bool bSuccess = false;
+		bool bIndexReady = false;
+		int32 TotalCount = 0;
+		int32 Offset = 0;
+		int32 Limit = 0;
+		int32 IndexedAssetCount = 0;
+		int64 IndexRevision = 0;
+		FString Message;
+		TArray<FQueryAssetsEntry> Assets;
+	};
+
 	struct FBootstrapProjectMapResult
 	{
 		bool bBootstrapped = false;
@@ -434,6 +785,10 @@ private:
 
     bool HandleCommandRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete) const;
 
+    void RunAfterPreloadingAssets(const TArray<FString>& AssetPaths, TFunction<void()> GameThreadWork) const;
+
+    void PumpGameThreadCommandQueue() const;
+
     TSharedRef<FJsonObject> BuildVersionInfoObject() const;
 
     TSharedRef<FJsonObject> BuildLiveCodingCompileObject(const bool bWaitForCompletion) const;
@@ -451,6 +806,8 @@ private:
     TSharedRef<FJsonObject> BuildCreateWidgetBlueprintObject(
     	const FString& AssetPath,
     	const FString& ParentClassPath,
+    	const FString& ScaffoldType,
+    	const FString& InvalidationBoundary,
     	const bool bSaveAsset) const;
 
     FCreateWidgetBlueprintResult CreateWidgetBlueprintAsset(
@@ -517,6 +874,13 @@ private:
     	UClass* const Value,
     	FString& OutError) const;
 
+    bool SetObjectPropertyValue(
+    	UClass* const OwnerClass,
+    	UObject* const ObjectInstance,
+    	const TCHAR* PropertyName,
+    	UObject* const Value,
+    	FString& OutError) const;
+
     bool SetNamePropertyValue(
     	UClass* const OwnerClass,
     	UObject* const ObjectInstance,
@@ -538,24 +902,83 @@ private:
     	const FVector2D& Value,
     	FString& OutError) const;
 
+    bool ResolvePropertyPath(
+    	const UStruct* const OwnerStruct,
+    	const FString& PropertyPath,
+    	FOctoMCPResolvedPropertyPath& OutResolvedPath,
+    	FString& OutError) const;
+
+    bool ParsePropertyValueText(
+    	const UStruct* const OwnerStruct,
+    	UObject* const ImportOwner,
+    	const FString& PropertyPath,
+    	const FString& ValueText,
+    	FOctoMCPParsedPropertyValue& OutParsedValue,
+    	FString& OutError) const;
+
+    bool ApplyParsedPropertyValue(UObject* const ObjectInstance, const FOctoMCPParsedPropertyValue& ParsedValue) const;
+
     bool ParseOrientationValue(
     	const FString& InOrientation,
     	EOrientation& OutOrientation,
     	FString& OutNormalizedOrientation,
     	FString& OutError) const;
 
+    bool ResolveTextureImportProfile(
+    	const FString& InProfileName,
+    	FOctoMCPTextureImportProfile& OutProfile,
+    	FString& OutError) const;
+
+    bool ApplyTextureImportProfile(
+    	UTexture2D* const Texture,
+    	const FOctoMCPTextureImportProfile& Profile) const;
+
     TSharedRef<FJsonObject> BuildImportTextureAssetObject(
     	const FString& SourceFilePath,
     	const FString& AssetPath,
+    	const FString& ImportProfile,
     	const bool bReplaceExisting,
     	const bool bSaveAsset) const;
 
     FImportTextureAssetResult ImportTextureAsset(
     	const FString& InSourceFilePath,
     	const FString& InAssetPath,
+    	const FString& InImportProfile,
     	const bool bReplaceExisting,
     	const bool bSaveAsset) const;
 
+    TSharedRef<FJsonObject> BuildApplyTextureProfileObject(
+    	const FString& PathPrefix,
+    	const FString& ImportProfile,
+    	const bool bSaveAsset,
+    	const bool bDeferSave) const;
+
+    FApplyTextureProfileResult ApplyTextureProfileToPath(
+    	const FString& InPathPrefix,
+    	const FString& InImportProfile,
+    	const bool bSaveAsset,
+    	const bool bDeferSave) const;
+
+    TSharedRef<FJsonObject> BuildPackIconAtlasObject(
+    	const FString& AtlasAssetPath,
+    	const TArray<FString>& TextureAssetPaths,
+    	const FString& PathPrefix,
+    	const FString& EntryWidgetAssetPath,
+    	const int32 PageSize,
+    	const int32 Padding,
+    	const bool bSaveAsset,
+    	const bool bDeferSave) const;
+
+    FPackIconAtlasResult PackIconAtlas(
+    	const FString& InAtlasAssetPath,
+    	const TArray<FString>& InTextureAssetPaths,
+    	const FString& InPathPrefix,
+    	const FString& InEntryWidgetAssetPath,
+    	const int32 InPageSize,
+    	const int32 InPadding,
+    	const bool bSaveAsset,
+    	const bool bDeferSave) const;
+
     TSharedRef<FJsonObject> BuildSetWidgetImageTextureObject(
     	const FString& AssetPath,
     	const FString& WidgetName,
@@ -780,14 +1203,230 @@ private:
     	const FString& InDirectoryPath,
     	const bool bForceCreate) const;
 
+    void StartDeferredSaveQueue();
+
+    void StopDeferredSaveQueue();
+
+    bool TickDeferredSaveQueue(float DeltaTime);
+
+    void QueueDeferredSave(const TSharedPtr<FJsonObject>& CommandResultObject) const;
+
+    bool QueueDeferredPackageSave(const FString& PackageName) const;
+
+    TSharedRef<FJsonObject> BuildFlushSavesObject() const;
+
+    FFlushSavesResult FlushDeferredSaves() const;
+
+    TSharedRef<FJsonObject> BuildSaveQueueStatusObject() const;
+
+    FSaveQueueStatusResult GetSaveQueueStatus() const;
+
+    void StartWidgetBlueprintWorkingSet();
+
+    void StopWidgetBlueprintWorkingSet();
+
+    UWidgetBlueprint* LoadWorkingSetWidgetBlueprint(const FString& AssetObjectPath) const;
+
+    void TouchWorkingSetEntry(
+    	UWidgetBlueprint* WidgetBlueprint,
+    	const FString& AssetObjectPath,
+    	const bool bPin) const;
+
+    void TrimWorkingSet() const;
+
+    void ReleaseWorkingSet(const FString& Reason) const;
+
+    void HandleMemoryTrimForWorkingSet();
+
+    void HandleAssetsPreDeleteForWorkingSet(const TArray<UObject*>& Objects);
+
+    TSharedRef<FJsonObject> BuildWorkingSetObject(const FWorkingSetResult& WorkingSetResult) const;
+
+    TSharedRef<FJsonObject> BuildGetWorkingSetObject() const;
+
+    TSharedRef<FJsonObject> BuildPinWorkingSetAssetObject(const FString& AssetPath, const bool bPinned) const;
+
+    FWorkingSetResult GetWorkingSet() const;
+
+    FWorkingSetResult PinWorkingSetAsset(const FString& InAssetPath, const bool bPinned) const;
+
+    void StartAssetIndex();
+
+    void StopAssetIndex();
+
+    void SeedAssetIndex();
+
+    void HandleIndexedAssetAdded(const FAssetData& AssetData);
+
+    void HandleIndexedAssetRemoved(const FAssetData& AssetData);
+
+    void HandleIndexedAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    void AddOrUpdateIndexedAsset(const FAssetData& AssetData);
+
+    void RemoveIndexedAsset(const FSoftObjectPath& ObjectPath);
+
+    bool FindIndexedAsset(const FString& AssetObjectPath, FAssetData& OutAssetData) const;
+
+    void CollectIndexedAssetPaths(
+    	const FTopLevelAssetPath& ClassPath,
+    	const FString& PathPrefix,
+    	TArray<FSoftObjectPath>& OutObjectPaths) const;
+
+    TSharedRef<FJsonObject> BuildQueryAssetsObject(
+    	const FString& ClassPath,
+    	const FString& PathPrefix,
+    	const FString& NameContains,
+    	const TArray<TPair<FName, FString>>& TagFilters,
+    	const int32 Offset,
+    	const int32 Limit) const;
+
+    // Matching index slots in object path order. The caller holds AssetIndexLock for reading.
+    void CollectMatchingIndexedAssetSlots(
+    	const FString& InClassPath,
+    	const FString& InPathPrefix,
+    	const FString& InNameContains,
+    	const TArray<TPair<FName, FString>>& TagFilters,
+    	TArray<int32>& OutSlots) const;
+
+    FQueryAssetsResult QueryAssets(
+    	const FString& InClassPath,
+    	const FString& InPathPrefix,
+    	const FString& InNameContains,
+    	const TArray<TPair<FName, FString>>& InTagFilters,
+    	const int32 InOffset,
+    	const int32 InLimit) const;
+
+    bool ResolveFanOutAssetPaths(
+    	const FOctoMCPAssetTargets& AssetTargets,
+    	TArray<FString>& OutAssetPaths,
+    	FString& OutError) const;
+
+    TSharedRef<FJsonObject> BuildFanOutObject(
+    	const FOctoMCPAssetTargets& AssetTargets,
+    	const bool bSaveAsset,
+    	const bool bDeferSave,
+    	TFunctionRef<TSharedRef<FJsonObject>(const FString& AssetPath, const bool bSaveAsset)> BuildAssetResult) const;
+
+    FFanOutResult RunFanOut(
+    	const FOctoMCPAssetTargets& AssetTargets,
+    	const bool bSaveAsset,
+    	const bool bDeferSave,
+    	TFunctionRef<TSharedRef<FJsonObject>(const FString& AssetPath, const bool bSaveAsset)> BuildAssetResult) const;
+
+    void StartWidgetTreeMetadataCache();
+
+    void StopWidgetTreeMetadataCache();
+
+    void HandlePackageSavedForWidgetTreeMetadata(
+    	const FString& PackageFileName,
+    	UPackage* Package,
+    	FObjectPostSaveContext ObjectSaveContext);
+
+    void CacheWidgetTreeMetadata(const UWidgetBlueprint* const WidgetBlueprint) const;
+
+    const FOctoMCPWidgetTreeMetadata* FindWidgetTreeMetadata(const FString& AssetObjectPath) const;
+
+    bool HandleDryRunRequest(
+    	const FString& Command,
+    	const TSharedRef<FJsonObject>& RequestObject,
+    	const FString& RequestId,
+    	const FHttpResultCallback& OnComplete) const;
+
+    bool IsDryRunSupported(const FString& Command, bool& bOutSupportsFanOut) const;
+
+    TSharedRef<FJsonObject> BuildDryRunObject(
+    	const FString& Command,
+    	const FOctoMCPAssetTargets& AssetTargets,
+    	const TSharedPtr<FJsonObject>& ArgumentsObject) const;
+
+    FDryRunResult DryRunCommand(
+    	const FString& Command,
+    	const FString& InAssetPath,
+    	const TSharedPtr<FJsonObject>& ArgumentsObject) const;
+
+    UClass* FindClassWithoutLoading(
+    	const FString& InClassPath,
+    	const UClass* RequiredBaseClass,
+    	bool& bOutFoundUnloadedBlueprint,
+    	FString& OutError) const;
+
+    void DryRunApplyWidgetTree(
+    	const TSharedPtr<FJsonObject>& TreeObject,
+    	const FOctoMCPWidgetTreeMetadata* const TreeMetadata,
+    	FDryRunResult& Result) const;
+
     TSharedRef<FJsonObject> BuildScaffoldWidgetBlueprintObject(
     	const FString& AssetPath,
     	const FString& ScaffoldType,
+    	const bool bUseTemplate,
+    	const FString& ParentClassPath,
+    	const FString& InvalidationBoundary,
     	const bool bSaveAsset) const;
 
     FScaffoldWidgetBlueprintResult ScaffoldWidgetBlueprintAsset(
     	const FString& InAssetPath,
     	const FString& InScaffoldType,
+    	const bool bUseTemplate,
+    	const FString& InParentClassPath,
+    	const FString& InInvalidationBoundary,
+    	const bool bSaveAsset) const;
+
+    bool BuildWidgetScaffold(
+    	UWidgetBlueprint* WidgetBlueprint,
+    	const FString& ScaffoldType,
+    	const FString& InvalidationBoundary) const;
+
+    bool IsScaffoldType(const FString& ScaffoldType) const;
+
+    FString GetScaffoldTemplateAssetPath(const FString& ScaffoldType, const FString& InvalidationBoundary) const;
+
+    UWidgetBlueprint* FindOrCreateScaffoldTemplate(
+    	const FString& ScaffoldType,
+    	const FString& InvalidationBoundary,
+    	bool& bOutCreated,
+    	FString& OutError) const;
+
+    void CloneScaffoldTemplate(
+    	const FString& InParentClassPath,
+    	const bool bSaveAsset,
+    	FScaffoldWidgetBlueprintResult& Result) const;
+
+    FCreateWidgetBlueprintResult CreateWidgetBlueprintFromScaffoldTemplate(
+    	const FString& InAssetPath,
+    	const FString& InParentClassPath,
+    	const FString& InScaffoldType,
+    	const FString& InInvalidationBoundary,
+    	const bool bSaveAsset) const;
+
+    TSharedRef<FJsonObject> BuildApplyWidgetTreeObject(
+    	const FString& AssetPath,
+    	const TSharedPtr<FJsonObject>& TreeObject,
+    	const bool bSaveAsset) const;
+
+    FApplyWidgetTreeResult ApplyWidgetTree(
+    	const FString& InAssetPath,
+    	const TSharedPtr<FJsonObject>& InTreeObject,
+    	const bool bSaveAsset) const;
+
+    TSharedRef<FJsonObject> BuildGetWidgetTreeObject(
+    	const FString& AssetPath,
+    	const FString& LastHash,
+    	const bool bIncludeProperties) const;
+
+    FGetWidgetTreeResult GetWidgetTree(
+    	const FString& InAssetPath,
+    	const FString& InLastHash,
+    	const bool bIncludeProperties) const;
+
+    TSharedRef<FJsonObject> BuildSetWidgetPropertiesObject(
+    	const FString& AssetPath,
+    	const TArray<TSharedPtr<FJsonObject>>& EntryObjects,
+    	const bool bSaveAsset) const;
+
+    FSetWidgetPropertiesResult SetWidgetProperties(
+    	const FString& InAssetPath,
+    	const TArray<TSharedPtr<FJsonObject>>& InEntryObjects,
     	const bool bSaveAsset) const;
 
     void ResetWidgetBlueprintTree(UWidgetBlueprint* WidgetBlueprint) const;
@@ -855,6 +1494,30 @@ private:
 
     UPanelSlot* EnsurePanelChildAt(UPanelWidget* ParentWidget, UWidget* ChildWidget, const int32 DesiredIndex) const;
 
+    TSharedRef<FJsonObject> BuildSetWidgetInvalidationBoundaryObject(
+    	const FString& AssetPath,
+    	const FString& WidgetName,
+    	const FString& Boundary,
+    	const bool bSaveAsset) const;
+
+    FSetWidgetInvalidationBoundaryResult SetWidgetInvalidationBoundary(
+    	const FString& InAssetPath,
+    	const FString& InWidgetName,
+    	const FString& InBoundary,
+    	const bool bSaveAsset) const;
+
+    bool IsInvalidationBoundaryType(const FString& Boundary) const;
+
+    UContentWidget* FindInvalidationBoundary(UWidget* Widget) const;
+
+    bool ApplyInvalidationBoundary(
+    	UWidgetBlueprint* WidgetBlueprint,
+    	UWidget* Widget,
+    	const FString& Boundary,
+    	FString& OutBoundaryWidgetName,
+    	bool& bOutChanged,
+    	FString& OutError) const;
+
     bool BuildPopupWidgetScaffold(UWidgetBlueprint* WidgetBlueprint) const;
 
     bool BuildBottomButtonBarWidgetScaffold(UWidgetBlueprint* WidgetBlueprint) const;
@@ -903,6 +1566,40 @@ private:
     	float& OutValue,
     	FString& OutError) const;
 
+    bool TryGetOptionalSaveModeArgument(
+    	const TSharedPtr<FJsonObject>& ArgumentsObject,
+    	bool& bOutDeferSave,
+    	FString& OutError) const;
+
+    bool TryGetOptionalStringMapArgument(
+    	const TSharedPtr<FJsonObject>& ArgumentsObject,
+    	const FString& FieldName,
+    	TArray<TPair<FName, FString>>& OutValues,
+    	FString& OutError) const;
+
+    bool TryGetOptionalStringArrayArgument(
+    	const TSharedPtr<FJsonObject>& ArgumentsObject,
+    	const FString& FieldName,
+    	TArray<FString>& OutValues,
+    	FString& OutError) const;
+
+    bool TryGetRequiredObjectArgument(
+    	const TSharedPtr<FJsonObject>& ArgumentsObject,
+    	const FString& FieldName,
+    	TSharedPtr<FJsonObject>& OutValue,
+    	FString& OutError) const;
+
+    bool TryGetAssetTargetsArgument(
+    	const TSharedPtr<FJsonObject>& ArgumentsObject,
+    	FOctoMCPAssetTargets& OutTargets,
+    	FString& OutError) const;
+
+    bool TryGetRequiredObjectArrayArgument(
+    	const TSharedPtr<FJsonObject>& ArgumentsObject,
+    	const FString& FieldName,
+    	TArray<TSharedPtr<FJsonObject>>& OutValues,
+    	FString& OutError) const;
+
     bool TryGetRequiredIntArgument(
     	const TSharedPtr<FJsonObject>& ArgumentsObject,
     	const FString& FieldName,
@@ -921,6 +1618,18 @@ private:
     	FString& OutValue,
     	FString& OutError) const;
 
+    bool TryGetRequiredAssetPathArgument(
+    	const TSharedPtr<FJsonObject>& ArgumentsObject,
+    	const FString& FieldName,
+    	FString& OutAssetObjectPath,
+    	FString& OutError) const;
+
+    bool TryGetOptionalAssetPathArgument(
+    	const TSharedPtr<FJsonObject>& ArgumentsObject,
+    	const FString& FieldName,
+    	FString& OutAssetObjectPath,
+    	FString& OutError) const;
+
     bool TryParseJsonBody(const TArray<uint8>& Body, TSharedPtr<FJsonObject>& OutObject, FString& OutError) const;
 
     TUniquePtr<FHttpServerResponse> CreateJsonResponse(
@@ -938,4 +1647,49 @@ private:
     FHttpRouteHandle HealthRouteHandle;
     FHttpRouteHandle CommandRouteHandle;
     FString PluginVersion;
+    FTSTicker::FDelegateHandle DeferredSaveTickerHandle;
+
+    // Write-behind save queue. Only touched on the game thread.
+    mutable TSet<FString> PendingSavePackageNames;
+    mutable double LastDeferredSaveQueuedTime = 0.0;
+    mutable double LastDeferredSaveFlushTime = 0.0;
+    mutable int32 DeferredSaveFlushCount = 0;
+    mutable bool bLastDeferredSaveFlushSucceeded = true;
+    mutable FString LastDeferredSaveFlushMessage;
+    mutable TArray<FString> LastDeferredSaveFailedPackages;
+
+    // Commands in arrival order; the head is posted to the game thread once its own preloads finish. Game thread only.
+    mutable TArray<TSharedRef<FOctoMCPQueuedCommand>> GameThreadCommandQueue;
+
+    // Resolved dotted property paths keyed by (owner struct, path). Only touched on the game thread.
+    mutable TMap<TPair<TWeakObjectPtr<const UStruct>, FString>, FOctoMCPResolvedPropertyPath> ResolvedPropertyPathCache;
+
+    // Widget tree snapshots keyed by Widget Blueprint object path, refreshed on save and on every dry run
+    // of a loaded blueprint. Lets dryRun validate widget names and types without loading. Game thread only.
+    mutable TMap<FString, FOctoMCPWidgetTreeMetadata> WidgetTreeMetadataCache;
+    FDelegateHandle WidgetTreeMetadataSavedHandle;
+
+    // Recently edited Widget Blueprints kept loaded between commands, least recently used first.
+    // Pinned entries are never evicted. Game thread only.
+    mutable TArray<FOctoMCPWorkingSetEntry> WorkingSetEntries;
+    mutable int32 WorkingSetMemoryPressureReleaseCount = 0;
+    mutable FString WorkingSetLastReleaseReason;
+    FDelegateHandle WorkingSetMemoryTrimHandle;
+    FDelegateHandle WorkingSetAssetsPreDeleteHandle;
+
+    // In-memory asset registry index. Written from registry delegates, read by query_assets.
+    mutable FRWLock AssetIndexLock;
+    TArray<FOctoMCPIndexedAsset> IndexedAssets;
+    TArray<int32> FreeIndexedAssetSlots;
+    TMap<FSoftObjectPath, int32> IndexedAssetSlotByObjectPath;
+    TMap<FTopLevelAssetPath, TSet<int32>> IndexedAssetSlotsByClass;
+    TMap<FName, TSet<int32>> IndexedAssetSlotsByPackagePath;
+    TMap<FName, TSet<int32>> IndexedAssetSlotsByTagKey;
+    int64 AssetIndexRevision = 0;
+    bool bAssetIndexReady = false;
+    FDelegateHandle AssetIndexFilesLoadedHandle;
+    FDelegateHandle AssetIndexAddedHandle;
+    FDelegateHandle AssetIndexRemovedHandle;
+    FDelegateHandle AssetIndexRenamedHandle;
+    FDelegateHandle AssetIndexUpdatedHandle;
 };
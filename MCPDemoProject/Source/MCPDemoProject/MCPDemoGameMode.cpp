@@ -29,5 +29,6 @@ void AMCPDemoGameMode::StartPlay()
 	if (BottomButtonBarWidgetInstance != nullptr)
 	{
 		BottomButtonBarWidgetInstance->AddToViewport();
+		BottomButtonBarWidgetInstance->PrewarmPopups();
 	}
 }
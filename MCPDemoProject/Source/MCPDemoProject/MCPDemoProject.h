@@ -3,4 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// Runtime UI counters and timings; view with "stat MCPUI" or capture with "stat startfile" / Unreal Insights.
+DECLARE_STATS_GROUP(TEXT("MCP UI"), STATGROUP_MCPUI, STATCAT_Advanced);
 
@@ -0,0 +1,518 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// Headless runtime UI benchmarks. They need a game world with a player controller, so run them in a game session:
+//   UnrealEditor MCPDemoProject.uproject /Game/Maps/BasicMap -game -nullrhi -unattended -nosound
+//     -ExecCmds="Automation RunTests MCPUI; Quit"
+// Every scenario appends a row to Saved/Automation/MCPUIBenchmark.csv (override with -MCPUIBenchmarkCsv=<path>)
+// and fails when it exceeds a limit from the [MCPUIBenchmark] section of DefaultGame.ini.
+// "stat MCPUI" breaks the same runs down by code path.
+
+#include "CoreMinimal.h"
+#include "Components/Button.h"
+#include "Components/TileView.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UI/MCPBottomButtonBarWidget.h"
+#include "UI/MCPItemTileDataObject.h"
+#include "UI/MCPItemTilePopupWidget.h"
+#include "UI/MCPPopupWidget.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const TCHAR* const BenchmarkConfigSection = TEXT("MCPUIBenchmark");
+	const TCHAR* const BottomButtonBarClassPath = TEXT("/Game/UI/Widget/WBP_MCPBottomButtonBar.WBP_MCPBottomButtonBar_C");
+	constexpr int32 DefaultPopupCycleCount = 200;
+	constexpr int32 DefaultScrollStepCount = 120;
+	constexpr int32 MaxAnimationTicksPerOpen = 600;
+	constexpr float SimulatedFrameDeltaTime = 1.0f / 60.0f;
+
+	constexpr EAutomationTestFlags BenchmarkTestFlags = EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter;
+
+	struct FMCPUIBenchmarkSample
+	{
+		FString Scenario;
+		int32 OperationCount = 0;
+		double CpuMs = 0.0;
+		double MsPerOperation = 0.0;
+		int64 MemoryDeltaKB = 0;
+		int32 UObjectDelta = 0;
+		int32 LiveUObjectDeltaAfterGC = 0;
+		double GcMs = 0.0;
+	};
+
+	int32 GetUObjectCount()
+	{
+		return GUObjectArray.GetObjectArrayNumMinusAvailable();
+	}
+
+	int64 GetUsedPhysicalKB()
+	{
+		return static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical / 1024);
+	}
+
+	// Accumulates CPU time only while running, so untimed lookups between measured steps are excluded.
+	class FMCPUIBenchmarkScope
+	{
+	public:
+		explicit FMCPUIBenchmarkScope(const FString& InScenario)
+			: Scenario(InScenario)
+			, StartUObjectCount(GetUObjectCount())
+			, StartMemoryKB(GetUsedPhysicalKB())
+		{
+		}
+
+		void Resume()
+		{
+			ResumeTime = FPlatformTime::Seconds();
+		}
+
+		void Pause()
+		{
+			ElapsedSeconds += FPlatformTime::Seconds() - ResumeTime;
+		}
+
+		// Samples memory and UObjects before collecting, then times a full purge to report what survives it.
+		FMCPUIBenchmarkSample Finish(const int32 OperationCount) const
+		{
+			FMCPUIBenchmarkSample Sample;
+			Sample.Scenario = Scenario;
+			Sample.OperationCount = OperationCount;
+			Sample.CpuMs = ElapsedSeconds * 1000.0;
+			Sample.MsPerOperation = OperationCount > 0 ? Sample.CpuMs / OperationCount : 0.0;
+			Sample.MemoryDeltaKB = GetUsedPhysicalKB() - StartMemoryKB;
+			Sample.UObjectDelta = GetUObjectCount() - StartUObjectCount;
+
+			const double GcStartTime = FPlatformTime::Seconds();
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+			Sample.GcMs = (FPlatformTime::Seconds() - GcStartTime) * 1000.0;
+			Sample.LiveUObjectDeltaAfterGC = GetUObjectCount() - StartUObjectCount;
+			return Sample;
+		}
+
+	private:
+		FString Scenario;
+		int32 StartUObjectCount = 0;
+		int64 StartMemoryKB = 0;
+		double ResumeTime = 0.0;
+		double ElapsedSeconds = 0.0;
+	};
+
+	// Looks the limit up for the exact scenario first (TileListPopulate_100000), then for its base name.
+	bool GetBenchmarkThreshold(const FString& Scenario, const TCHAR* LimitName, double& OutLimit)
+	{
+		if (GConfig == nullptr)
+		{
+			return false;
+		}
+
+		FString BaseScenario;
+		FString SizeSuffix;
+		if (!Scenario.Split(TEXT("_"), &BaseScenario, &SizeSuffix))
+		{
+			BaseScenario = Scenario;
+		}
+
+		return GConfig->GetDouble(BenchmarkConfigSection, *FString::Printf(TEXT("%s.%s"), *Scenario, LimitName), OutLimit, GGameIni)
+			|| GConfig->GetDouble(BenchmarkConfigSection, *FString::Printf(TEXT("%s.%s"), *BaseScenario, LimitName), OutLimit, GGameIni);
+	}
+
+	FString GetBenchmarkCsvPath()
+	{
+		FString CsvPath;
+		if (!FParse::Value(FCommandLine::Get(), TEXT("MCPUIBenchmarkCsv="), CsvPath))
+		{
+			CsvPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Automation"), TEXT("MCPUIBenchmark.csv"));
+		}
+
+		return CsvPath;
+	}
+
+	void RecordBenchmarkSample(FAutomationTestBase& Test, const FMCPUIBenchmarkSample& Sample)
+	{
+		double MaxMsPerOperation = 0.0;
+		double MaxLiveUObjectDelta = 0.0;
+		const bool bHasTimeLimit = GetBenchmarkThreshold(Sample.Scenario, TEXT("MaxMsPerOp"), MaxMsPerOperation);
+		const bool bHasObjectLimit = GetBenchmarkThreshold(Sample.Scenario, TEXT("MaxLiveUObjectDelta"), MaxLiveUObjectDelta);
+
+		const bool bTimeExceeded = bHasTimeLimit && Sample.MsPerOperation > MaxMsPerOperation;
+		const bool bObjectsExceeded = bHasObjectLimit && Sample.LiveUObjectDeltaAfterGC > MaxLiveUObjectDelta;
+
+		const FString CsvPath = GetBenchmarkCsvPath();
+		FString CsvText;
+		if (!IFileManager::Get().FileExists(*CsvPath))
+		{
+			CsvText = TEXT("Timestamp,Test,Scenario,Operations,CpuMs,MsPerOp,MemoryDeltaKB,UObjectDelta,LiveUObjectDeltaAfterGC,GcMs,MaxMsPerOp,MaxLiveUObjectDelta,Result\n");
+		}
+
+		CsvText += FString::Printf(
+			TEXT("%s,%s,%s,%d,%.3f,%.5f,%lld,%d,%d,%.3f,%s,%s,%s\n"),
+			*FDateTime::UtcNow().ToIso8601(),
+			*Test.GetTestFullName(),
+			*Sample.Scenario,
+			Sample.OperationCount,
+			Sample.CpuMs,
+			Sample.MsPerOperation,
+			Sample.MemoryDeltaKB,
+			Sample.UObjectDelta,
+			Sample.LiveUObjectDeltaAfterGC,
+			Sample.GcMs,
+			bHasTimeLimit ? *FString::SanitizeFloat(MaxMsPerOperation) : TEXT(""),
+			bHasObjectLimit ? *FString::SanitizeFloat(MaxLiveUObjectDelta) : TEXT(""),
+			bTimeExceeded || bObjectsExceeded ? TEXT("fail") : TEXT("pass"));
+
+		if (!FFileHelper::SaveStringToFile(
+				CsvText,
+				*CsvPath,
+				FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+				&IFileManager::Get(),
+				FILEWRITE_Append))
+		{
+			Test.AddWarning(FString::Printf(TEXT("Could not write benchmark results to %s."), *CsvPath));
+		}
+
+		Test.AddInfo(FString::Printf(
+			TEXT("%s: %d op(s), %.3f ms (%.5f ms/op), %lld KB, %d UObject(s) created, %d alive after GC, GC %.3f ms."),
+			*Sample.Scenario,
+			Sample.OperationCount,
+			Sample.CpuMs,
+			Sample.MsPerOperation,
+			Sample.MemoryDeltaKB,
+			Sample.UObjectDelta,
+			Sample.LiveUObjectDeltaAfterGC,
+			Sample.GcMs));
+
+		if (bTimeExceeded)
+		{
+			Test.AddError(FString::Printf(
+				TEXT("%s regressed: %.5f ms/op exceeds the %.5f ms/op limit."),
+				*Sample.Scenario,
+				Sample.MsPerOperation,
+				MaxMsPerOperation));
+		}
+
+		if (bObjectsExceeded)
+		{
+			Test.AddError(FString::Printf(
+				TEXT("%s leaks: %d UObject(s) survived GC, limit %d."),
+				*Sample.Scenario,
+				Sample.LiveUObjectDeltaAfterGC,
+				static_cast<int32>(MaxLiveUObjectDelta)));
+		}
+	}
+
+	// Ticks Slate once so layout, list entry generation and widget ticks are part of the measurement.
+	void TickSlate()
+	{
+		if (FSlateApplication::IsInitialized())
+		{
+			FSlateApplication::Get().Tick();
+		}
+	}
+
+	APlayerController* FindBenchmarkPlayerController()
+	{
+		if (GEngine == nullptr)
+		{
+			return nullptr;
+		}
+
+		for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+		{
+			UWorld* const World = WorldContext.World();
+			if (World != nullptr
+				&& (WorldContext.WorldType == EWorldType::Game || WorldContext.WorldType == EWorldType::PIE)
+				&& World->GetFirstPlayerController() != nullptr)
+			{
+				return World->GetFirstPlayerController();
+			}
+		}
+
+		return nullptr;
+	}
+
+	bool ClickButton(FAutomationTestBase& Test, UUserWidget* Owner, const FName ButtonName)
+	{
+		UButton* const Button = Cast<UButton>(Owner->GetWidgetFromName(ButtonName));
+		if (Button == nullptr)
+		{
+			Test.AddError(FString::Printf(TEXT("%s has no button named %s."), *Owner->GetName(), *ButtonName.ToString()));
+			return false;
+		}
+
+		Button->OnClicked.Broadcast();
+		return true;
+	}
+
+	UMCPPopupWidget* FindOpenPopup(const UWorld* World, const bool bItemTilePopup)
+	{
+		for (TObjectIterator<UMCPPopupWidget> PopupIt; PopupIt; ++PopupIt)
+		{
+			UMCPPopupWidget* const Popup = *PopupIt;
+			if (Popup->GetWorld() == World
+				&& Popup->IsPopupOpen()
+				&& Popup->IsA<UMCPItemTilePopupWidget>() == bItemTilePopup)
+			{
+				return Popup;
+			}
+		}
+
+		return nullptr;
+	}
+
+	// A bottom button bar of its own, prewarmed so pooled popup creation stays out of the open/close numbers.
+	// Everything it adds to the viewport is removed again when the fixture goes out of scope.
+	class FMCPUIBenchmarkFixture
+	{
+	public:
+		explicit FMCPUIBenchmarkFixture(FAutomationTestBase& InTest)
+			: Test(InTest)
+		{
+			APlayerController* const PlayerController = FindBenchmarkPlayerController();
+			if (PlayerController == nullptr)
+			{
+				Test.AddError(TEXT("No game world with a player controller; run the MCPUI benchmarks in a -game session."));
+				return;
+			}
+
+			const TSubclassOf<UMCPBottomButtonBarWidget> BarClass =
+				LoadClass<UMCPBottomButtonBarWidget>(nullptr, BottomButtonBarClassPath);
+			if (BarClass == nullptr)
+			{
+				Test.AddError(FString::Printf(TEXT("Could not load %s."), BottomButtonBarClassPath));
+				return;
+			}
+
+			for (TObjectIterator<UMCPPopupWidget> PopupIt; PopupIt; ++PopupIt)
+			{
+				ExistingPopups.Add(*PopupIt);
+			}
+
+			World = PlayerController->GetWorld();
+			Bar.Reset(CreateWidget<UMCPBottomButtonBarWidget>(PlayerController, BarClass));
+			if (Bar == nullptr)
+			{
+				Test.AddError(TEXT("Could not create the bottom button bar."));
+				return;
+			}
+
+			Bar->AddToViewport();
+			Bar->PrewarmPopups();
+			TickSlate();
+		}
+
+		~FMCPUIBenchmarkFixture()
+		{
+			for (TObjectIterator<UMCPPopupWidget> PopupIt; PopupIt; ++PopupIt)
+			{
+				if (!ExistingPopups.Contains(*PopupIt))
+				{
+					PopupIt->RemoveFromParent();
+				}
+			}
+
+			if (Bar.IsValid())
+			{
+				Bar->RemoveFromParent();
+			}
+
+			Bar.Reset();
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+		}
+
+		bool IsValid() const
+		{
+			return Bar.IsValid();
+		}
+
+		// Clicks the bar's open button and returns the popup it showed; the lookup is left out of the timing.
+		UMCPPopupWidget* OpenPopup(FMCPUIBenchmarkScope& Scope, const bool bItemTilePopup)
+		{
+			Scope.Resume();
+			const bool bClicked = ClickButton(
+				Test,
+				Bar.Get(),
+				bItemTilePopup ? TEXT("TestTilePopupOpenButton") : TEXT("TestPopupOpenButton"));
+			Scope.Pause();
+
+			UMCPPopupWidget* const Popup = bClicked ? FindOpenPopup(World, bItemTilePopup) : nullptr;
+			if (bClicked && Popup == nullptr)
+			{
+				Test.AddError(TEXT("The open button did not show a popup."));
+			}
+
+			return Popup;
+		}
+
+	private:
+		FAutomationTestBase& Test;
+		UWorld* World = nullptr;
+		TStrongObjectPtr<UMCPBottomButtonBarWidget> Bar;
+		TSet<TWeakObjectPtr<UMCPPopupWidget>> ExistingPopups;
+	};
+
+	void RunPopupOpenCloseScenario(FAutomationTestBase& Test, FMCPUIBenchmarkFixture& Fixture, const bool bItemTilePopup)
+	{
+		int32 CycleCount = DefaultPopupCycleCount;
+		if (GConfig != nullptr)
+		{
+			GConfig->GetInt(BenchmarkConfigSection, TEXT("PopupCycleCount"), CycleCount, GGameIni);
+		}
+
+		FMCPUIBenchmarkScope Scope(bItemTilePopup ? TEXT("ItemTilePopupOpenClose") : TEXT("PopupOpenClose"));
+		int32 CompletedCycles = 0;
+		for (; CompletedCycles < CycleCount; ++CompletedCycles)
+		{
+			UMCPPopupWidget* const Popup = Fixture.OpenPopup(Scope, bItemTilePopup);
+			if (Popup == nullptr)
+			{
+				break;
+			}
+
+			Scope.Resume();
+
+			// Plays the open animation to the end at 60 Hz, as UMCPPopupAnimationSubsystem would across frames.
+			int32 AnimationTicks = 0;
+			while (AnimationTicks++ < MaxAnimationTicksPerOpen && Popup->TickOpenElasticScaleAnimation(SimulatedFrameDeltaTime))
+			{
+			}
+
+			TickSlate();
+			Popup->ClosePopup();
+			TickSlate();
+			Scope.Pause();
+		}
+
+		RecordBenchmarkSample(Test, Scope.Finish(CompletedCycles));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPUIPopupOpenCloseBenchmark,
+	"MCPUI.Benchmark.PopupOpenClose",
+	BenchmarkTestFlags)
+
+bool FMCPUIPopupOpenCloseBenchmark::RunTest(const FString& Parameters)
+{
+	FMCPUIBenchmarkFixture Fixture(*this);
+	if (!Fixture.IsValid())
+	{
+		return false;
+	}
+
+	RunPopupOpenCloseScenario(*this, Fixture, false);
+	RunPopupOpenCloseScenario(*this, Fixture, true);
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(
+	FMCPUITileListBenchmark,
+	"MCPUI.Benchmark.TileList",
+	BenchmarkTestFlags)
+
+void FMCPUITileListBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	const int32 ItemCounts[] = {10, 100, 1000, 10000, 100000};
+	for (const int32 ItemCount : ItemCounts)
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Items"), ItemCount));
+		OutTestCommands.Add(FString::FromInt(ItemCount));
+	}
+}
+
+bool FMCPUITileListBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 ItemCount = FCString::Atoi(*Parameters);
+	if (ItemCount <= 0)
+	{
+		AddError(FString::Printf(TEXT("Invalid item count: %s"), *Parameters));
+		return false;
+	}
+
+	int32 ScrollStepCount = DefaultScrollStepCount;
+	if (GConfig != nullptr)
+	{
+		GConfig->GetInt(BenchmarkConfigSection, TEXT("ScrollStepCount"), ScrollStepCount, GGameIni);
+	}
+
+	FMCPUIBenchmarkFixture Fixture(*this);
+	if (!Fixture.IsValid())
+	{
+		return false;
+	}
+
+	FMCPUIBenchmarkScope OpenScope(TEXT("TileListOpen"));
+	UMCPPopupWidget* const Popup = Fixture.OpenPopup(OpenScope, true);
+	UTileView* const TileView = Popup != nullptr ? Cast<UTileView>(Popup->GetWidgetFromName(TEXT("ItemTileView"))) : nullptr;
+	if (TileView == nullptr)
+	{
+		AddError(TEXT("The item tile popup has no ItemTileView."));
+		return false;
+	}
+
+	TickSlate();
+
+	// Data objects are created inside the timed region: the list pays for them in real use as well.
+	FMCPUIBenchmarkScope PopulateScope(FString::Printf(TEXT("TileListPopulate_%d"), ItemCount));
+	PopulateScope.Resume();
+	{
+		TArray<UObject*> Items;
+		Items.Reserve(ItemCount);
+		for (int32 ItemIndex = 0; ItemIndex < ItemCount; ++ItemIndex)
+		{
+			UMCPItemTileDataObject* const Item = NewObject<UMCPItemTileDataObject>(TileView);
+			Item->SetTileData(FName(TEXT("BenchmarkItem"), ItemIndex), TSoftObjectPtr<UTexture2D>(), ItemIndex % 100);
+			Items.Add(Item);
+		}
+
+		TileView->SetListItems(Items);
+	}
+	TickSlate();
+	PopulateScope.Pause();
+
+	// The GC here runs with every item still referenced by the list, so GcMs shows the cost of keeping them alive.
+	RecordBenchmarkSample(*this, PopulateScope.Finish(ItemCount));
+
+	// The tile view's scroll offset is measured in rows, not items.
+	const float ViewWidth = TileView->GetCachedGeometry().GetLocalSize().X;
+	const int32 TilesPerRow = TileView->GetEntryWidth() > 0.0f
+		? FMath::Max(FMath::FloorToInt(ViewWidth / TileView->GetEntryWidth()), 1)
+		: 1;
+	const int32 RowCount = FMath::DivideAndRoundUp(ItemCount, TilesPerRow);
+
+	FMCPUIBenchmarkScope ScrollScope(FString::Printf(TEXT("TileListScroll_%d"), ItemCount));
+	ScrollScope.Resume();
+	for (int32 StepIndex = 0; StepIndex <= ScrollStepCount; ++StepIndex)
+	{
+		TileView->SetScrollOffset(static_cast<float>(RowCount) * StepIndex / FMath::Max(ScrollStepCount, 1));
+		TickSlate();
+	}
+	ScrollScope.Pause();
+	RecordBenchmarkSample(*this, ScrollScope.Finish(ScrollStepCount + 1));
+
+	// Closing restores the default list; everything the benchmark created must be collectable afterwards.
+	FMCPUIBenchmarkScope ReleaseScope(FString::Printf(TEXT("TileListRelease_%d"), ItemCount));
+	ReleaseScope.Resume();
+	TileView->ClearListItems();
+	Popup->ClosePopup();
+	TickSlate();
+	ReleaseScope.Pause();
+	RecordBenchmarkSample(*this, ReleaseScope.Finish(ItemCount));
+
+	return !HasAnyErrors();
+}
+
+#endif
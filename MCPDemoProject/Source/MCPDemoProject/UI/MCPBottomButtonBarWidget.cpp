@@ -4,8 +4,35 @@
 
 #include "Components/Button.h"
 #include "GameFramework/PlayerController.h"
+#include "MCPDemoProject.h"
 #include "MCPPopupWidget.h"
 
+DECLARE_CYCLE_STAT(TEXT("Popup Open"), STAT_MCPPopupOpen, STATGROUP_MCPUI);
+DECLARE_CYCLE_STAT(TEXT("Popup Create"), STAT_MCPPopupCreate, STATGROUP_MCPUI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Popups"), STAT_MCPPooledPopups, STATGROUP_MCPUI);
+
+void UMCPBottomButtonBarWidget::PrewarmPopups()
+{
+	const TSubclassOf<UMCPPopupWidget> PrewarmClasses[] = {PopupWidgetClass, ItemTilePopupWidgetClass};
+	for (const TSubclassOf<UMCPPopupWidget>& PrewarmClass : PrewarmClasses)
+	{
+		if (PrewarmClass == nullptr)
+		{
+			continue;
+		}
+
+		const FMCPPopupWidgetPool* const ExistingPool = PopupWidgetPools.Find(PrewarmClass);
+		const int32 ExistingCount = ExistingPool != nullptr ? ExistingPool->Instances.Num() : 0;
+		for (int32 PrewarmIndex = ExistingCount; PrewarmIndex < PrewarmedPopupCount; ++PrewarmIndex)
+		{
+			if (CreatePooledPopupWidget(PrewarmClass) == nullptr)
+			{
+				break;
+			}
+		}
+	}
+}
+
 void UMCPBottomButtonBarWidget::NativeOnInitialized()
 {
 	Super::NativeOnInitialized();
@@ -25,7 +52,7 @@ void UMCPBottomButtonBarWidget::NativeOnInitialized()
 
 void UMCPBottomButtonBarWidget::HandleTestPopupOpenButtonClicked()
 {
-	if (ActivePopupWidget != nullptr && ActivePopupWidget->IsInViewport())
+	if (ActivePopupWidget != nullptr && ActivePopupWidget->IsPopupOpen())
 	{
 		return;
 	}
@@ -42,7 +69,7 @@ void UMCPBottomButtonBarWidget::HandleTestPopupOpenButtonClicked()
 
 void UMCPBottomButtonBarWidget::HandleTestTilePopupOpenButtonClicked()
 {
-	if (ActiveTilePopupWidget != nullptr && ActiveTilePopupWidget->IsInViewport())
+	if (ActiveTilePopupWidget != nullptr && ActiveTilePopupWidget->IsPopupOpen())
 	{
 		return;
 	}
@@ -57,13 +84,45 @@ void UMCPBottomButtonBarWidget::HandleTestTilePopupOpenButtonClicked()
 	ActiveTilePopupWidget = OpenPopupWidget(ItemTilePopupWidgetClass);
 }
 
-UMCPPopupWidget* UMCPBottomButtonBarWidget::OpenPopupWidget(const TSubclassOf<UMCPPopupWidget> InPopupWidgetClass) const
+UMCPPopupWidget* UMCPBottomButtonBarWidget::OpenPopupWidget(const TSubclassOf<UMCPPopupWidget> InPopupWidgetClass)
 {
+	SCOPE_CYCLE_COUNTER(STAT_MCPPopupOpen);
+
 	if (InPopupWidgetClass == nullptr)
 	{
 		return nullptr;
 	}
 
+	UMCPPopupWidget* PopupWidget = nullptr;
+	if (const FMCPPopupWidgetPool* const Pool = PopupWidgetPools.Find(InPopupWidgetClass))
+	{
+		for (UMCPPopupWidget* const PooledPopupWidget : Pool->Instances)
+		{
+			if (PooledPopupWidget != nullptr && PooledPopupWidget->IsInViewport() && !PooledPopupWidget->IsPopupOpen())
+			{
+				PopupWidget = PooledPopupWidget;
+				break;
+			}
+		}
+	}
+
+	if (PopupWidget == nullptr)
+	{
+		PopupWidget = CreatePooledPopupWidget(InPopupWidgetClass);
+	}
+
+	if (PopupWidget != nullptr)
+	{
+		PopupWidget->OpenPopup();
+	}
+
+	return PopupWidget;
+}
+
+UMCPPopupWidget* UMCPBottomButtonBarWidget::CreatePooledPopupWidget(const TSubclassOf<UMCPPopupWidget> InPopupWidgetClass)
+{
+	SCOPE_CYCLE_COUNTER(STAT_MCPPopupCreate);
+
 	APlayerController* OwningPlayer = GetOwningPlayer();
 	if (OwningPlayer == nullptr && GetWorld() != nullptr)
 	{
@@ -78,7 +137,11 @@ UMCPPopupWidget* UMCPBottomButtonBarWidget::OpenPopupWidget(const TSubclassOf<UM
 	UMCPPopupWidget* const PopupWidget = CreateWidget<UMCPPopupWidget>(OwningPlayer, InPopupWidgetClass);
 	if (PopupWidget != nullptr)
 	{
+		// Added collapsed so the widget tree and Slate construction are paid here rather than on open.
+		PopupWidget->SetVisibility(ESlateVisibility::Collapsed);
 		PopupWidget->AddToViewport(100);
+		PopupWidgetPools.FindOrAdd(InPopupWidgetClass).Instances.Add(PopupWidget);
+		INC_DWORD_STAT(STAT_MCPPooledPopups);
 	}
 
 	return PopupWidget;
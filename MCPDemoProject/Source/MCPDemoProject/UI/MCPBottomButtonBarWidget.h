@@ -10,11 +10,24 @@ class UButton;
 class UHorizontalBox;
 class UMCPPopupWidget;
 
+USTRUCT()
+struct FMCPPopupWidgetPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UMCPPopupWidget>> Instances;
+};
+
 UCLASS(BlueprintType, Blueprintable)
 class MCPDEMOPROJECT_API UMCPBottomButtonBarWidget : public UUserWidget
 {
 	GENERATED_BODY()
 
+public:
+	// Creates the configured popups ahead of time and parks them collapsed in the viewport.
+	void PrewarmPopups();
+
 protected:
 	virtual void NativeOnInitialized() override;
 
@@ -24,7 +37,8 @@ protected:
 	UFUNCTION()
 	void HandleTestTilePopupOpenButtonClicked();
 
-	UMCPPopupWidget* OpenPopupWidget(TSubclassOf<UMCPPopupWidget> InPopupWidgetClass) const;
+	UMCPPopupWidget* OpenPopupWidget(TSubclassOf<UMCPPopupWidget> InPopupWidgetClass);
+	UMCPPopupWidget* CreatePooledPopupWidget(TSubclassOf<UMCPPopupWidget> InPopupWidgetClass);
 
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Button Bar")
@@ -33,6 +47,10 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Button Bar")
 	TSubclassOf<UMCPPopupWidget> ItemTilePopupWidgetClass;
 
+	// Instances created per popup class by PrewarmPopups.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Button Bar", meta = (ClampMin = "0", UIMin = "0"))
+	int32 PrewarmedPopupCount = 1;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Button Bar", meta = (BindWidgetOptional))
 	TObjectPtr<UHorizontalBox> ButtonContainer = nullptr;
 
@@ -47,4 +65,8 @@ protected:
 
 	UPROPERTY(Transient)
 	TObjectPtr<UMCPPopupWidget> ActiveTilePopupWidget = nullptr;
+
+	// Every popup created by this bar, open or closed, keyed by class.
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<UMCPPopupWidget>, FMCPPopupWidgetPool> PopupWidgetPools;
 };
@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MCPIconAtlasData.h"
+
+#include "Engine/Texture2D.h"
+#include "Styling/SlateBrush.h"
+
+void UMCPIconAtlasData::PostLoad()
+{
+	Super::PostLoad();
+
+	bEntryLookupValid = false;
+}
+
+#if WITH_EDITOR
+void UMCPIconAtlasData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	bEntryLookupValid = false;
+}
+#endif
+
+const FMCPIconAtlasEntry* UMCPIconAtlasData::FindIcon(const FName IconId) const
+{
+	if (IconId.IsNone())
+	{
+		return nullptr;
+	}
+
+	if (!bEntryLookupValid)
+	{
+		RebuildEntryLookup();
+	}
+
+	const int32* const EntryIndex = EntryIndexById.Find(IconId);
+	return EntryIndex != nullptr && Entries.IsValidIndex(*EntryIndex) ? &Entries[*EntryIndex] : nullptr;
+}
+
+UTexture2D* UMCPIconAtlasData::GetPageTexture(const int32 PageIndex) const
+{
+	return Pages.IsValidIndex(PageIndex) ? Pages[PageIndex].Get() : nullptr;
+}
+
+bool UMCPIconAtlasData::HasIcon(const FName IconId) const
+{
+	const FMCPIconAtlasEntry* const Entry = FindIcon(IconId);
+	return Entry != nullptr && GetPageTexture(Entry->PageIndex) != nullptr;
+}
+
+bool UMCPIconAtlasData::MakeIconBrush(const FName IconId, FSlateBrush& OutBrush) const
+{
+	const FMCPIconAtlasEntry* const Entry = FindIcon(IconId);
+	if (Entry == nullptr)
+	{
+		return false;
+	}
+
+	UTexture2D* const PageTexture = GetPageTexture(Entry->PageIndex);
+	if (PageTexture == nullptr)
+	{
+		return false;
+	}
+
+	OutBrush = FSlateBrush();
+	OutBrush.SetResourceObject(PageTexture);
+	OutBrush.ImageSize = FVector2D(Entry->PixelSize);
+	OutBrush.SetUVRegion(FBox2f(FVector2f(Entry->UVMin), FVector2f(Entry->UVMax)));
+	return true;
+}
+
+void UMCPIconAtlasData::RebuildEntryLookup() const
+{
+	EntryIndexById.Reset();
+	EntryIndexById.Reserve(Entries.Num());
+
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		const FName IconId = Entries[EntryIndex].IconId;
+		if (!IconId.IsNone() && !EntryIndexById.Contains(IconId))
+		{
+			EntryIndexById.Add(IconId, EntryIndex);
+		}
+	}
+
+	bEntryLookupValid = true;
+}
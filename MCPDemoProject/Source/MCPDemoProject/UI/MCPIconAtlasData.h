@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "MCPIconAtlasData.generated.h"
+
+class UTexture2D;
+struct FSlateBrush;
+
+USTRUCT(BlueprintType)
+struct MCPDEMOPROJECT_API FMCPIconAtlasEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Icon Atlas")
+	FName IconId = NAME_None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Icon Atlas")
+	int32 PageIndex = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Icon Atlas")
+	FVector2D UVMin = FVector2D::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Icon Atlas")
+	FVector2D UVMax = FVector2D::UnitVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Icon Atlas")
+	FIntPoint PixelSize = FIntPoint::ZeroValue;
+};
+
+UCLASS(BlueprintType)
+class MCPDEMOPROJECT_API UMCPIconAtlasData : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	const FMCPIconAtlasEntry* FindIcon(FName IconId) const;
+	UTexture2D* GetPageTexture(int32 PageIndex) const;
+
+	// True when MakeIconBrush can draw the icon, so the icon's own texture is never shown.
+	bool HasIcon(FName IconId) const;
+
+	// Fills OutBrush with the atlas page and the icon's UV region; returns false when the icon is not in the atlas.
+	bool MakeIconBrush(FName IconId, FSlateBrush& OutBrush) const;
+
+protected:
+	void RebuildEntryLookup() const;
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Icon Atlas")
+	TArray<TObjectPtr<UTexture2D>> Pages;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Icon Atlas")
+	TArray<FMCPIconAtlasEntry> Entries;
+
+private:
+	mutable TMap<FName, int32> EntryIndexById;
+	mutable bool bEntryLookupValid = false;
+};
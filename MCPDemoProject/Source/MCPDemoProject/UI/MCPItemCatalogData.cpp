@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MCPItemCatalogData.h"
+
+#include "Engine/Texture2D.h"
+
+namespace
+{
+	struct FMCPBuiltInItemSpec
+	{
+		const TCHAR* TextureObjectPath;
+		int32 DefaultQuantity;
+	};
+
+	static const FMCPBuiltInItemSpec GMCPBuiltInItemSpecs[] = {
+		{TEXT("/Game/UI/Image/T_BentoBox.T_BentoBox"), 3},
+		{TEXT("/Game/UI/Image/T_CuteChefHat.T_CuteChefHat"), 1},
+		{TEXT("/Game/UI/Image/T_FruitTart.T_FruitTart"), 5},
+		{TEXT("/Game/UI/Image/T_HeartShapedCookie.T_HeartShapedCookie"), 7},
+		{TEXT("/Game/UI/Image/T_MagicSpoon.T_MagicSpoon"), 2},
+		{TEXT("/Game/UI/Image/T_MilkCartonWithCatFace.T_MilkCartonWithCatFace"), 4},
+		{TEXT("/Game/UI/Image/T_MiniOven.T_MiniOven"), 1},
+		{TEXT("/Game/UI/Image/T_PancakeStack.T_PancakeStack"), 6},
+		{TEXT("/Game/UI/Image/T_PastelMacaron.T_PastelMacaron"), 8},
+		{TEXT("/Game/UI/Image/T_PinkWhisk.T_PinkWhisk"), 2},
+		{TEXT("/Game/UI/Image/T_Pudding.T_Pudding"), 9},
+		{TEXT("/Game/UI/Image/T_RainbowDonut.T_RainbowDonut"), 4},
+		{TEXT("/Game/UI/Image/T_RecipeBookWithRibbon.T_RecipeBookWithRibbon"), 1},
+		{TEXT("/Game/UI/Image/T_StarCandyJar.T_StarCandyJar"), 3},
+		{TEXT("/Game/UI/Image/T_StrawberryCake.T_StrawberryCake"), 5},
+		{TEXT("/Game/UI/Image/T_TeaCupWithBearFace.T_TeaCupWithBearFace"), 2},
+	};
+}
+
+const FPrimaryAssetType UMCPItemCatalogData::PrimaryAssetType(TEXT("MCPItemCatalog"));
+
+UMCPItemCatalogData* UMCPItemCatalogData::CreateBuiltInCatalog(UObject* Outer)
+{
+	UMCPItemCatalogData* const Catalog = NewObject<UMCPItemCatalogData>(Outer, NAME_None, RF_Transient);
+
+	Catalog->Items.Reserve(UE_ARRAY_COUNT(GMCPBuiltInItemSpecs));
+	for (const FMCPBuiltInItemSpec& ItemSpec : GMCPBuiltInItemSpecs)
+	{
+		const FSoftObjectPath TexturePath(ItemSpec.TextureObjectPath);
+
+		FMCPItemCatalogEntry& Item = Catalog->Items.AddDefaulted_GetRef();
+		Item.ItemId = FName(*TexturePath.GetAssetName());
+		Item.Icon = TSoftObjectPtr<UTexture2D>(TexturePath);
+		Item.DefaultQuantity = ItemSpec.DefaultQuantity;
+	}
+
+	return Catalog;
+}
+
+FPrimaryAssetId UMCPItemCatalogData::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(PrimaryAssetType, GetFName());
+}
@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "UObject/SoftObjectPtr.h"
+#include "MCPItemCatalogData.generated.h"
+
+class UTexture2D;
+
+USTRUCT(BlueprintType)
+struct MCPDEMOPROJECT_API FMCPItemCatalogEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item Catalog")
+	FName ItemId = NAME_None;
+
+	// Soft so the catalog can list every item without loading its icon.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item Catalog")
+	TSoftObjectPtr<UTexture2D> Icon;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item Catalog", meta = (ClampMin = "0", UIMin = "0"))
+	int32 DefaultQuantity = 1;
+};
+
+UCLASS(BlueprintType)
+class MCPDEMOPROJECT_API UMCPItemCatalogData : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	static const FPrimaryAssetType PrimaryAssetType;
+
+	// Builds a transient catalog of the demo's own items, used when no catalog asset is assigned.
+	static UMCPItemCatalogData* CreateBuiltInCatalog(UObject* Outer);
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	const TArray<FMCPItemCatalogEntry>& GetItems() const
+	{
+		return Items;
+	}
+
+	int32 GetItemCount() const
+	{
+		return Items.Num();
+	}
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item Catalog")
+	TArray<FMCPItemCatalogEntry> Items;
+};
@@ -2,9 +2,27 @@
 
 #include "MCPItemTileDataObject.h"
 
-void UMCPItemTileDataObject::SetTileData(const FName InItemId, UTexture2D* InItemTexture, const int32 InQuantity)
+#include "Engine/Texture2D.h"
+
+void UMCPItemTileDataObject::SetTileData(const FName InItemId, const TSoftObjectPtr<UTexture2D>& InItemTexture, const int32 InQuantity)
 {
 	ItemId = InItemId;
 	ItemTexture = InItemTexture;
 	Quantity = FMath::Max(InQuantity, 0);
+
+	// Already-resident textures are picked up by the entry on its first refresh; no load event is needed.
+	bItemTextureLoadNotified = ItemTexture.Get() != nullptr;
+
+	TileDataChangedEvent.Broadcast();
+}
+
+void UMCPItemTileDataObject::NotifyItemTextureLoaded()
+{
+	if (bItemTextureLoadNotified || ItemTexture.Get() == nullptr)
+	{
+		return;
+	}
+
+	bItemTextureLoadNotified = true;
+	ItemTextureLoadedEvent.Broadcast();
 }
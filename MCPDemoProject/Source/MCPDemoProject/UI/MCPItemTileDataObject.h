@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "UObject/SoftObjectPtr.h"
 #include "MCPItemTileDataObject.generated.h"
 
 class UTexture2D;
@@ -14,7 +15,21 @@ class MCPDEMOPROJECT_API UMCPItemTileDataObject : public UObject
 	GENERATED_BODY()
 
 public:
-	void SetTileData(const FName InItemId, UTexture2D* InItemTexture, const int32 InQuantity);
+	void SetTileData(const FName InItemId, const TSoftObjectPtr<UTexture2D>& InItemTexture, const int32 InQuantity);
+
+	// Fires on every SetTileData so entries still bound to a recycled data object redraw its new contents.
+	FSimpleMulticastDelegate& OnTileDataChanged()
+	{
+		return TileDataChangedEvent;
+	}
+
+	// Broadcasts OnItemTextureLoaded the first time the soft texture resolves after SetTileData.
+	void NotifyItemTextureLoaded();
+
+	FSimpleMulticastDelegate& OnItemTextureLoaded()
+	{
+		return ItemTextureLoadedEvent;
+	}
 
 	UFUNCTION(BlueprintPure, Category = "Item Tile")
 	FName GetItemId() const
@@ -22,8 +37,15 @@ public:
 		return ItemId;
 	}
 
+	// Null until the texture has streamed in.
 	UFUNCTION(BlueprintPure, Category = "Item Tile")
 	UTexture2D* GetItemTexture() const
+	{
+		return ItemTexture.Get();
+	}
+
+	UFUNCTION(BlueprintPure, Category = "Item Tile")
+	TSoftObjectPtr<UTexture2D> GetItemTextureRef() const
 	{
 		return ItemTexture;
 	}
@@ -39,8 +61,13 @@ private:
 	FName ItemId = NAME_None;
 
 	UPROPERTY(Transient)
-	TObjectPtr<UTexture2D> ItemTexture = nullptr;
+	TSoftObjectPtr<UTexture2D> ItemTexture;
 
 	UPROPERTY(Transient)
 	int32 Quantity = 0;
+
+	bool bItemTextureLoadNotified = false;
+
+	FSimpleMulticastDelegate TileDataChangedEvent;
+	FSimpleMulticastDelegate ItemTextureLoadedEvent;
 };
@@ -4,22 +4,132 @@
 
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
+#include "MCPDemoProject.h"
+#include "MCPIconAtlasData.h"
 #include "MCPItemTileDataObject.h"
 
+DECLARE_CYCLE_STAT(TEXT("Tile Entry Refresh"), STAT_MCPTileEntryRefresh, STATGROUP_MCPUI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tile Entry Refreshes Skipped"), STAT_MCPTileEntryRefreshesSkipped, STATGROUP_MCPUI);
+
+namespace
+{
+	constexpr int32 MCPCachedQuantityTextCount = 100;
+
+	// "x0" through "x99" are built once and shared by every entry; FText copies only bump a reference count.
+	FText GetQuantityText(const int32 Quantity)
+	{
+		static TArray<FText> CachedQuantityTexts;
+		if (CachedQuantityTexts.IsEmpty())
+		{
+			CachedQuantityTexts.Reserve(MCPCachedQuantityTextCount);
+			for (int32 CachedQuantity = 0; CachedQuantity < MCPCachedQuantityTextCount; ++CachedQuantity)
+			{
+				CachedQuantityTexts.Add(FText::FromString(FString::Printf(TEXT("x%d"), CachedQuantity)));
+			}
+		}
+
+		return CachedQuantityTexts.IsValidIndex(Quantity)
+			? CachedQuantityTexts[Quantity]
+			: FText::FromString(FString::Printf(TEXT("x%d"), Quantity));
+	}
+}
+
 void UMCPItemTileEntryWidget::NativeOnListItemObjectSet(UObject* ListItemObject)
 {
-	const UMCPItemTileDataObject* const TileItem = Cast<UMCPItemTileDataObject>(ListItemObject);
+	BindTileItem(Cast<UMCPItemTileDataObject>(ListItemObject));
+	RefreshTileEntry();
+
+	IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
+}
+
+void UMCPItemTileEntryWidget::NativeOnEntryReleased()
+{
+	UnbindTileItem();
+
+	IUserObjectListEntry::NativeOnEntryReleased();
+}
+
+void UMCPItemTileEntryWidget::BindTileItem(UMCPItemTileDataObject* TileItem)
+{
+	if (BoundTileItem.Get() == TileItem)
+	{
+		return;
+	}
+
+	UnbindTileItem();
 
-	if (ItemImage != nullptr)
+	if (TileItem != nullptr)
 	{
-		ItemImage->SetBrushFromTexture(TileItem != nullptr ? TileItem->GetItemTexture() : nullptr, true);
+		BoundTileItem = TileItem;
+		TileDataChangedHandle = TileItem->OnTileDataChanged().AddUObject(this, &UMCPItemTileEntryWidget::RefreshTileEntry);
+		ItemTextureLoadedHandle = TileItem->OnItemTextureLoaded().AddUObject(this, &UMCPItemTileEntryWidget::RefreshItemImage);
 	}
+}
+
+void UMCPItemTileEntryWidget::UnbindTileItem()
+{
+	if (UMCPItemTileDataObject* const TileItem = BoundTileItem.Get())
+	{
+		TileItem->OnTileDataChanged().Remove(TileDataChangedHandle);
+		TileItem->OnItemTextureLoaded().Remove(ItemTextureLoadedHandle);
+	}
+
+	BoundTileItem.Reset();
+	TileDataChangedHandle.Reset();
+	ItemTextureLoadedHandle.Reset();
+}
+
+void UMCPItemTileEntryWidget::RefreshTileEntry()
+{
+	SCOPE_CYCLE_COUNTER(STAT_MCPTileEntryRefresh);
+
+	RefreshItemImage();
 
 	if (QuantityText != nullptr)
 	{
+		const UMCPItemTileDataObject* const TileItem = BoundTileItem.Get();
 		const int32 Quantity = TileItem != nullptr ? TileItem->GetQuantity() : 0;
-		QuantityText->SetText(FText::FromString(FString::Printf(TEXT("x%d"), Quantity)));
+		if (Quantity != DisplayedQuantity)
+		{
+			DisplayedQuantity = Quantity;
+			QuantityText->SetText(GetQuantityText(Quantity));
+		}
 	}
+}
 
-	IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
+void UMCPItemTileEntryWidget::RefreshItemImage()
+{
+	if (ItemImage == nullptr)
+	{
+		return;
+	}
+
+	const UMCPItemTileDataObject* const TileItem = BoundTileItem.Get();
+	const FName ItemId = TileItem != nullptr ? TileItem->GetItemId() : NAME_None;
+	UTexture2D* const ItemTexture = TileItem != nullptr ? TileItem->GetItemTexture() : nullptr;
+	if (bItemImageDisplayed && DisplayedItemId == ItemId && DisplayedItemTexture.Get() == ItemTexture)
+	{
+		INC_DWORD_STAT(STAT_MCPTileEntryRefreshesSkipped);
+		return;
+	}
+
+	bItemImageDisplayed = true;
+	DisplayedItemId = ItemId;
+	DisplayedItemTexture = ItemTexture;
+
+	FSlateBrush AtlasBrush;
+	if (TileItem != nullptr && IconAtlas != nullptr && IconAtlas->MakeIconBrush(ItemId, AtlasBrush))
+	{
+		ItemImage->SetBrush(AtlasBrush);
+		return;
+	}
+
+	if (ItemTexture != nullptr)
+	{
+		ItemImage->SetBrushFromTexture(ItemTexture, true);
+	}
+	else
+	{
+		ItemImage->SetBrush(PlaceholderBrush);
+	}
 }
@@ -8,7 +8,10 @@
 #include "MCPItemTileEntryWidget.generated.h"
 
 class UImage;
+class UMCPIconAtlasData;
+class UMCPItemTileDataObject;
 class UTextBlock;
+class UTexture2D;
 class UObject;
 
 UCLASS(BlueprintType, Blueprintable)
@@ -16,12 +19,44 @@ class MCPDEMOPROJECT_API UMCPItemTileEntryWidget : public UUserWidget, public IU
 {
 	GENERATED_BODY()
 
+public:
+	UMCPIconAtlasData* GetIconAtlas() const
+	{
+		return IconAtlas;
+	}
+
 protected:
 	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+	virtual void NativeOnEntryReleased() override;
+
+	void BindTileItem(UMCPItemTileDataObject* TileItem);
+	void UnbindTileItem();
+	void RefreshTileEntry();
+	void RefreshItemImage();
+
+	// When set, icons found in the atlas are drawn from its shared page texture instead of the per-item texture.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item Tile")
+	TObjectPtr<UMCPIconAtlasData> IconAtlas = nullptr;
+
+	// Shown while the item's texture is still streaming in.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item Tile")
+	FSlateBrush PlaceholderBrush;
 
 	UPROPERTY(BlueprintReadOnly, Category = "Item Tile", meta = (BindWidgetOptional))
 	TObjectPtr<UImage> ItemImage = nullptr;
 
 	UPROPERTY(BlueprintReadOnly, Category = "Item Tile", meta = (BindWidgetOptional))
 	TObjectPtr<UTextBlock> QuantityText = nullptr;
+
+private:
+	TWeakObjectPtr<UMCPItemTileDataObject> BoundTileItem;
+
+	// What the widgets currently show, so recycling an entry for identical data touches neither text nor layout.
+	bool bItemImageDisplayed = false;
+	FName DisplayedItemId = NAME_None;
+	TWeakObjectPtr<UTexture2D> DisplayedItemTexture;
+	int32 DisplayedQuantity = INDEX_NONE;
+
+	FDelegateHandle TileDataChangedHandle;
+	FDelegateHandle ItemTextureLoadedHandle;
 };
@@ -5,36 +5,25 @@
 #include "Components/Button.h"
 #include "Components/TextBlock.h"
 #include "Components/TileView.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Engine/Texture2D.h"
+#include "MCPDemoProject.h"
+#include "MCPIconAtlasData.h"
+#include "MCPItemCatalogData.h"
 #include "MCPItemTileDataObject.h"
-#include "Misc/PackageName.h"
-
-namespace
-{
-	struct FMCPHardcodedTileItemSpec
-	{
-		const TCHAR* TextureObjectPath;
-		int32 DefaultQuantity;
-	};
-
-	static const FMCPHardcodedTileItemSpec GMCPHardcodedTileItemSpecs[] = {
-		{TEXT("/Game/UI/Image/T_BentoBox.T_BentoBox"), 3},
-		{TEXT("/Game/UI/Image/T_CuteChefHat.T_CuteChefHat"), 1},
-		{TEXT("/Game/UI/Image/T_FruitTart.T_FruitTart"), 5},
-		{TEXT("/Game/UI/Image/T_HeartShapedCookie.T_HeartShapedCookie"), 7},
-		{TEXT("/Game/UI/Image/T_MagicSpoon.T_MagicSpoon"), 2},
-		{TEXT("/Game/UI/Image/T_MilkCartonWithCatFace.T_MilkCartonWithCatFace"), 4},
-		{TEXT("/Game/UI/Image/T_MiniOven.T_MiniOven"), 1},
-		{TEXT("/Game/UI/Image/T_PancakeStack.T_PancakeStack"), 6},
-		{TEXT("/Game/UI/Image/T_PastelMacaron.T_PastelMacaron"), 8},
-		{TEXT("/Game/UI/Image/T_PinkWhisk.T_PinkWhisk"), 2},
-		{TEXT("/Game/UI/Image/T_Pudding.T_Pudding"), 9},
-		{TEXT("/Game/UI/Image/T_RainbowDonut.T_RainbowDonut"), 4},
-		{TEXT("/Game/UI/Image/T_RecipeBookWithRibbon.T_RecipeBookWithRibbon"), 1},
-		{TEXT("/Game/UI/Image/T_StarCandyJar.T_StarCandyJar"), 3},
-		{TEXT("/Game/UI/Image/T_StrawberryCake.T_StrawberryCake"), 5},
-		{TEXT("/Game/UI/Image/T_TeaCupWithBearFace.T_TeaCupWithBearFace"), 2},
-	};
+#include "MCPItemTileEntryWidget.h"
+
+DECLARE_CYCLE_STAT(TEXT("Tile List Rebuild"), STAT_MCPTileListRebuild, STATGROUP_MCPUI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tile Data Pool Hits"), STAT_MCPTileDataPoolHits, STATGROUP_MCPUI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tile Data Pool Misses"), STAT_MCPTileDataPoolMisses, STATGROUP_MCPUI);
+
+void UMCPItemTilePopupWidget::ResetPopupState()
+{
+	Super::ResetPopupState();
+
+	// The next open shows the default list; rows that survive the diff keep their entries and textures.
+	PopulateDefaultItems();
 }
 
 void UMCPItemTilePopupWidget::NativeOnInitialized()
@@ -66,6 +55,13 @@ void UMCPItemTilePopupWidget::NativeConstruct()
 	PopulateDefaultItems();
 }
 
+void UMCPItemTilePopupWidget::NativeDestruct()
+{
+	CancelItemTextureRequest();
+
+	Super::NativeDestruct();
+}
+
 void UMCPItemTilePopupWidget::HandleClearButtonClicked()
 {
 	ClearItems();
@@ -78,9 +74,12 @@ void UMCPItemTilePopupWidget::HandleRandomizeButtonClicked()
 
 void UMCPItemTilePopupWidget::PopulateDefaultItems()
 {
+	const UMCPItemCatalogData* const Catalog = ResolveItemCatalog();
+	const int32 ItemCount = Catalog != nullptr ? FMath::Min(Catalog->GetItemCount(), MaxListedItems) : 0;
+
 	TArray<int32> ItemIndices;
-	ItemIndices.Reserve(UE_ARRAY_COUNT(GMCPHardcodedTileItemSpecs));
-	for (int32 ItemIndex = 0; ItemIndex < UE_ARRAY_COUNT(GMCPHardcodedTileItemSpecs); ++ItemIndex)
+	ItemIndices.Reserve(ItemCount);
+	for (int32 ItemIndex = 0; ItemIndex < ItemCount; ++ItemIndex)
 	{
 		ItemIndices.Add(ItemIndex);
 	}
@@ -90,28 +89,41 @@ void UMCPItemTilePopupWidget::PopulateDefaultItems()
 
 void UMCPItemTilePopupWidget::PopulateRandomizedItems()
 {
-	TArray<int32> ItemIndices;
-	ItemIndices.Reserve(UE_ARRAY_COUNT(GMCPHardcodedTileItemSpecs));
-	for (int32 ItemIndex = 0; ItemIndex < UE_ARRAY_COUNT(GMCPHardcodedTileItemSpecs); ++ItemIndex)
+	const UMCPItemCatalogData* const Catalog = ResolveItemCatalog();
+	const int32 CatalogCount = Catalog != nullptr ? Catalog->GetItemCount() : 0;
+	const int32 ListedCount = FMath::Min(CatalogCount, MaxListedItems);
+	if (ListedCount <= 0)
 	{
-		ItemIndices.Add(ItemIndex);
+		ClearItems();
+		return;
+	}
+
+	const int32 RandomCount = FMath::RandRange(FMath::Min(12, ListedCount), ListedCount);
+
+	// Floyd's sampling picks distinct catalog indices without building an index array the size of the catalog.
+	TSet<int32> PickedIndices;
+	PickedIndices.Reserve(RandomCount);
+	for (int32 CandidateIndex = CatalogCount - RandomCount; CandidateIndex < CatalogCount; ++CandidateIndex)
+	{
+		const int32 PickedIndex = FMath::RandRange(0, CandidateIndex);
+		PickedIndices.Add(PickedIndices.Contains(PickedIndex) ? CandidateIndex : PickedIndex);
 	}
 
+	TArray<int32> ItemIndices = PickedIndices.Array();
 	for (int32 ItemIndex = ItemIndices.Num() - 1; ItemIndex > 0; --ItemIndex)
 	{
 		const int32 SwapIndex = FMath::RandRange(0, ItemIndex);
 		ItemIndices.Swap(ItemIndex, SwapIndex);
 	}
 
-	const int32 RandomCount = FMath::RandRange(12, ItemIndices.Num());
-	ItemIndices.SetNum(RandomCount);
-
 	RebuildItemsFromIndices(ItemIndices, true);
 }
 
 void UMCPItemTilePopupWidget::ClearItems()
 {
-	TileItems.Empty();
+	CancelItemTextureRequest();
+	PooledTileItems.Append(TileItems);
+	TileItems.Reset();
 
 	if (ItemTileView != nullptr)
 	{
@@ -119,46 +131,183 @@ void UMCPItemTilePopupWidget::ClearItems()
 	}
 }
 
+const UMCPItemCatalogData* UMCPItemTilePopupWidget::ResolveItemCatalog()
+{
+	if (ItemCatalog != nullptr)
+	{
+		return ItemCatalog;
+	}
+
+	if (FallbackItemCatalog == nullptr)
+	{
+		FallbackItemCatalog = UMCPItemCatalogData::CreateBuiltInCatalog(this);
+	}
+
+	return FallbackItemCatalog;
+}
+
 void UMCPItemTilePopupWidget::RebuildItemsFromIndices(const TArray<int32>& ItemIndices, const bool bUseRandomQuantities)
 {
-	ClearItems();
+	SCOPE_CYCLE_COUNTER(STAT_MCPTileListRebuild);
 
+	const UMCPItemCatalogData* const Catalog = ResolveItemCatalog();
+	if (Catalog == nullptr || ItemTileView == nullptr)
+	{
+		ClearItems();
+		return;
+	}
+
+	// Rows whose item id survives keep their data object, so the tile view keeps their entry widgets as well.
+	TMap<FName, UMCPItemTileDataObject*> ExistingTileItemsById;
+	ExistingTileItemsById.Reserve(TileItems.Num());
+	for (UMCPItemTileDataObject* const TileItem : TileItems)
+	{
+		if (TileItem != nullptr)
+		{
+			ExistingTileItemsById.Add(TileItem->GetItemId(), TileItem);
+		}
+	}
+
+	const TArray<FMCPItemCatalogEntry>& CatalogItems = Catalog->GetItems();
+	TArray<TObjectPtr<UMCPItemTileDataObject>> NewTileItems;
+	NewTileItems.Reserve(ItemIndices.Num());
 	for (const int32 ItemIndex : ItemIndices)
 	{
-		if (!GMCPHardcodedTileItemSpecs[ItemIndex].TextureObjectPath)
+		if (!CatalogItems.IsValidIndex(ItemIndex) || CatalogItems[ItemIndex].ItemId.IsNone())
 		{
 			continue;
 		}
 
-		const int32 Quantity = bUseRandomQuantities
-			? FMath::RandRange(1, 99)
-			: GMCPHardcodedTileItemSpecs[ItemIndex].DefaultQuantity;
-		AddItemFromTexturePath(GMCPHardcodedTileItemSpecs[ItemIndex].TextureObjectPath, Quantity);
+		const FMCPItemCatalogEntry& CatalogItem = CatalogItems[ItemIndex];
+		const int32 Quantity = bUseRandomQuantities ? FMath::RandRange(1, 99) : CatalogItem.DefaultQuantity;
+
+		UMCPItemTileDataObject* TileItem = nullptr;
+		if (ExistingTileItemsById.RemoveAndCopyValue(CatalogItem.ItemId, TileItem))
+		{
+			// Unchanged rows are left alone; changed ones notify only their own entry.
+			if (TileItem->GetQuantity() != Quantity || TileItem->GetItemTextureRef() != CatalogItem.Icon)
+			{
+				TileItem->SetTileData(CatalogItem.ItemId, CatalogItem.Icon, Quantity);
+			}
+		}
+		else
+		{
+			TileItem = AcquireTileItem();
+			if (TileItem == nullptr)
+			{
+				continue;
+			}
+
+			// The tile is listed straight away; its entry shows the placeholder brush until RequestItemTextures resolves it.
+			TileItem->SetTileData(CatalogItem.ItemId, CatalogItem.Icon, Quantity);
+		}
+
+		NewTileItems.Add(TileItem);
+	}
+
+	for (const TPair<FName, UMCPItemTileDataObject*>& RemovedTileItem : ExistingTileItemsById)
+	{
+		PooledTileItems.Add(RemovedTileItem.Value);
 	}
+
+	TileItems = MoveTemp(NewTileItems);
+
+	// One list assignment and one refresh, rather than a refresh request per added item.
+	ItemTileView->SetListItems(TileItems);
+
+	RequestItemTextures();
 }
 
-void UMCPItemTilePopupWidget::AddItemFromTexturePath(const TCHAR* TextureObjectPath, const int32 Quantity)
+UMCPItemTileDataObject* UMCPItemTilePopupWidget::AcquireTileItem()
 {
-	if (ItemTileView == nullptr || TextureObjectPath == nullptr || TextureObjectPath[0] == 0)
+	while (!PooledTileItems.IsEmpty())
 	{
-		return;
+		if (UMCPItemTileDataObject* const TileItem = PooledTileItems.Pop(EAllowShrinking::No))
+		{
+			INC_DWORD_STAT(STAT_MCPTileDataPoolHits);
+			return TileItem;
+		}
 	}
 
-	UTexture2D* const ItemTexture = LoadObject<UTexture2D>(nullptr, TextureObjectPath);
-	if (ItemTexture == nullptr)
+	INC_DWORD_STAT(STAT_MCPTileDataPoolMisses);
+	return NewObject<UMCPItemTileDataObject>(this);
+}
+
+const UMCPIconAtlasData* UMCPItemTilePopupWidget::ResolveEntryIconAtlas() const
+{
+	const TSubclassOf<UUserWidget> EntryWidgetClass = ItemTileView != nullptr ? ItemTileView->GetEntryWidgetClass() : nullptr;
+	const UMCPItemTileEntryWidget* const EntryDefaults =
+		EntryWidgetClass != nullptr ? Cast<UMCPItemTileEntryWidget>(EntryWidgetClass->GetDefaultObject()) : nullptr;
+	return EntryDefaults != nullptr ? EntryDefaults->GetIconAtlas() : nullptr;
+}
+
+void UMCPItemTilePopupWidget::RequestItemTextures()
+{
+	// Entries draw atlas-covered icons from the atlas page, so streaming their own textures would only cost memory and I/O.
+	const UMCPIconAtlasData* const IconAtlas = ResolveEntryIconAtlas();
+
+	TileItemsByTexturePath.Reset();
+	for (UMCPItemTileDataObject* const TileItem : TileItems)
 	{
-		return;
+		if (TileItem != nullptr
+			&& !TileItem->GetItemTextureRef().IsNull()
+			&& (IconAtlas == nullptr || !IconAtlas->HasIcon(TileItem->GetItemId())))
+		{
+			TileItemsByTexturePath.Add(TileItem->GetItemTextureRef().ToSoftObjectPath(), TileItem);
+		}
 	}
 
-	UMCPItemTileDataObject* const TileItem = NewObject<UMCPItemTileDataObject>(this);
-	if (TileItem == nullptr)
+	// Requests for textures that are still listed carry over, so surviving rows keep theirs resident; a carried
+	// over request that is still in flight notifies whichever tiles show the texture when it completes.
+	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> PreviousLoadHandles = MoveTemp(ItemTextureLoadHandles);
+	ItemTextureLoadHandles.Reset();
+
+	TArray<FSoftObjectPath> TexturePaths;
+	TileItemsByTexturePath.GetKeys(TexturePaths);
+	ItemTextureLoadHandles.Reserve(TexturePaths.Num());
+	for (const FSoftObjectPath& TexturePath : TexturePaths)
 	{
-		return;
+		TSharedPtr<FStreamableHandle> LoadHandle;
+		if (!PreviousLoadHandles.RemoveAndCopyValue(TexturePath, LoadHandle))
+		{
+			LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+				TexturePath,
+				FStreamableDelegate::CreateUObject(this, &UMCPItemTilePopupWidget::HandleItemTextureLoaded, TexturePath));
+		}
+
+		ItemTextureLoadHandles.Add(TexturePath, MoveTemp(LoadHandle));
 	}
 
-	const FString AssetName = FPackageName::ObjectPathToObjectName(FString(TextureObjectPath));
-	TileItem->SetTileData(FName(*AssetName), ItemTexture, Quantity);
+	for (const TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& PreviousLoadHandle : PreviousLoadHandles)
+	{
+		if (PreviousLoadHandle.Value.IsValid())
+		{
+			PreviousLoadHandle.Value->CancelHandle();
+		}
+	}
+}
 
-	TileItems.Add(TileItem);
-	ItemTileView->AddItem(TileItem);
+void UMCPItemTilePopupWidget::CancelItemTextureRequest()
+{
+	for (const TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& LoadHandle : ItemTextureLoadHandles)
+	{
+		if (LoadHandle.Value.IsValid())
+		{
+			LoadHandle.Value->CancelHandle();
+		}
+	}
+
+	ItemTextureLoadHandles.Reset();
+	TileItemsByTexturePath.Reset();
+}
+
+void UMCPItemTilePopupWidget::HandleItemTextureLoaded(const FSoftObjectPath TexturePath)
+{
+	for (auto TileItemIt = TileItemsByTexturePath.CreateConstKeyIterator(TexturePath); TileItemIt; ++TileItemIt)
+	{
+		if (UMCPItemTileDataObject* const TileItem = TileItemIt.Value().Get())
+		{
+			TileItem->NotifyItemTextureLoaded();
+		}
+	}
 }
@@ -7,8 +7,11 @@
 #include "MCPItemTilePopupWidget.generated.h"
 
 class UButton;
+class UMCPIconAtlasData;
+class UMCPItemCatalogData;
 class UMCPItemTileDataObject;
 class UTileView;
+struct FStreamableHandle;
 
 UCLASS(BlueprintType, Blueprintable)
 class MCPDEMOPROJECT_API UMCPItemTilePopupWidget : public UMCPPopupWidget
@@ -16,8 +19,10 @@ class MCPDEMOPROJECT_API UMCPItemTilePopupWidget : public UMCPPopupWidget
 	GENERATED_BODY()
 
 protected:
+	virtual void ResetPopupState() override;
 	virtual void NativeOnInitialized() override;
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
 
 	UFUNCTION()
 	void HandleClearButtonClicked();
@@ -28,8 +33,13 @@ protected:
 	void PopulateDefaultItems();
 	void PopulateRandomizedItems();
 	void ClearItems();
+	const UMCPItemCatalogData* ResolveItemCatalog();
 	void RebuildItemsFromIndices(const TArray<int32>& ItemIndices, bool bUseRandomQuantities);
-	void AddItemFromTexturePath(const TCHAR* TextureObjectPath, const int32 Quantity);
+	UMCPItemTileDataObject* AcquireTileItem();
+	const UMCPIconAtlasData* ResolveEntryIconAtlas() const;
+	void RequestItemTextures();
+	void CancelItemTextureRequest();
+	void HandleItemTextureLoaded(FSoftObjectPath TexturePath);
 
 protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Item Tile Popup", meta = (BindWidgetOptional))
@@ -41,6 +51,27 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Item Tile Popup", meta = (BindWidgetOptional))
 	TObjectPtr<UButton> RandomizeButton = nullptr;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item Tile Popup")
+	TObjectPtr<UMCPItemCatalogData> ItemCatalog = nullptr;
+
+	// Upper bound on listed tiles; only listed items have their icons requested.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item Tile Popup", meta = (ClampMin = "1", UIMin = "1"))
+	int32 MaxListedItems = 64;
+
+	// The built-in item list, created when no ItemCatalog is assigned.
+	UPROPERTY(Transient)
+	TObjectPtr<UMCPItemCatalogData> FallbackItemCatalog = nullptr;
+
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UMCPItemTileDataObject>> TileItems;
+
+	// Data objects released by ClearItems, handed back out by AcquireTileItem so refreshes allocate no UObjects.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UMCPItemTileDataObject>> PooledTileItems;
+
+	// One request per distinct tile texture; holding them keeps the textures resident while the popup is open.
+	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> ItemTextureLoadHandles;
+
+	// Listed tiles by texture, so a finished load notifies only the tiles that show it.
+	TMultiMap<FSoftObjectPath, TWeakObjectPtr<UMCPItemTileDataObject>> TileItemsByTexturePath;
 };
@@ -0,0 +1,112 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MCPPopupAnimationSubsystem.h"
+
+#include "MCPDemoProject.h"
+#include "MCPPopupWidget.h"
+
+DECLARE_CYCLE_STAT(TEXT("Popup Animation Tick"), STAT_MCPPopupAnimationTick, STATGROUP_MCPUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Animating Popups"), STAT_MCPAnimatingPopups, STATGROUP_MCPUI);
+
+void UMCPPopupAnimationSubsystem::RegisterPopup(UMCPPopupWidget* PopupWidget)
+{
+	if (PopupWidget != nullptr)
+	{
+		AnimatingPopups.AddUnique(PopupWidget);
+	}
+}
+
+void UMCPPopupAnimationSubsystem::UnregisterPopup(UMCPPopupWidget* PopupWidget)
+{
+	const int32 PopupIndex = AnimatingPopups.IndexOfByKey(PopupWidget);
+	if (PopupIndex != INDEX_NONE)
+	{
+		AnimatingPopups[PopupIndex].Reset();
+	}
+}
+
+float UMCPPopupAnimationSubsystem::SampleElasticOutCurve(const float OscillationCount, const float Alpha) const
+{
+	if (Alpha <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	if (Alpha >= 1.0f)
+	{
+		return 1.0f;
+	}
+
+	const TArray<float>& Curve = FindOrBuildElasticOutCurve(OscillationCount);
+	const float SamplePosition = Alpha * ElasticOutCurveSampleCount;
+	const int32 SampleIndex = FMath::Min(FMath::FloorToInt32(SamplePosition), ElasticOutCurveSampleCount - 1);
+	return FMath::Lerp(Curve[SampleIndex], Curve[SampleIndex + 1], SamplePosition - SampleIndex);
+}
+
+void UMCPPopupAnimationSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_MCPPopupAnimationTick);
+	SET_DWORD_STAT(STAT_MCPAnimatingPopups, AnimatingPopups.Num());
+
+	// Popups registered during the pass are appended and picked up by the same loop.
+	for (int32 PopupIndex = 0; PopupIndex < AnimatingPopups.Num(); ++PopupIndex)
+	{
+		UMCPPopupWidget* const PopupWidget = AnimatingPopups[PopupIndex].Get();
+		if (PopupWidget != nullptr && !PopupWidget->TickOpenElasticScaleAnimation(DeltaTime))
+		{
+			AnimatingPopups[PopupIndex].Reset();
+		}
+	}
+
+	AnimatingPopups.RemoveAll([](const TWeakObjectPtr<UMCPPopupWidget>& PopupWidget)
+	{
+		return !PopupWidget.IsValid();
+	});
+}
+
+bool UMCPPopupAnimationSubsystem::IsTickable() const
+{
+	return !AnimatingPopups.IsEmpty();
+}
+
+TStatId UMCPPopupAnimationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMCPPopupAnimationSubsystem, STATGROUP_Tickables);
+}
+
+float UMCPPopupAnimationSubsystem::EvaluateElasticOutAlpha(const float OscillationCount, const float Alpha)
+{
+	if (Alpha <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	if (Alpha >= 1.0f)
+	{
+		return 1.0f;
+	}
+
+	return 1.0f - FMath::Pow(2.0f, -10.0f * Alpha) * FMath::Cos(2.0f * PI * OscillationCount * Alpha);
+}
+
+const TArray<float>& UMCPPopupAnimationSubsystem::FindOrBuildElasticOutCurve(const float OscillationCount) const
+{
+	const float ClampedOscillationCount = FMath::Max(OscillationCount, 0.5f);
+	const int32 CurveKey = FMath::RoundToInt32(ClampedOscillationCount * 1000.0f);
+	if (const TArray<float>* const ExistingCurve = ElasticOutCurves.Find(CurveKey))
+	{
+		return *ExistingCurve;
+	}
+
+	TArray<float>& Curve = ElasticOutCurves.Add(CurveKey);
+	Curve.SetNumUninitialized(ElasticOutCurveSampleCount + 1);
+	for (int32 SampleIndex = 0; SampleIndex <= ElasticOutCurveSampleCount; ++SampleIndex)
+	{
+		const float SampleAlpha = static_cast<float>(SampleIndex) / ElasticOutCurveSampleCount;
+		Curve[SampleIndex] = EvaluateElasticOutAlpha(ClampedOscillationCount, SampleAlpha);
+	}
+
+	return Curve;
+}
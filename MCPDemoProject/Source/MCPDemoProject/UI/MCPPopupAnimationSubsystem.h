@@ -0,0 +1,41 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MCPPopupAnimationSubsystem.generated.h"
+
+class UMCPPopupWidget;
+
+// Ticks every animating popup of a world in one pass, using the world's dilated and pausable delta time.
+UCLASS()
+class MCPDEMOPROJECT_API UMCPPopupAnimationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 ElasticOutCurveSampleCount = 256;
+
+	void RegisterPopup(UMCPPopupWidget* PopupWidget);
+	void UnregisterPopup(UMCPPopupWidget* PopupWidget);
+
+	// Samples the elastic-out curve from a table built once per distinct oscillation count.
+	float SampleElasticOutCurve(float OscillationCount, float Alpha) const;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	static float EvaluateElasticOutAlpha(float OscillationCount, float Alpha);
+
+	const TArray<float>& FindOrBuildElasticOutCurve(float OscillationCount) const;
+
+private:
+	// Unregistering during a tick clears the slot; the array is compacted after the pass.
+	TArray<TWeakObjectPtr<UMCPPopupWidget>> AnimatingPopups;
+
+	// Keyed by the oscillation count in thousandths.
+	mutable TMap<int32, TArray<float>> ElasticOutCurves;
+};
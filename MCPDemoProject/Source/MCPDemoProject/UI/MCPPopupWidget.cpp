@@ -5,8 +5,29 @@
 #include "Blueprint/WidgetTree.h"
 #include "Components/Button.h"
 #include "Components/Widget.h"
-#include "HAL/PlatformTime.h"
-#include "TimerManager.h"
+#include "MCPPopupAnimationSubsystem.h"
+
+void UMCPPopupWidget::OpenPopup()
+{
+	SetVisibility(ESlateVisibility::Visible);
+	StartOpenElasticScaleAnimation();
+}
+
+void UMCPPopupWidget::ClosePopup()
+{
+	SetVisibility(ESlateVisibility::Collapsed);
+	ResetPopupState();
+}
+
+bool UMCPPopupWidget::IsPopupOpen() const
+{
+	return IsInViewport() && GetVisibility() != ESlateVisibility::Collapsed;
+}
+
+void UMCPPopupWidget::ResetPopupState()
+{
+	StopOpenElasticScaleAnimation();
+}
 
 void UMCPPopupWidget::NativeOnInitialized()
 {
@@ -23,7 +44,11 @@ void UMCPPopupWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
 
-	StartOpenElasticScaleAnimation();
+	// Prewarmed popups are constructed collapsed and animate when OpenPopup shows them.
+	if (GetVisibility() != ESlateVisibility::Collapsed)
+	{
+		StartOpenElasticScaleAnimation();
+	}
 }
 
 void UMCPPopupWidget::NativeDestruct()
@@ -35,7 +60,7 @@ void UMCPPopupWidget::NativeDestruct()
 
 void UMCPPopupWidget::HandleCloseButtonClicked()
 {
-	RemoveFromParent();
+	ClosePopup();
 }
 
 void UMCPPopupWidget::StartOpenElasticScaleAnimation()
@@ -56,29 +81,37 @@ void UMCPPopupWidget::StartOpenElasticScaleAnimation()
 		return;
 	}
 
+	UWorld* const World = GetWorld();
+	UMCPPopupAnimationSubsystem* const AnimationSubsystem =
+		World != nullptr ? World->GetSubsystem<UMCPPopupAnimationSubsystem>() : nullptr;
+	if (AnimationSubsystem == nullptr)
+	{
+		ApplyOpenElasticScale(1.0f);
+		return;
+	}
+
 	OpenElasticElapsedTime = 0.0f;
-	OpenElasticLastTimestamp = -1.0;
 	bOpenElasticScaleAnimationActive = true;
 
 	ApplyOpenElasticScale(OpenElasticStartScale);
-
-	if (UWorld* const World = GetWorld())
-	{
-		OpenElasticScaleTimerHandle =
-			World->GetTimerManager().SetTimerForNextTick(this, &UMCPPopupWidget::HandleOpenElasticScaleAnimationTick);
-	}
+	AnimationSubsystem->RegisterPopup(this);
 }
 
 void UMCPPopupWidget::StopOpenElasticScaleAnimation()
 {
-	if (UWorld* const World = GetWorld())
+	if (bOpenElasticScaleAnimationActive)
 	{
-		World->GetTimerManager().ClearTimer(OpenElasticScaleTimerHandle);
+		if (UWorld* const World = GetWorld())
+		{
+			if (UMCPPopupAnimationSubsystem* const AnimationSubsystem = World->GetSubsystem<UMCPPopupAnimationSubsystem>())
+			{
+				AnimationSubsystem->UnregisterPopup(this);
+			}
+		}
 	}
 
 	bOpenElasticScaleAnimationActive = false;
 	OpenElasticElapsedTime = 0.0f;
-	OpenElasticLastTimestamp = -1.0;
 
 	if (OpenElasticAnimatedWidget != nullptr)
 	{
@@ -88,33 +121,27 @@ void UMCPPopupWidget::StopOpenElasticScaleAnimation()
 	OpenElasticAnimatedWidget = nullptr;
 }
 
-void UMCPPopupWidget::HandleOpenElasticScaleAnimationTick()
+bool UMCPPopupWidget::TickOpenElasticScaleAnimation(const float DeltaTime)
 {
 	if (!bOpenElasticScaleAnimationActive || OpenElasticAnimatedWidget == nullptr)
 	{
-		return;
+		return false;
 	}
 
-	UWorld* const World = GetWorld();
-	if (World == nullptr)
+	const UWorld* const World = GetWorld();
+	const UMCPPopupAnimationSubsystem* const AnimationSubsystem =
+		World != nullptr ? World->GetSubsystem<UMCPPopupAnimationSubsystem>() : nullptr;
+	if (AnimationSubsystem == nullptr)
 	{
 		StopOpenElasticScaleAnimation();
-		return;
-	}
-
-	const double CurrentTimestamp = FPlatformTime::Seconds();
-	if (OpenElasticLastTimestamp < 0.0)
-	{
-		OpenElasticLastTimestamp = CurrentTimestamp;
+		return false;
 	}
 
-	const float DeltaTime = static_cast<float>(CurrentTimestamp - OpenElasticLastTimestamp);
-	OpenElasticLastTimestamp = CurrentTimestamp;
 	OpenElasticElapsedTime += FMath::Max(DeltaTime, 0.0f);
 
 	const float Duration = FMath::Max(OpenElasticScaleDuration, 0.05f);
 	const float Alpha = FMath::Clamp(OpenElasticElapsedTime / Duration, 0.0f, 1.0f);
-	const float EasedAlpha = EvaluateElasticOutAlpha(Alpha);
+	const float EasedAlpha = AnimationSubsystem->SampleElasticOutCurve(OpenElasticOscillationCount, Alpha);
 	const float CurrentScale = FMath::Lerp(OpenElasticStartScale, 1.0f, EasedAlpha);
 
 	ApplyOpenElasticScale(CurrentScale);
@@ -122,11 +149,10 @@ void UMCPPopupWidget::HandleOpenElasticScaleAnimationTick()
 	if (Alpha >= 1.0f)
 	{
 		StopOpenElasticScaleAnimation();
-		return;
+		return false;
 	}
 
-	OpenElasticScaleTimerHandle =
-		World->GetTimerManager().SetTimerForNextTick(this, &UMCPPopupWidget::HandleOpenElasticScaleAnimationTick);
+	return true;
 }
 
 UWidget* UMCPPopupWidget::ResolveOpenElasticScaleTargetWidget() const
@@ -142,22 +168,6 @@ UWidget* UMCPPopupWidget::ResolveOpenElasticScaleTargetWidget() const
 	return GetRootWidget();
 }
 
-float UMCPPopupWidget::EvaluateElasticOutAlpha(const float Alpha) const
-{
-	if (Alpha <= 0.0f)
-	{
-		return 0.0f;
-	}
-
-	if (Alpha >= 1.0f)
-	{
-		return 1.0f;
-	}
-
-	const float OscillationCount = FMath::Max(OpenElasticOscillationCount, 0.5f);
-	return 1.0f - FMath::Pow(2.0f, -10.0f * Alpha) * FMath::Cos(2.0f * PI * OscillationCount * Alpha);
-}
-
 void UMCPPopupWidget::ApplyOpenElasticScale(const float Scale) const
 {
 	if (OpenElasticAnimatedWidget != nullptr)
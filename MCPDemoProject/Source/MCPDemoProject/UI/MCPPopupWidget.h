@@ -4,7 +4,6 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
-#include "TimerManager.h"
 #include "MCPPopupWidget.generated.h"
 
 class UButton;
@@ -17,7 +16,22 @@ class MCPDEMOPROJECT_API UMCPPopupWidget : public UUserWidget
 {
 	GENERATED_BODY()
 
+public:
+	// Shows a pooled popup and replays its open animation; the widget stays in the viewport between uses.
+	void OpenPopup();
+
+	// Hides the popup for reuse and resets it through ResetPopupState.
+	void ClosePopup();
+
+	bool IsPopupOpen() const;
+
+	// Advances the open animation; called by UMCPPopupAnimationSubsystem. Returns false once it has finished.
+	bool TickOpenElasticScaleAnimation(float DeltaTime);
+
 protected:
+	// Called when a closed popup goes back to its pool; override to drop per-open state.
+	virtual void ResetPopupState();
+
 	virtual void NativeOnInitialized() override;
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
@@ -27,9 +41,7 @@ protected:
 
 	void StartOpenElasticScaleAnimation();
 	void StopOpenElasticScaleAnimation();
-	void HandleOpenElasticScaleAnimationTick();
 	UWidget* ResolveOpenElasticScaleTargetWidget() const;
-	float EvaluateElasticOutAlpha(float Alpha) const;
 	void ApplyOpenElasticScale(float Scale) const;
 
 protected:
@@ -74,9 +86,4 @@ protected:
 
 	UPROPERTY(Transient)
 	float OpenElasticElapsedTime = 0.0f;
-
-	UPROPERTY(Transient)
-	double OpenElasticLastTimestamp = -1.0;
-
-	FTimerHandle OpenElasticScaleTimerHandle;
 };
@@ -0,0 +1,292 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MCPVirtualizedUniformGridWidget.h"
+
+#include "Blueprint/WidgetTree.h"
+#include "Components/ScrollBox.h"
+#include "Components/ScrollBoxSlot.h"
+#include "Components/Spacer.h"
+#include "Components/UniformGridPanel.h"
+#include "Components/UniformGridSlot.h"
+#include "MCPDemoProject.h"
+
+DECLARE_CYCLE_STAT(TEXT("Virtualized Grid Update"), STAT_MCPVirtualizedGridUpdate, STATGROUP_MCPUI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Virtualized Grid Live Entries"), STAT_MCPVirtualizedGridLiveEntries, STATGROUP_MCPUI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Virtualized Grid Entry Pool Hits"), STAT_MCPVirtualizedGridEntryPoolHits, STATGROUP_MCPUI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Virtualized Grid Entry Pool Misses"), STAT_MCPVirtualizedGridEntryPoolMisses, STATGROUP_MCPUI);
+
+void UMCPVirtualizedUniformGridWidget::SetItemCount(const int32 InItemCount)
+{
+	const int32 NewItemCount = FMath::Max(InItemCount, 0);
+	if (NewItemCount == ItemCount)
+	{
+		return;
+	}
+
+	// Entries for items that stay in range are kept as they are; call RefreshLiveEntries if their data changed.
+	ItemCount = NewItemCount;
+	UpdateLiveRows(false);
+}
+
+void UMCPVirtualizedUniformGridWidget::SetColumnCount(const int32 InColumnCount)
+{
+	const int32 NewColumnCount = FMath::Max(InColumnCount, 1);
+	if (NewColumnCount == ColumnCount)
+	{
+		return;
+	}
+
+	// Every item moves to a new cell, so nothing can be kept in place.
+	ColumnCount = NewColumnCount;
+	UpdateLiveRows(true);
+}
+
+int32 UMCPVirtualizedUniformGridWidget::GetRowCount() const
+{
+	return FMath::DivideAndRoundUp(ItemCount, FMath::Max(ColumnCount, 1));
+}
+
+void UMCPVirtualizedUniformGridWidget::ScrollToItem(const int32 ItemIndex)
+{
+	if (GridScrollBox == nullptr || GridPanel == nullptr || ItemIndex < 0 || ItemIndex >= ItemCount)
+	{
+		return;
+	}
+
+	GridScrollBox->SetScrollOffset(GetGridTopOffset() + (ItemIndex / ColumnCount) * GetRowStride());
+	UpdateLiveRows(false);
+}
+
+void UMCPVirtualizedUniformGridWidget::RefreshLiveEntries()
+{
+	const int32 FirstLiveItem = FirstLiveRow * ColumnCount;
+	for (int32 LiveIndex = 0; LiveIndex < LiveEntries.Num(); ++LiveIndex)
+	{
+		if (UUserWidget* const EntryWidget = LiveEntries[LiveIndex])
+		{
+			OnEntryAssigned.Broadcast(EntryWidget, FirstLiveItem + LiveIndex);
+		}
+	}
+}
+
+UUserWidget* UMCPVirtualizedUniformGridWidget::GetEntryWidgetForItem(const int32 ItemIndex) const
+{
+	const int32 LiveIndex = ItemIndex - FirstLiveRow * ColumnCount;
+	return ItemIndex >= 0 && LiveEntries.IsValidIndex(LiveIndex) ? LiveEntries[LiveIndex].Get() : nullptr;
+}
+
+void UMCPVirtualizedUniformGridWidget::ReleaseSlateResources(const bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	// Pooled entries are outside the widget tree, so nothing else releases their Slate widgets.
+	for (UUserWidget* const EntryWidget : PooledEntries)
+	{
+		if (EntryWidget != nullptr)
+		{
+			EntryWidget->ReleaseSlateResources(bReleaseChildren);
+		}
+	}
+}
+
+void UMCPVirtualizedUniformGridWidget::NativeOnInitialized()
+{
+	Super::NativeOnInitialized();
+
+	// The grid is owned by this widget from here on; drops any instances baked into the asset at design time.
+	if (GridPanel != nullptr)
+	{
+		GridPanel->ClearChildren();
+	}
+}
+
+void UMCPVirtualizedUniformGridWidget::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	UpdateLiveRows(false);
+}
+
+void UMCPVirtualizedUniformGridWidget::NativeTick(const FGeometry& MyGeometry, const float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	// Catches scrolling, viewport resizes and the first layout pass; a frame with no row change costs a few divisions.
+	if (!IsDesignTime())
+	{
+		UpdateLiveRows(false);
+	}
+}
+
+void UMCPVirtualizedUniformGridWidget::UpdateLiveRows(const bool bForceRebuild)
+{
+	if (GridScrollBox == nullptr || GridPanel == nullptr || EntryWidgetClass == nullptr)
+	{
+		return;
+	}
+
+	const int32 RowCount = GetRowCount();
+	const float RowStride = GetRowStride();
+	const float ViewportHeight = GridScrollBox->GetCachedGeometry().GetLocalSize().Y;
+	const float GridScrollOffset = GridScrollBox->GetScrollOffset() - GetGridTopOffset();
+
+	const int32 NewFirstRow = FMath::Clamp(FMath::FloorToInt(GridScrollOffset / RowStride) - OverscanRows, 0, RowCount);
+	const int32 NewEndRow = FMath::Clamp(
+		FMath::CeilToInt((GridScrollOffset + ViewportHeight) / RowStride) + OverscanRows,
+		NewFirstRow,
+		RowCount);
+	const int32 NewFirstItem = FMath::Min(NewFirstRow * ColumnCount, ItemCount);
+	const int32 NewEndItem = FMath::Min(NewEndRow * ColumnCount, ItemCount);
+	if (!bForceRebuild
+		&& NewFirstRow == FirstLiveRow
+		&& NewEndRow == EndLiveRow
+		&& NewEndItem - NewFirstItem == LiveEntries.Num())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_MCPVirtualizedGridUpdate);
+
+	if (bForceRebuild)
+	{
+		ReleaseAllLiveEntries();
+	}
+
+	// Entries still in range keep their cell; the rest go back to the pool first so newly exposed rows reuse them.
+	const int32 OldFirstItem = FirstLiveRow * ColumnCount;
+	TArray<TObjectPtr<UUserWidget>> NewLiveEntries;
+	NewLiveEntries.SetNum(NewEndItem - NewFirstItem);
+	for (int32 LiveIndex = 0; LiveIndex < LiveEntries.Num(); ++LiveIndex)
+	{
+		const int32 ItemIndex = OldFirstItem + LiveIndex;
+		if (ItemIndex >= NewFirstItem && ItemIndex < NewEndItem)
+		{
+			NewLiveEntries[ItemIndex - NewFirstItem] = LiveEntries[LiveIndex];
+		}
+		else
+		{
+			ReleaseEntryWidget(LiveEntries[LiveIndex]);
+		}
+	}
+
+	for (int32 ItemIndex = NewFirstItem; ItemIndex < NewEndItem; ++ItemIndex)
+	{
+		TObjectPtr<UUserWidget>& EntryWidget = NewLiveEntries[ItemIndex - NewFirstItem];
+		if (EntryWidget != nullptr)
+		{
+			continue;
+		}
+
+		EntryWidget = AcquireEntryWidget();
+		if (EntryWidget == nullptr)
+		{
+			continue;
+		}
+
+		// Rows are absolute; the extent placeholder keeps the rows above the live range sized but empty.
+		GridPanel->AddChildToUniformGrid(EntryWidget, ItemIndex / ColumnCount, ItemIndex % ColumnCount);
+		OnEntryAssigned.Broadcast(EntryWidget, ItemIndex);
+	}
+
+	LiveEntries = MoveTemp(NewLiveEntries);
+	FirstLiveRow = NewFirstRow;
+	EndLiveRow = NewEndRow;
+	UpdateExtentPlaceholder();
+
+	SET_DWORD_STAT(STAT_MCPVirtualizedGridLiveEntries, LiveEntries.Num());
+}
+
+float UMCPVirtualizedUniformGridWidget::GetRowStride() const
+{
+	check(GridPanel != nullptr);
+
+	// The panel splits its height evenly between rows. After a row count change this lags by one frame,
+	// which the next tick corrects.
+	const int32 RowCount = GetRowCount();
+	const float LaidOutHeight = GridPanel->GetCachedGeometry().GetLocalSize().Y;
+	if (RowCount > 0 && LaidOutHeight > 0.0f)
+	{
+		return LaidOutHeight / RowCount;
+	}
+
+	return FMath::Max3(
+		GridPanel->GetMinDesiredSlotHeight(),
+		GridPanel->GetSlotPadding().GetTotalSpaceAlong<Orient_Vertical>(),
+		1.0f);
+}
+
+float UMCPVirtualizedUniformGridWidget::GetGridTopOffset() const
+{
+	const UScrollBoxSlot* const GridPanelSlot = GridPanel != nullptr ? Cast<UScrollBoxSlot>(GridPanel->Slot) : nullptr;
+	return GridPanelSlot != nullptr ? GridPanelSlot->GetPadding().Top : 0.0f;
+}
+
+UUserWidget* UMCPVirtualizedUniformGridWidget::AcquireEntryWidget()
+{
+	if (!PooledEntries.IsEmpty())
+	{
+		INC_DWORD_STAT(STAT_MCPVirtualizedGridEntryPoolHits);
+		return PooledEntries.Pop(EAllowShrinking::No);
+	}
+
+	INC_DWORD_STAT(STAT_MCPVirtualizedGridEntryPoolMisses);
+	return CreateWidget<UUserWidget>(this, EntryWidgetClass);
+}
+
+void UMCPVirtualizedUniformGridWidget::ReleaseEntryWidget(UUserWidget* EntryWidget)
+{
+	if (EntryWidget == nullptr)
+	{
+		return;
+	}
+
+	EntryWidget->RemoveFromParent();
+	PooledEntries.Add(EntryWidget);
+}
+
+void UMCPVirtualizedUniformGridWidget::ReleaseAllLiveEntries()
+{
+	for (UUserWidget* const EntryWidget : LiveEntries)
+	{
+		ReleaseEntryWidget(EntryWidget);
+	}
+
+	LiveEntries.Reset();
+	FirstLiveRow = 0;
+	EndLiveRow = 0;
+}
+
+void UMCPVirtualizedUniformGridWidget::UpdateExtentPlaceholder()
+{
+	const int32 RowCount = GetRowCount();
+	if (RowCount == 0)
+	{
+		if (ExtentPlaceholder != nullptr)
+		{
+			ExtentPlaceholder->RemoveFromParent();
+		}
+
+		return;
+	}
+
+	if (ExtentPlaceholder == nullptr && WidgetTree != nullptr)
+	{
+		ExtentPlaceholder = WidgetTree->ConstructWidget<USpacer>(USpacer::StaticClass());
+		ExtentPlaceholder->SetVisibility(ESlateVisibility::HitTestInvisible);
+	}
+
+	if (ExtentPlaceholder == nullptr)
+	{
+		return;
+	}
+
+	if (ExtentPlaceholder->GetParent() != GridPanel)
+	{
+		GridPanel->AddChildToUniformGrid(ExtentPlaceholder, RowCount - 1, ColumnCount - 1);
+	}
+	else if (UUniformGridSlot* const PlaceholderSlot = Cast<UUniformGridSlot>(ExtentPlaceholder->Slot))
+	{
+		PlaceholderSlot->SetRow(RowCount - 1);
+		PlaceholderSlot->SetColumn(ColumnCount - 1);
+	}
+}
@@ -0,0 +1,110 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "MCPVirtualizedUniformGridWidget.generated.h"
+
+class UScrollBox;
+class USpacer;
+class UUniformGridPanel;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
+	FMCPVirtualizedGridEntryAssignedSignature,
+	UUserWidget*,
+	EntryWidget,
+	int32,
+	ItemIndex);
+
+// Uniform grid inside a scroll box that only materializes entry widgets for the visible rows.
+// Items keep the UniformGridPanel layout (row = index / columns, column = index % columns), but entries
+// are recycled while scrolling, so the widget count follows the viewport rather than the item count.
+// Rows are assumed to share one height; entries taller than MinDesiredSlotHeight set the stride for every row.
+UCLASS(BlueprintType, Blueprintable)
+class MCPDEMOPROJECT_API UMCPVirtualizedUniformGridWidget : public UUserWidget
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "Virtualized Grid")
+	void SetItemCount(int32 InItemCount);
+
+	UFUNCTION(BlueprintPure, Category = "Virtualized Grid")
+	int32 GetItemCount() const { return ItemCount; }
+
+	UFUNCTION(BlueprintCallable, Category = "Virtualized Grid")
+	void SetColumnCount(int32 InColumnCount);
+
+	UFUNCTION(BlueprintPure, Category = "Virtualized Grid")
+	int32 GetColumnCount() const { return ColumnCount; }
+
+	UFUNCTION(BlueprintPure, Category = "Virtualized Grid")
+	int32 GetRowCount() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Virtualized Grid")
+	void ScrollToItem(int32 ItemIndex);
+
+	// Re-broadcasts OnEntryAssigned for every live entry, e.g. after the backing data changed in place.
+	UFUNCTION(BlueprintCallable, Category = "Virtualized Grid")
+	void RefreshLiveEntries();
+
+	// Null when the item is out of range or its row is not materialized.
+	UFUNCTION(BlueprintPure, Category = "Virtualized Grid")
+	UUserWidget* GetEntryWidgetForItem(int32 ItemIndex) const;
+
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+public:
+	// Fired whenever an entry widget is placed on an item, including when a recycled entry moves to a new one.
+	UPROPERTY(BlueprintAssignable, Category = "Virtualized Grid")
+	FMCPVirtualizedGridEntryAssignedSignature OnEntryAssigned;
+
+protected:
+	virtual void NativeOnInitialized() override;
+	virtual void NativeConstruct() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
+	void UpdateLiveRows(bool bForceRebuild);
+	float GetRowStride() const;
+	float GetGridTopOffset() const;
+	UUserWidget* AcquireEntryWidget();
+	void ReleaseEntryWidget(UUserWidget* EntryWidget);
+	void ReleaseAllLiveEntries();
+	void UpdateExtentPlaceholder();
+
+protected:
+	UPROPERTY(BlueprintReadOnly, Category = "Virtualized Grid", meta = (BindWidgetOptional))
+	TObjectPtr<UScrollBox> GridScrollBox = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Virtualized Grid", meta = (BindWidgetOptional))
+	TObjectPtr<UUniformGridPanel> GridPanel = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Virtualized Grid")
+	TSubclassOf<UUserWidget> EntryWidgetClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Virtualized Grid", meta = (ClampMin = "1", UIMin = "1"))
+	int32 ColumnCount = 4;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Virtualized Grid", meta = (ClampMin = "0", UIMin = "0"))
+	int32 ItemCount = 0;
+
+	// Rows kept alive above and below the viewport so short scrolls do not churn entries.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Virtualized Grid", meta = (ClampMin = "0", UIMin = "0"))
+	int32 OverscanRows = 1;
+
+	// Live entries for rows [FirstLiveRow, EndLiveRow), indexed by ItemIndex - FirstLiveRow * ColumnCount.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UUserWidget>> LiveEntries;
+
+	// Entries scrolled out of view, handed back out by AcquireEntryWidget.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UUserWidget>> PooledEntries;
+
+	// Empty cell in the last row and column; it gives the panel its full height and column count.
+	UPROPERTY(Transient)
+	TObjectPtr<USpacer> ExtentPlaceholder = nullptr;
+
+	int32 FirstLiveRow = 0;
+	int32 EndLiveRow = 0;
+};